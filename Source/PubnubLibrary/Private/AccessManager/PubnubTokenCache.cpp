@@ -0,0 +1,294 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "AccessManager/PubnubTokenCache.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "FunctionLibraries/PubnubTokenUtilities.h"
+#include "Internationalization/Regex.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeRWLock.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+
+
+namespace
+{
+	//Keys used by pubnub_parse_token for every resource type, in EPubnubTokenResourceType order
+	const TCHAR* const ResourceTypeKeys[FPubnubParsedToken::ResourceTypeCount] = {TEXT("chan"), TEXT("grp"), TEXT("uuid")};
+
+	bool IsRegexMetaCharacter(TCHAR Character)
+	{
+		return FCString::Strchr(TEXT("\\^$.|?*+()[]{}"), Character) != nullptr;
+	}
+
+	void InitPattern(FPubnubParsedToken::FPattern& Pattern)
+	{
+		using EMatchType = FPubnubParsedToken::FPattern::EMatchType;
+
+		FString Body = Pattern.Pattern;
+		const bool bAnchoredStart = Body.StartsWith(TEXT("^"), ESearchCase::CaseSensitive);
+		if(bAnchoredStart)
+		{
+			Body.RightChopInline(1);
+		}
+		bool bAnchoredEnd = false;
+		if(Body.EndsWith(TEXT("$"), ESearchCase::CaseSensitive) && (Body.Len() < 2 || Body[Body.Len() - 2] != TEXT('\\')))
+		{
+			Body.LeftChopInline(1);
+			bAnchoredEnd = true;
+		}
+		bool bTrailingWildcard = false;
+		if(Body.EndsWith(TEXT(".*"), ESearchCase::CaseSensitive) && (Body.Len() < 3 || Body[Body.Len() - 3] != TEXT('\\')))
+		{
+			Body.LeftChopInline(2);
+			bTrailingWildcard = true;
+		}
+
+		bool bLiteral = true;
+		for(const TCHAR Character : Body)
+		{
+			if(IsRegexMetaCharacter(Character))
+			{
+				bLiteral = false;
+				break;
+			}
+		}
+
+		if(bLiteral && (bTrailingWildcard || !bAnchoredEnd))
+		{
+			Pattern.MatchType = bAnchoredStart ? EMatchType::Prefix : EMatchType::Contains;
+			Pattern.Literal = MoveTemp(Body);
+		}
+		else if(bLiteral && bAnchoredStart)
+		{
+			Pattern.MatchType = EMatchType::Exact;
+			Pattern.Literal = MoveTemp(Body);
+		}
+		else
+		{
+			Pattern.MatchType = EMatchType::Regex;
+			Pattern.Regex = MakeShared<FRegexPattern, ESPMode::ThreadSafe>(Pattern.Pattern);
+		}
+	}
+
+	void ReadResourcesOfType(const TSharedPtr<FJsonObject>& ResourcesObject, const TCHAR* TypeKey, TFunctionRef<void(const FString&, uint8)> AddResource)
+	{
+		const TSharedPtr<FJsonObject>* TypeObject = nullptr;
+		if(!ResourcesObject->TryGetObjectField(TypeKey, TypeObject) || !TypeObject || !TypeObject->IsValid())
+		{
+			return;
+		}
+		for(const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*TypeObject)->Values)
+		{
+			if(Pair.Value.IsValid() && Pair.Value->Type == EJson::Number)
+			{
+				AddResource(Pair.Key, static_cast<uint8>(static_cast<int32>(Pair.Value->AsNumber())));
+			}
+		}
+	}
+}
+
+bool FPubnubParsedToken::FPattern::Matches(const FString& ResourceID) const
+{
+	switch(MatchType)
+	{
+	case EMatchType::Exact:
+		return ResourceID.Equals(Literal, ESearchCase::CaseSensitive);
+	case EMatchType::Prefix:
+		return ResourceID.StartsWith(Literal, ESearchCase::CaseSensitive);
+	case EMatchType::Contains:
+		return ResourceID.Contains(Literal, ESearchCase::CaseSensitive);
+	case EMatchType::Regex:
+		{
+			if(!Regex.IsValid())
+			{
+				return false;
+			}
+			FRegexMatcher Matcher(*Regex, ResourceID);
+			return Matcher.FindNext();
+		}
+	}
+	return false;
+}
+
+TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> FPubnubParsedToken::FromParsedTokenJson(const FString& ParsedTokenJson)
+{
+	TSharedPtr<FJsonObject> TokenObject;
+	if(ParsedTokenJson.IsEmpty() || !UPubnubJsonUtilities::StringToJsonObject(ParsedTokenJson, TokenObject) || !TokenObject.IsValid())
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken = MakeShared<FPubnubParsedToken, ESPMode::ThreadSafe>();
+	double NumberValue = 0;
+	if(TokenObject->TryGetNumberField(TEXT("v"), NumberValue))
+	{
+		ParsedToken->Version = static_cast<int32>(NumberValue);
+	}
+	if(TokenObject->TryGetNumberField(TEXT("t"), NumberValue))
+	{
+		ParsedToken->Timestamp = static_cast<int64>(NumberValue);
+	}
+	if(TokenObject->TryGetNumberField(TEXT("ttl"), NumberValue))
+	{
+		ParsedToken->TTL = static_cast<int32>(NumberValue);
+	}
+	TokenObject->TryGetStringField(TEXT("aud"), ParsedToken->AuthorizedUser);
+
+	const TSharedPtr<FJsonObject>* ResourcesObject = nullptr;
+	if(TokenObject->TryGetObjectField(TEXT("res"), ResourcesObject) && ResourcesObject && ResourcesObject->IsValid())
+	{
+		for(int32 TypeIndex = 0; TypeIndex < ResourceTypeCount; TypeIndex++)
+		{
+			FResourcesMap& TypeResources = ParsedToken->Resources[TypeIndex];
+			ReadResourcesOfType(*ResourcesObject, ResourceTypeKeys[TypeIndex], [&TypeResources](const FString& ResourceID, uint8 Bitmask)
+			{
+				TypeResources.Add(ResourceID, Bitmask);
+			});
+		}
+	}
+
+	const TSharedPtr<FJsonObject>* PatternsObject = nullptr;
+	if(TokenObject->TryGetObjectField(TEXT("pat"), PatternsObject) && PatternsObject && PatternsObject->IsValid())
+	{
+		for(int32 TypeIndex = 0; TypeIndex < ResourceTypeCount; TypeIndex++)
+		{
+			TArray<FPattern>& TypePatterns = ParsedToken->Patterns[TypeIndex];
+			ReadResourcesOfType(*PatternsObject, ResourceTypeKeys[TypeIndex], [&TypePatterns](const FString& PatternString, uint8 Bitmask)
+			{
+				FPattern& Pattern = TypePatterns.AddDefaulted_GetRef();
+				Pattern.Pattern = PatternString;
+				Pattern.Bitmask = Bitmask;
+				InitPattern(Pattern);
+			});
+		}
+	}
+
+	return ParsedToken;
+}
+
+uint8 FPubnubParsedToken::GetPermissionsBitmask(EPubnubTokenResourceType ResourceType, const FString& ResourceID) const
+{
+	const int32 TypeIndex = static_cast<int32>(ResourceType);
+	if(TypeIndex < 0 || TypeIndex >= ResourceTypeCount)
+	{
+		return 0;
+	}
+
+	uint8 Bitmask = 0;
+	if(const uint8* ResourceBitmask = Resources[TypeIndex].Find(ResourceID))
+	{
+		Bitmask = *ResourceBitmask;
+	}
+	for(const FPattern& Pattern : Patterns[TypeIndex])
+	{
+		//Pattern can't add anything new, no need to match it
+		if((Bitmask | Pattern.Bitmask) != Bitmask && Pattern.Matches(ResourceID))
+		{
+			Bitmask |= Pattern.Bitmask;
+		}
+	}
+	return Bitmask;
+}
+
+bool FPubnubParsedToken::HasPermission(EPubnubTokenResourceType ResourceType, const FString& ResourceID, EPubnubTokenPermission Permission) const
+{
+	const uint8 PermissionBit = static_cast<uint8>(UPubnubTokenUtilities::GetPermissionBit(Permission));
+	const int32 TypeIndex = static_cast<int32>(ResourceType);
+	if(PermissionBit == 0 || TypeIndex < 0 || TypeIndex >= ResourceTypeCount)
+	{
+		return false;
+	}
+
+	const uint8* ResourceBitmask = Resources[TypeIndex].Find(ResourceID);
+	if(ResourceBitmask && (*ResourceBitmask & PermissionBit) != 0)
+	{
+		return true;
+	}
+	for(const FPattern& Pattern : Patterns[TypeIndex])
+	{
+		if((Pattern.Bitmask & PermissionBit) != 0 && Pattern.Matches(ResourceID))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FPubnubTokenCache::FPubnubTokenCache(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 1))
+{
+}
+
+uint64 FPubnubTokenCache::HashToken(const FString& Token)
+{
+	return CityHash64(reinterpret_cast<const char*>(*Token), Token.Len() * sizeof(TCHAR));
+}
+
+TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> FPubnubTokenCache::Find(const FString& Token) const
+{
+	const uint64 Hash = HashToken(Token);
+
+	FReadScopeLock ReadLock(Lock);
+	const FEntry* Entry = Entries.Find(Hash);
+	if(!Entry || !Entry->Token.Equals(Token, ESearchCase::CaseSensitive))
+	{
+		return nullptr;
+	}
+	return Entry->ParsedToken;
+}
+
+TSharedRef<const FPubnubParsedToken, ESPMode::ThreadSafe> FPubnubTokenCache::Add(const FString& Token, TSharedRef<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken)
+{
+	const uint64 Hash = HashToken(Token);
+
+	FWriteScopeLock WriteLock(Lock);
+	if(FEntry* Entry = Entries.Find(Hash))
+	{
+		if(Entry->Token.Equals(Token, ESearchCase::CaseSensitive))
+		{
+			return Entry->ParsedToken;
+		}
+		//Different token with the same hash, the newer one is more likely to be checked again
+		Entry->Token = Token;
+		Entry->ParsedToken = ParsedToken;
+		return ParsedToken;
+	}
+
+	if(Entries.Num() >= Capacity)
+	{
+		EvictEntries_priv();
+	}
+	Entries.Add(Hash, FEntry{Token, ParsedToken});
+	return ParsedToken;
+}
+
+void FPubnubTokenCache::EvictEntries_priv()
+{
+	const int64 UnixTimeNow = FDateTime::UtcNow().ToUnixTimestamp();
+	for(auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if(It.Value().ParsedToken->IsExpired(UnixTimeNow))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	//Nothing expired, drop any token. It's parsed again if it's still used
+	if(Entries.Num() >= Capacity)
+	{
+		auto It = Entries.CreateIterator();
+		It.RemoveCurrent();
+	}
+}
+
+void FPubnubTokenCache::Empty()
+{
+	FWriteScopeLock WriteLock(Lock);
+	Entries.Empty();
+}
+
+int32 FPubnubTokenCache::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Entries.Num();
+}
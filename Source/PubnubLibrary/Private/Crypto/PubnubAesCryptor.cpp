@@ -1,6 +1,7 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "Crypto/PubnubAesCryptor.h"
+#include "Crypto/PubnubCipherContextCache.h"
 #include "PubnubSubsystem.h"
 #include "FunctionLibraries/PubnubCryptoUtilities.h"
 
@@ -14,6 +15,24 @@ THIRD_PARTY_INCLUDES_START
 THIRD_PARTY_INCLUDES_END
 
 
+void UPubnubAesCryptor::SetCipherKey(const FString& NewCipherKey)
+{
+    uint8 NewKeyHash[Sha256Len];
+    const bool bHashed = !NewCipherKey.IsEmpty() && HashKeySHA256(NewCipherKey, NewKeyHash);
+
+    FRWScopeLock WriteLock(KeyHashLock, SLT_Write);
+    CipherKey = NewCipherKey;
+    if (bHashed)
+    {
+        FMemory::Memcpy(KeyHash, NewKeyHash, Sha256Len);
+        KeyGeneration = PubnubCipherContextCache::NextKeyGeneration();
+    }
+    else
+    {
+        KeyGeneration = 0;
+    }
+}
+
 TArray<uint8_t> UPubnubAesCryptor::GetIdentifier_Implementation()
 {
     return {'A', 'C', 'R', 'H'};
@@ -21,20 +40,12 @@ TArray<uint8_t> UPubnubAesCryptor::GetIdentifier_Implementation()
 
 FPubnubEncryptedData UPubnubAesCryptor::Encrypt_Implementation(const FString& Data)
 {
-    if(CipherKey.IsEmpty())
-    {
-        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't encrypt data. Use SetCipherKey before encrypting/decrypting data"));
-        return FPubnubEncryptedData();
-    }
-    
-    // Convert FString to TArray<uint8>
+    // Convert FString to UTF-8 bytes
     FTCHARToUTF8 UTF8Data(*Data);
-    TArray<uint8> DataBytes;
-    DataBytes.Append(reinterpret_cast<const uint8*>(UTF8Data.Get()), UTF8Data.Length());
     
-    // Call internal encryption function
+    // Call byte encryption function
     FPubnubEncryptedDataInternal InternalResult;
-    if (!EncryptData(CipherKey, DataBytes, InternalResult))
+    if (!EncryptBytes(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(UTF8Data.Get()), UTF8Data.Length()), InternalResult.Data, InternalResult.Metadata))
     {
         UE_LOG(PubnubLog, Error, TEXT("Internal encryption failed"));
         return FPubnubEncryptedData();
@@ -48,12 +59,6 @@ FPubnubEncryptedData UPubnubAesCryptor::Encrypt_Implementation(const FString& Da
 
 FString UPubnubAesCryptor::Decrypt_Implementation(const FPubnubEncryptedData& Data)
 {
-    if(CipherKey.IsEmpty())
-    {
-        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't decrypt data. Use SetCipherKey before encrypting/decrypting data"));
-        return "";
-    }
-    
     // Validate input
     if (Data.EncryptedData.IsEmpty() || Data.Metadata.IsEmpty())
     {
@@ -64,58 +69,84 @@ FString UPubnubAesCryptor::Decrypt_Implementation(const FPubnubEncryptedData& Da
     // Convert interface format to internal format
     FPubnubEncryptedDataInternal InternalData = ConvertFromInterface(Data);
     
-    // Call internal decryption function
+    // Call byte decryption function
     TArray<uint8> DecryptedBytes;
-    if (!DecryptData(CipherKey, InternalData, DecryptedBytes))
+    if (!DecryptBytes(InternalData.Data, InternalData.Metadata, DecryptedBytes))
     {
         UE_LOG(PubnubLog, Error, TEXT("Internal decryption failed"));
         return FString();
     }
     
-    // Convert TArray<uint8> back to FString
-    // Add null terminator for safety
-    DecryptedBytes.Add(0);
-    FString Result = FString(UTF8_TO_TCHAR(reinterpret_cast<const char*>(DecryptedBytes.GetData())));
-    
-    return Result;
+    // Convert UTF-8 bytes back to FString
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(DecryptedBytes.GetData()), DecryptedBytes.Num());
+    return FString(Converter.Length(), Converter.Get());
 }
 
+bool UPubnubAesCryptor::EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata)
+{
+    if(CipherKey.IsEmpty())
+    {
+        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't encrypt data. Use SetCipherKey before encrypting/decrypting data"));
+        return false;
+    }
+    
+    uint8 CurrentKeyHash[Sha256Len];
+    uint64 CurrentKeyGeneration = 0;
+    if (!GetKeyHash(CurrentKeyHash, CurrentKeyGeneration))
+    {
+        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to hash cipher key"));
+        return false;
+    }
+    
+    return EncryptData(CurrentKeyHash, CurrentKeyGeneration, Data, OutEncryptedData, OutMetadata);
+}
 
-
-bool UPubnubAesCryptor::EncryptData(const FString& CipherKey, const TArray<uint8>& DataToEncrypt, FPubnubEncryptedDataInternal& OutResult)
+bool UPubnubAesCryptor::DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData)
 {
-    // Clear output
-    OutResult.Data.Empty();
-    OutResult.Metadata.Empty();
+    if(CipherKey.IsEmpty())
+    {
+        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't decrypt data. Use SetCipherKey before encrypting/decrypting data"));
+        return false;
+    }
     
-    if (DataToEncrypt.Num() == 0)
+    uint8 CurrentKeyHash[Sha256Len];
+    uint64 CurrentKeyGeneration = 0;
+    if (!GetKeyHash(CurrentKeyHash, CurrentKeyGeneration))
     {
-        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: No data to encrypt"));
+        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to hash cipher key for decryption"));
         return false;
     }
     
-    // 1. Hash the cipher key with SHA256 (same as pbsha256_digest_str)
-    uint8 KeyHash[Sha256Len + 1]; // +1 for null terminator like in original
-    if (!HashKeySHA256(CipherKey, KeyHash))
+    return DecryptData(CurrentKeyHash, CurrentKeyGeneration, EncryptedData, Metadata, OutData);
+}
+
+bool UPubnubAesCryptor::EncryptData(const uint8* InKeyHash, uint64 InKeyGeneration, TConstArrayView<uint8> DataToEncrypt, TArray<uint8>& OutData, TArray<uint8>& OutMetadata)
+{
+    // Clear output, keeping the caller's allocation
+    OutData.Reset();
+    OutMetadata.Reset();
+    
+    if (DataToEncrypt.Num() == 0)
     {
-        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to hash cipher key"));
+        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: No data to encrypt"));
         return false;
     }
-    KeyHash[Sha256Len] = '\0'; // Null terminate like in original
     
-    // 2. Generate random IV (same as generate_init_vector)
+    // 1. Generate random IV (same as generate_init_vector)
     uint8 IV[AesIvSize];
     GenerateRandomIV(IV, AesIvSize);
     
-    // 3. Calculate buffer size (same as estimated_enc_buffer_size)
+    // 2. Calculate buffer size (same as estimated_enc_buffer_size)
     int32 EstimatedSize = DataToEncrypt.Num() + (AesBlockSize - (DataToEncrypt.Num() % AesBlockSize)) + AesBlockSize;
-    OutResult.Data.SetNum(EstimatedSize);
+    OutData.SetNumUninitialized(EstimatedSize);
     
-    // 4. Perform AES-256-CBC encryption (same as pbaes256_encrypt)
-    EVP_CIPHER_CTX* Context = EVP_CIPHER_CTX_new();
+    // 3. Perform AES-256-CBC encryption (same as pbaes256_encrypt) with this thread's context.
+    // Key schedule is already there if this key was used on this thread before, so only the IV is set.
+    EVP_CIPHER_CTX* Context = PubnubCipherContextCache::AcquireAes256CbcContext(true, InKeyHash, InKeyGeneration, IV);
     if (!Context)
     {
-        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to create encryption context"));
+        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to initialize AES-256 encryption"));
+        OutData.Reset();
         return false;
     }
     
@@ -125,15 +156,8 @@ bool UPubnubAesCryptor::EncryptData(const FString& CipherKey, const TArray<uint8
     
     do
     {
-        // Initialize encryption with AES-256-CBC
-        if (EVP_EncryptInit_ex(Context, EVP_aes_256_cbc(), nullptr, KeyHash, IV) != 1)
-        {
-            UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to initialize AES-256 encryption"));
-            break;
-        }
-        
         // Encrypt the data
-        if (EVP_EncryptUpdate(Context, OutResult.Data.GetData(), &Len, DataToEncrypt.GetData(), DataToEncrypt.Num()) != 1)
+        if (EVP_EncryptUpdate(Context, OutData.GetData(), &Len, DataToEncrypt.GetData(), DataToEncrypt.Num()) != 1)
         {
             UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to encrypt data"));
             break;
@@ -141,7 +165,7 @@ bool UPubnubAesCryptor::EncryptData(const FString& CipherKey, const TArray<uint8
         TotalLen = Len;
         
         // Finalize encryption (adds PKCS padding)
-        if (EVP_EncryptFinal_ex(Context, OutResult.Data.GetData() + Len, &Len) != 1)
+        if (EVP_EncryptFinal_ex(Context, OutData.GetData() + Len, &Len) != 1)
         {
             UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to finalize encryption"));
             break;
@@ -149,54 +173,44 @@ bool UPubnubAesCryptor::EncryptData(const FString& CipherKey, const TArray<uint8
         TotalLen += Len;
         
         // Resize to actual encrypted size
-        OutResult.Data.SetNum(TotalLen);
+        OutData.SetNum(TotalLen);
         
         // Store IV as metadata (same as original)
-        OutResult.Metadata.SetNum(AesIvSize);
-        FMemory::Memcpy(OutResult.Metadata.GetData(), IV, AesIvSize);
+        OutMetadata.SetNumUninitialized(AesIvSize);
+        FMemory::Memcpy(OutMetadata.GetData(), IV, AesIvSize);
         
         bSuccess = true;
         
     } while (false);
     
-    EVP_CIPHER_CTX_free(Context);
-    
     if (!bSuccess)
     {
-        OutResult.Data.Empty();
-        OutResult.Metadata.Empty();
+        OutData.Reset();
+        OutMetadata.Reset();
     }
     
     return bSuccess;
 }
 
-bool UPubnubAesCryptor::DecryptData(const FString& CipherKey, const FPubnubEncryptedDataInternal& EncryptedData, TArray<uint8>& OutResult)
+bool UPubnubAesCryptor::DecryptData(const uint8* InKeyHash, uint64 InKeyGeneration, TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutResult)
 {
-    OutResult.Empty();
+    OutResult.Reset();
     
-    if (EncryptedData.Data.Num() == 0 || EncryptedData.Metadata.Num() != AesIvSize)
+    if (EncryptedData.Num() == 0 || Metadata.Num() != AesIvSize)
     {
         UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Invalid encrypted data or metadata"));
         return false;
     }
     
-    // Hash the cipher key
-    uint8 KeyHash[Sha256Len + 1];
-    if (!HashKeySHA256(CipherKey, KeyHash))
-    {
-        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to hash cipher key for decryption"));
-        return false;
-    }
-    KeyHash[Sha256Len] = '\0';
-    
     // Prepare output buffer
-    int32 EstimatedSize = EncryptedData.Data.Num() + AesBlockSize + 1;
-    OutResult.SetNum(EstimatedSize);
+    int32 EstimatedSize = EncryptedData.Num() + AesBlockSize + 1;
+    OutResult.SetNumUninitialized(EstimatedSize);
     
-    EVP_CIPHER_CTX* Context = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* Context = PubnubCipherContextCache::AcquireAes256CbcContext(false, InKeyHash, InKeyGeneration, Metadata.GetData());
     if (!Context)
     {
-        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to create decryption context"));
+        UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to initialize AES-256 decryption"));
+        OutResult.Reset();
         return false;
     }
     
@@ -206,15 +220,8 @@ bool UPubnubAesCryptor::DecryptData(const FString& CipherKey, const FPubnubEncry
     
     do
     {
-        // Initialize decryption
-        if (EVP_DecryptInit_ex(Context, EVP_aes_256_cbc(), nullptr, KeyHash, EncryptedData.Metadata.GetData()) != 1)
-        {
-            UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to initialize AES-256 decryption"));
-            break;
-        }
-        
         // Decrypt the data
-        if (EVP_DecryptUpdate(Context, OutResult.GetData(), &Len, EncryptedData.Data.GetData(), EncryptedData.Data.Num()) != 1)
+        if (EVP_DecryptUpdate(Context, OutResult.GetData(), &Len, EncryptedData.GetData(), EncryptedData.Num()) != 1)
         {
             UE_LOG(PubnubLog, Error, TEXT("PubNubAESCrypto: Failed to decrypt data"));
             break;
@@ -235,11 +242,9 @@ bool UPubnubAesCryptor::DecryptData(const FString& CipherKey, const FPubnubEncry
         
     } while (false);
     
-    EVP_CIPHER_CTX_free(Context);
-    
     if (!bSuccess)
     {
-        OutResult.Empty();
+        OutResult.Reset();
     }
     
     return bSuccess;
@@ -273,6 +278,33 @@ bool UPubnubAesCryptor::HashKeySHA256(const FString& Key, uint8* OutHash)
     return true;
 }
 
+bool UPubnubAesCryptor::GetKeyHash(uint8* OutKeyHash, uint64& OutKeyGeneration)
+{
+    {
+        FRWScopeLock ReadLock(KeyHashLock, SLT_ReadOnly);
+        if (KeyGeneration != 0)
+        {
+            FMemory::Memcpy(OutKeyHash, KeyHash, Sha256Len);
+            OutKeyGeneration = KeyGeneration;
+            return true;
+        }
+    }
+    
+    // CipherKey was set without SetCipherKey (e.g. by a derived class), hash it once now
+    FRWScopeLock WriteLock(KeyHashLock, SLT_Write);
+    if (KeyGeneration == 0)
+    {
+        if (!HashKeySHA256(CipherKey, KeyHash))
+        {
+            return false;
+        }
+        KeyGeneration = PubnubCipherContextCache::NextKeyGeneration();
+    }
+    FMemory::Memcpy(OutKeyHash, KeyHash, Sha256Len);
+    OutKeyGeneration = KeyGeneration;
+    return true;
+}
+
 FPubnubEncryptedData UPubnubAesCryptor::ConvertToInterface(const FPubnubEncryptedDataInternal& InternalData)
 {
     FPubnubEncryptedData Result;
@@ -0,0 +1,78 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Crypto/PubnubCipherContextCache.h"
+#include <atomic>
+
+// OpenSSL includes
+#define UI UI_ST
+THIRD_PARTY_INCLUDES_START
+#include <openssl/evp.h>
+THIRD_PARTY_INCLUDES_END
+
+
+namespace
+{
+	struct FThreadCipherContexts
+	{
+		//Index 0 is used for encryption, index 1 for decryption
+		EVP_CIPHER_CTX* Contexts[2] = {nullptr, nullptr};
+		uint64 KeyGenerations[2] = {0, 0};
+
+		~FThreadCipherContexts()
+		{
+			for(EVP_CIPHER_CTX* Context : Contexts)
+			{
+				if(Context)
+				{
+					EVP_CIPHER_CTX_free(Context);
+				}
+			}
+		}
+	};
+
+	thread_local FThreadCipherContexts ThreadCipherContexts;
+	std::atomic<uint64> LastKeyGeneration{0};
+}
+
+uint64 PubnubCipherContextCache::NextKeyGeneration()
+{
+	return LastKeyGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+evp_cipher_ctx_st* PubnubCipherContextCache::AcquireAes256CbcContext(bool bEncrypt, const uint8* Key, uint64 KeyGeneration, const uint8* IV)
+{
+	const int32 Index = bEncrypt ? 0 : 1;
+	EVP_CIPHER_CTX*& Context = ThreadCipherContexts.Contexts[Index];
+	uint64& ContextKeyGeneration = ThreadCipherContexts.KeyGenerations[Index];
+
+	if(!Context)
+	{
+		Context = EVP_CIPHER_CTX_new();
+		if(!Context)
+		{
+			return nullptr;
+		}
+		ContextKeyGeneration = 0;
+	}
+
+	int InitResult = 0;
+	if(KeyGeneration != 0 && KeyGeneration == ContextKeyGeneration)
+	{
+		//Cipher and key are kept from the previous init, this only sets the IV and resets the padding state
+		InitResult = EVP_CipherInit_ex(Context, nullptr, nullptr, nullptr, IV, bEncrypt ? 1 : 0);
+	}
+	else
+	{
+		InitResult = EVP_CipherInit_ex(Context, EVP_aes_256_cbc(), nullptr, Key, IV, bEncrypt ? 1 : 0);
+	}
+
+	if(InitResult != 1)
+	{
+		//Don't trust a context that failed to init, next call sets the key again
+		ContextKeyGeneration = 0;
+		return nullptr;
+	}
+
+	ContextKeyGeneration = KeyGeneration;
+	return Context;
+}
@@ -0,0 +1,29 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct evp_cipher_ctx_st;
+
+/**
+ * AES-256-CBC contexts shared by all cryptors that run on the same thread.
+ *
+ * Every thread owns one encryption and one decryption context, created on first use and freed when the thread exits.
+ * A context remembers the generation of the key it was last initialized with. While messages keep coming with
+ * the same key only the IV is set, so the key schedule is expanded once per key instead of once per message.
+ */
+namespace PubnubCipherContextCache
+{
+	static constexpr int32 KeySize = 32;
+
+	//Returns process-wide unique generation for a new cipher key. 0 is never returned and means "no key"
+	uint64 NextKeyGeneration();
+
+	/**
+	 * Returns context of the calling thread that is ready to encrypt (or decrypt) a new message with given key and IV.
+	 * Key is only read when it differs from the one the context was initialized with. Returns nullptr on failure.
+	 * Context has to be used right away, before anything else on this thread acquires it again.
+	 */
+	evp_cipher_ctx_st* AcquireAes256CbcContext(bool bEncrypt, const uint8* Key, uint64 KeyGeneration, const uint8* IV);
+}
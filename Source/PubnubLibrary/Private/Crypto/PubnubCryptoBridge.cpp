@@ -44,18 +44,21 @@ pubnub_bymebl_t UPubnubCryptoBridge::CCoreProviderEncrypt(const pubnub_crypto_pr
         return out;
     }
 
-    // Convert to FString
-    const FString PlainText = UPubnubCryptoUtilities::ConvertBytesToString(to_encrypt.ptr, to_encrypt.size);
-
-    //Call ProviderEncrypt from IPubnubCryptoProviderInterface
-    const FString EncryptedText = IPubnubCryptoProviderInterface::Execute_ProviderEncrypt(Self->CryptoModule.GetObject(), PlainText);
+    //Call provider on raw bytes. Blueprint providers are still reached through ProviderEncrypt
+    static thread_local TArray<uint8> EncryptedBytes;
+    const TConstArrayView<uint8> PlainBytes(to_encrypt.ptr, static_cast<int32>(to_encrypt.size));
+    if (!IPubnubCryptoProviderInterface::ProviderEncryptBytes(Self->CryptoModule.GetObject(), PlainBytes, EncryptedBytes))
+    {
+        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderEncrypt]: ProviderEncrypt failed."));
+        return out;
+    }
 
-    // Back to bytes
+    // C-Core frees the result, so it has to be malloc'd
     uint8* bytes = nullptr;
     size_t sz = 0;
-    if (!UPubnubCryptoUtilities::Base64Decode(EncryptedText, bytes, sz))
+    if (!UPubnubCryptoUtilities::CopyBytesForCCore(EncryptedBytes, bytes, sz))
     {
-        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderEncrypt]: Decode to Base64 failed"));
+        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderEncrypt]: Failed to allocate encrypted data."));
         return out;
     }
     
@@ -83,28 +86,22 @@ pubnub_bymebl_t UPubnubCryptoBridge::CCoreProviderDecrypt(const pubnub_crypto_pr
         return out;
     }
 
-    // Convert bytes to Base64 (header + ciphertext)
-    const FString B64 = UPubnubCryptoUtilities::Base64Encode(to_decrypt.ptr, to_decrypt.size);
-    if (B64.IsEmpty())
-    {
-        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderDecrypt]: Base64 encode failed."));
-        return out;
-    }
-
-    // Call ProviderDecrypt from IPubnubCryptoProviderInterface
-    const FString Plain = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(Self->CryptoModule.GetObject(), B64);
-    if (Plain.IsEmpty())
+    // Decrypt header + ciphertext as they came from C-Core. Native module works on the bytes directly,
+    // plaintext stays UTF-8 and is converted to FString only once, when the message is delivered
+    static thread_local TArray<uint8> PlainBytes;
+    const TConstArrayView<uint8> EncryptedBytes(to_decrypt.ptr, static_cast<int32>(to_decrypt.size));
+    if (!IPubnubCryptoProviderInterface::ProviderDecryptBytes(Self->CryptoModule.GetObject(), EncryptedBytes, PlainBytes) || PlainBytes.Num() == 0)
     {
         UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderDecrypt]: ProviderDecrypt returned empty plaintext."));
         return out;
     }
 
-    // Convert plaintext (UTF-8) back to bytes
+    // C-Core frees the result, so it has to be malloc'd
     uint8* bytes = nullptr;
     size_t sz = 0;
-    if (!UPubnubCryptoUtilities::ConvertStringToBytes(Plain, bytes, sz))
+    if (!UPubnubCryptoUtilities::CopyBytesForCCore(PlainBytes, bytes, sz))
     {
-        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderDecrypt]: ConvertStringToBytes failed."));
+        UE_LOG(PubnubLog, Error, TEXT("[CCoreProviderDecrypt]: Failed to allocate decrypted data."));
         return out;
     }
 
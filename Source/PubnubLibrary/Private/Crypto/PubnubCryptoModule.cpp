@@ -24,25 +24,80 @@ void UPubnubCryptoModule::InitCryptoModule(const TScriptInterface<IPubnubCryptor
         }
         AdditionalCryptors.Add(InAdditionalCryptors[i]);
     }
+
+    ResolveCryptors();
+}
+
+void UPubnubCryptoModule::ResolveCryptors()
+{
+    bool bHasValidId = false;
+    ResolvedDefaultCryptor = ResolveCryptor(DefaultCryptor, bHasValidId);
+
+    CryptorsById.Reset();
+    if (ResolvedDefaultCryptor.Object && bHasValidId) {
+        CryptorsById.Add(ResolvedDefaultCryptor);
+    }
+    for (const TScriptInterface<IPubnubCryptorInterface>& C : AdditionalCryptors) {
+        const FResolvedCryptor Resolved = ResolveCryptor(C, bHasValidId);
+        // Only cryptors with exactly 4-byte identifier can be selected, first one with given identifier wins
+        if (!Resolved.Object || !bHasValidId) continue;
+        if (CryptorsById.ContainsByPredicate([&Resolved](const FResolvedCryptor& Existing) { return Existing.Id == Resolved.Id; })) continue;
+        CryptorsById.Add(Resolved);
+    }
+}
+
+UPubnubCryptoModule::FResolvedCryptor UPubnubCryptoModule::ResolveCryptor(const TScriptInterface<IPubnubCryptorInterface>& Cryptor, bool& bOutHasValidId)
+{
+    FResolvedCryptor Resolved;
+    bOutHasValidId = false;
+    UObject* CryptorObject = Cryptor.GetObject();
+    if (!CryptorObject) return Resolved;
+
+    Resolved.Object = CryptorObject;
+    if (CryptorObject->GetClass()->HasAnyClassFlags(CLASS_Native)) {
+        Resolved.NativeInterface = Cast<IPubnubCryptorInterface>(CryptorObject);
+    }
+
+    const TArray<uint8> id = IPubnubCryptorInterface::Execute_GetIdentifier(CryptorObject);
+    if (id.Num() >= 4) {
+        Resolved.Id = PackIdentifier(id.GetData());
+    }
+    bOutHasValidId = id.Num() == 4;
+    return Resolved;
+}
+
+uint32 UPubnubCryptoModule::PackIdentifier(const uint8 Ident[4])
+{
+    uint32 Packed = 0;
+    FMemory::Memcpy(&Packed, Ident, IdentLen);
+    return Packed;
+}
+
+bool UPubnubCryptoModule::FResolvedCryptor::EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata) const
+{
+    return NativeInterface ? NativeInterface->EncryptBytes(Data, OutEncryptedData, OutMetadata)
+        : IPubnubCryptorInterface::EncryptBytes(Object, Data, OutEncryptedData, OutMetadata);
+}
+
+bool UPubnubCryptoModule::FResolvedCryptor::DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData) const
+{
+    return NativeInterface ? NativeInterface->DecryptBytes(EncryptedData, Metadata, OutData)
+        : IPubnubCryptorInterface::DecryptBytes(Object, EncryptedData, Metadata, OutData);
 }
 
 FString UPubnubCryptoModule::ProviderEncrypt_Implementation(const FString& Data)
 {
     // Convert to UTF-8 bytes
-    TArray<uint8> PlainBytes;
+    FTCHARToUTF8 UTF8Data(*Data);
+    if (UTF8Data.Length() == 0)
     {
-        uint8* tmp=nullptr; size_t sz=0;
-        if (!UPubnubCryptoUtilities::ConvertStringToBytes(Data, tmp, sz))
-        {
-            UE_LOG(PubnubLog, Error, TEXT("[ProviderEncrypt_Implementation]: Conversion to bytes failed."));
-            return FString();
-        }
-        PlainBytes.Append(tmp, sz); free(tmp);
+        UE_LOG(PubnubLog, Error, TEXT("[ProviderEncrypt_Implementation]: Conversion to bytes failed."));
+        return FString();
     }
 
     // Call actual encryption logic
     TArray<uint8> Encoded;
-    if (!ProviderEncrypt_Internal(this, PlainBytes, Encoded))
+    if (!ProviderEncryptBytes(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(UTF8Data.Get()), UTF8Data.Length()), Encoded))
     {
         UE_LOG(PubnubLog, Error, TEXT("[ProviderEncrypt_Implementation]: Internal encryption failed."));
         return FString();
@@ -55,19 +110,15 @@ FString UPubnubCryptoModule::ProviderDecrypt_Implementation(const FString& Data)
 {
     // Decode Base64 to bytes
     TArray<uint8> InBytes;
+    if (Data.IsEmpty() || !UPubnubCryptoUtilities::Base64Decode(Data, InBytes))
     {
-        uint8* tmp=nullptr; size_t sz=0;
-        if (!UPubnubCryptoUtilities::Base64Decode(Data, tmp, sz))
-        {
-            UE_LOG(PubnubLog, Error, TEXT("[ProviderDecrypt_Implementation]: Base64 Decoding failed"));
-            return FString();
-        }
-        InBytes.Append(tmp, sz); free(tmp);
+        UE_LOG(PubnubLog, Error, TEXT("[ProviderDecrypt_Implementation]: Base64 Decoding failed"));
+        return FString();
     }
 
     // Call actual decryption logic
     TArray<uint8> PlainBytes;
-    if (!ProviderDecrypt_Internal(this, InBytes, PlainBytes))
+    if (!ProviderDecryptBytes(InBytes, PlainBytes))
     {
         UE_LOG(PubnubLog, Error, TEXT("[ProviderDecrypt_Implementation]: Internal Decryption failed"));
         return FString();
@@ -77,27 +128,40 @@ FString UPubnubCryptoModule::ProviderDecrypt_Implementation(const FString& Data)
     return UPubnubCryptoUtilities::ConvertBytesToString(PlainBytes.GetData(), PlainBytes.Num());
 }
 
+bool UPubnubCryptoModule::ProviderEncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData)
+{
+    return ProviderEncrypt_Internal(this, Data, OutEncryptedData);
+}
+
+bool UPubnubCryptoModule::ProviderDecryptBytes(TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData)
+{
+    return ProviderDecrypt_Internal(this, EncryptedData, OutData);
+}
+
+bool UPubnubCryptoModule::IsThreadSafe() const
+{
+    auto IsCryptorThreadSafe = [](const FResolvedCryptor& C) { return C.NativeInterface && C.NativeInterface->IsThreadSafe(); };
+    if (!ResolvedDefaultCryptor.Object || !IsCryptorThreadSafe(ResolvedDefaultCryptor)) return false;
+    for (const FResolvedCryptor& C : CryptorsById) {
+        if (!IsCryptorThreadSafe(C)) return false;
+    }
+    return true;
+}
+
 bool UPubnubCryptoModule::IdEquals(const uint8 a[4], const uint8 b[4]) {
     return 0 == FMemory::Memcmp(a, b, IdentLen);
 }
 
 // Select UE cryptor by identifier
-TScriptInterface<IPubnubCryptorInterface> UPubnubCryptoModule::FindUECryptorById(const uint8 ident[4]) const
+const UPubnubCryptoModule::FResolvedCryptor* UPubnubCryptoModule::FindUECryptorById(const uint8 ident[4]) const
 {
-    if (DefaultCryptor && DefaultCryptor.GetObject()) {
-        const TArray<uint8> id = IPubnubCryptorInterface::Execute_GetIdentifier(DefaultCryptor.GetObject());
-        if (id.Num() == 4 && 0 == FMemory::Memcmp(id.GetData(), ident, 4)) {
-            return DefaultCryptor;
-        }
-    }
-    for (const auto& C : AdditionalCryptors) {
-        if (!C || !C.GetObject()) continue;
-        const TArray<uint8> id = IPubnubCryptorInterface::Execute_GetIdentifier(C.GetObject());
-        if (id.Num() == 4 && 0 == FMemory::Memcmp(id.GetData(), ident, 4)) {
-            return C;
+    const uint32 Id = PackIdentifier(ident);
+    for (const FResolvedCryptor& C : CryptorsById) {
+        if (C.Id == Id) {
+            return &C;
         }
     }
-    return TScriptInterface<IPubnubCryptorInterface>();
+    return nullptr;
 }
 
 // Build header size from metadata size
@@ -180,42 +244,34 @@ bool UPubnubCryptoModule::ParseHeader(const uint8* buf, size_t bufSize, uint8 ou
     return true;
 }
 
-bool UPubnubCryptoModule::ProviderEncrypt_Internal(UPubnubCryptoModule* Self, const TArray<uint8>& PlainUTF8, TArray<uint8>& OutHeaderPlusCipher)
+bool UPubnubCryptoModule::ProviderEncrypt_Internal(UPubnubCryptoModule* Self, TConstArrayView<uint8> PlainUTF8, TArray<uint8>& OutHeaderPlusCipher)
 {
     OutHeaderPlusCipher.Reset();
-    if (!Self || !Self->DefaultCryptor || !Self->DefaultCryptor.GetObject()) return false;
+    if (!Self || !Self->ResolvedDefaultCryptor.Object || PlainUTF8.Num() == 0) return false;
 
-    // 1) Call UE cryptor Encrypt
-    const FString Plain = UPubnubCryptoUtilities::ConvertBytesToString(PlainUTF8.GetData(), PlainUTF8.Num());
-    const FPubnubEncryptedData UEEnc = IPubnubCryptorInterface::Execute_Encrypt(Self->DefaultCryptor.GetObject(), Plain);
-    if (UEEnc.EncryptedData.IsEmpty()) return false;
+    // 1) Call UE cryptor on raw bytes. Reused buffers, so steady-state encryption doesn't allocate them for every message
+    static thread_local TArray<uint8> Cipher;
+    static thread_local TArray<uint8> Meta;
+    if (!Self->ResolvedDefaultCryptor.EncryptBytes(PlainUTF8, Cipher, Meta) || Cipher.Num() == 0) return false;
 
-    // 2) Determine identifier and metadata
-    const TArray<uint8> identArr = IPubnubCryptorInterface::Execute_GetIdentifier(Self->DefaultCryptor.GetObject());
-    uint8 ident[4] = {0,0,0,0};
-    if (identArr.Num() >= 4) { FMemory::Memcpy(ident, identArr.GetData(), 4); }
+    // 2) Identifier was resolved in InitCryptoModule
+    uint8 ident[4];
+    FMemory::Memcpy(ident, &Self->ResolvedDefaultCryptor.Id, IdentLen);
     const bool isLegacy = IdEquals(ident, LegacyId);
-
-    // Decode metadata and ciphertext
-    TArray<uint8> Meta; TArray<uint8> Cipher;
-    if (!isLegacy && !UEEnc.Metadata.IsEmpty()) {
-        uint8* m=nullptr; size_t ms=0; if (UPubnubCryptoUtilities::Base64Decode(UEEnc.Metadata, m, ms)) { Meta.Append(m, ms); free(m);} }
-    {
-        uint8* c=nullptr; size_t cs=0; if (!UPubnubCryptoUtilities::Base64Decode(UEEnc.EncryptedData, c, cs)) return false; Cipher.Append(c, cs); free(c);
-    }
+    const int32 metaSize = isLegacy ? 0 : Meta.Num();
 
     // 3) Build header + ciphertext
-    const size_t headerSize = isLegacy ? 0 : ComputeHeaderSize(Meta.Num());
-    OutHeaderPlusCipher.SetNum(headerSize + Cipher.Num());
+    const size_t headerSize = isLegacy ? 0 : ComputeHeaderSize(metaSize);
+    OutHeaderPlusCipher.SetNumUninitialized(headerSize + Cipher.Num());
     if (headerSize > 0) {
-        const size_t metaOffset = WriteHeader(OutHeaderPlusCipher.GetData(), headerSize, ident, Meta.Num());
-        if (Meta.Num() > 0) { FMemory::Memcpy(OutHeaderPlusCipher.GetData() + metaOffset, Meta.GetData(), Meta.Num()); }
+        const size_t metaOffset = WriteHeader(OutHeaderPlusCipher.GetData(), headerSize, ident, metaSize);
+        if (metaSize > 0) { FMemory::Memcpy(OutHeaderPlusCipher.GetData() + metaOffset, Meta.GetData(), metaSize); }
     }
     FMemory::Memcpy(OutHeaderPlusCipher.GetData() + headerSize, Cipher.GetData(), Cipher.Num());
     return true;
 }
 
-bool UPubnubCryptoModule::ProviderDecrypt_Internal(UPubnubCryptoModule* Self, const TArray<uint8>& InHeaderPlusCipher, TArray<uint8>& OutPlainUTF8)
+bool UPubnubCryptoModule::ProviderDecrypt_Internal(UPubnubCryptoModule* Self, TConstArrayView<uint8> InHeaderPlusCipher, TArray<uint8>& OutPlainUTF8)
 {
     OutPlainUTF8.Reset();
     if (!Self || InHeaderPlusCipher.Num() == 0) return false;
@@ -226,21 +282,14 @@ bool UPubnubCryptoModule::ProviderDecrypt_Internal(UPubnubCryptoModule* Self, co
     if (!hasHeader) { FMemory::Memcpy(ident, LegacyId, IdentLen); }
 
     // 2) Select UE cryptor by identifier
-    const TScriptInterface<IPubnubCryptorInterface> Cryptor = Self->FindUECryptorById(ident);
-    if (!Cryptor || !Cryptor.GetObject()) {
+    const FResolvedCryptor* Cryptor = Self->FindUECryptorById(ident);
+    if (!Cryptor) {
         return false;
     }
 
-    // 3) Build UE data struct and call UE Decrypt
-    FPubnubEncryptedData UEData;
-    UEData.EncryptedData = UPubnubCryptoUtilities::Base64Encode(InHeaderPlusCipher.GetData()+headerSize, InHeaderPlusCipher.Num()-headerSize);
-    if (hasHeader && metaSize > 0) {
-        UEData.Metadata = UPubnubCryptoUtilities::Base64Encode(InHeaderPlusCipher.GetData()+metaOffset, metaSize);
-    }
-    const FString Plain = IPubnubCryptorInterface::Execute_Decrypt(Cryptor.GetObject(), UEData);
-    if (Plain.IsEmpty()) return false;
-
-    // UTF-8 back to bytes
-    uint8* tmp=nullptr; size_t sz=0; if (!UPubnubCryptoUtilities::ConvertStringToBytes(Plain, tmp, sz)) return false;
-    OutPlainUTF8.Append(tmp, sz); free(tmp); return true;
-}
+    // 3) Decrypt straight from the received buffer, ciphertext and metadata are only views into it
+    const TConstArrayView<uint8> Cipher = InHeaderPlusCipher.RightChop(static_cast<int32>(headerSize));
+    const TConstArrayView<uint8> Meta = hasHeader && metaSize > 0 ? InHeaderPlusCipher.Slice(static_cast<int32>(metaOffset), static_cast<int32>(metaSize)) : TConstArrayView<uint8>();
+    if (Cipher.Num() == 0) return false;
+    return Cryptor->DecryptBytes(Cipher, Meta, OutPlainUTF8) && OutPlainUTF8.Num() > 0;
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Crypto/PubnubCryptorInterface.h"
+#include "FunctionLibraries/PubnubCryptoUtilities.h"
+
+
+namespace
+{
+	//Blueprint classes (also the ones derived from our C++ cryptors) may override the events, so only native classes use the byte API directly
+	template<typename InterfaceType>
+	InterfaceType* GetNativeInterface(UObject* Object)
+	{
+		if(!Object || !Object->GetClass()->HasAnyClassFlags(CLASS_Native))
+		{
+			return nullptr;
+		}
+		return Cast<InterfaceType>(Object);
+	}
+
+	void CopyStringAsUTF8(const FString& String, TArray<uint8>& OutBytes)
+	{
+		FTCHARToUTF8 UTF8String(*String);
+		OutBytes.Reset(UTF8String.Length());
+		OutBytes.Append(reinterpret_cast<const uint8*>(UTF8String.Get()), UTF8String.Length());
+	}
+
+	//Byte API on top of the FString events, used for Blueprint cryptors and native ones that don't override it
+	bool EncryptBytesThroughEvent(UObject* Cryptor, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata)
+	{
+		OutEncryptedData.Reset();
+		OutMetadata.Reset();
+		if(!Cryptor)
+		{
+			return false;
+		}
+
+		const FString Plain = UPubnubCryptoUtilities::ConvertBytesToString(Data.GetData(), Data.Num());
+		const FPubnubEncryptedData Encrypted = IPubnubCryptorInterface::Execute_Encrypt(Cryptor, Plain);
+		if(Encrypted.EncryptedData.IsEmpty() || !UPubnubCryptoUtilities::Base64Decode(Encrypted.EncryptedData, OutEncryptedData))
+		{
+			return false;
+		}
+		return Encrypted.Metadata.IsEmpty() || UPubnubCryptoUtilities::Base64Decode(Encrypted.Metadata, OutMetadata);
+	}
+
+	bool DecryptBytesThroughEvent(UObject* Cryptor, TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData)
+	{
+		OutData.Reset();
+		if(!Cryptor)
+		{
+			return false;
+		}
+
+		FPubnubEncryptedData Encrypted;
+		Encrypted.EncryptedData = UPubnubCryptoUtilities::Base64Encode(EncryptedData.GetData(), EncryptedData.Num());
+		Encrypted.Metadata = UPubnubCryptoUtilities::Base64Encode(Metadata.GetData(), Metadata.Num());
+		const FString Plain = IPubnubCryptorInterface::Execute_Decrypt(Cryptor, Encrypted);
+		if(Plain.IsEmpty())
+		{
+			return false;
+		}
+		CopyStringAsUTF8(Plain, OutData);
+		return true;
+	}
+
+	bool ProviderEncryptBytesThroughEvent(UObject* Provider, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData)
+	{
+		OutEncryptedData.Reset();
+		if(!Provider)
+		{
+			return false;
+		}
+
+		const FString Plain = UPubnubCryptoUtilities::ConvertBytesToString(Data.GetData(), Data.Num());
+		const FString Encrypted = IPubnubCryptoProviderInterface::Execute_ProviderEncrypt(Provider, Plain);
+		return !Encrypted.IsEmpty() && UPubnubCryptoUtilities::Base64Decode(Encrypted, OutEncryptedData);
+	}
+
+	bool ProviderDecryptBytesThroughEvent(UObject* Provider, TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData)
+	{
+		OutData.Reset();
+		if(!Provider)
+		{
+			return false;
+		}
+
+		const FString Encrypted = UPubnubCryptoUtilities::Base64Encode(EncryptedData.GetData(), EncryptedData.Num());
+		const FString Plain = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(Provider, Encrypted);
+		if(Plain.IsEmpty())
+		{
+			return false;
+		}
+		CopyStringAsUTF8(Plain, OutData);
+		return true;
+	}
+}
+
+bool IPubnubCryptorInterface::EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata)
+{
+	return EncryptBytesThroughEvent(_getUObject(), Data, OutEncryptedData, OutMetadata);
+}
+
+bool IPubnubCryptorInterface::DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData)
+{
+	return DecryptBytesThroughEvent(_getUObject(), EncryptedData, Metadata, OutData);
+}
+
+bool IPubnubCryptorInterface::EncryptBytes(UObject* Cryptor, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata)
+{
+	if(IPubnubCryptorInterface* NativeCryptor = GetNativeInterface<IPubnubCryptorInterface>(Cryptor))
+	{
+		return NativeCryptor->EncryptBytes(Data, OutEncryptedData, OutMetadata);
+	}
+	return EncryptBytesThroughEvent(Cryptor, Data, OutEncryptedData, OutMetadata);
+}
+
+bool IPubnubCryptorInterface::DecryptBytes(UObject* Cryptor, TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData)
+{
+	if(IPubnubCryptorInterface* NativeCryptor = GetNativeInterface<IPubnubCryptorInterface>(Cryptor))
+	{
+		return NativeCryptor->DecryptBytes(EncryptedData, Metadata, OutData);
+	}
+	return DecryptBytesThroughEvent(Cryptor, EncryptedData, Metadata, OutData);
+}
+
+bool IPubnubCryptoProviderInterface::ProviderEncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData)
+{
+	return ProviderEncryptBytesThroughEvent(_getUObject(), Data, OutEncryptedData);
+}
+
+bool IPubnubCryptoProviderInterface::ProviderDecryptBytes(TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData)
+{
+	return ProviderDecryptBytesThroughEvent(_getUObject(), EncryptedData, OutData);
+}
+
+bool IPubnubCryptoProviderInterface::IsThreadSafe(UObject* Provider)
+{
+	const IPubnubCryptoProviderInterface* NativeProvider = GetNativeInterface<IPubnubCryptoProviderInterface>(Provider);
+	return NativeProvider && NativeProvider->IsThreadSafe();
+}
+
+bool IPubnubCryptoProviderInterface::ProviderEncryptBytes(UObject* Provider, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData)
+{
+	if(IPubnubCryptoProviderInterface* NativeProvider = GetNativeInterface<IPubnubCryptoProviderInterface>(Provider))
+	{
+		return NativeProvider->ProviderEncryptBytes(Data, OutEncryptedData);
+	}
+	return ProviderEncryptBytesThroughEvent(Provider, Data, OutEncryptedData);
+}
+
+bool IPubnubCryptoProviderInterface::ProviderDecryptBytes(UObject* Provider, TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData)
+{
+	if(IPubnubCryptoProviderInterface* NativeProvider = GetNativeInterface<IPubnubCryptoProviderInterface>(Provider))
+	{
+		return NativeProvider->ProviderDecryptBytes(EncryptedData, OutData);
+	}
+	return ProviderDecryptBytesThroughEvent(Provider, EncryptedData, OutData);
+}
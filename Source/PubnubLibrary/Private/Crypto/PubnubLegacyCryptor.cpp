@@ -1,6 +1,7 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "Crypto/PubnubLegacyCryptor.h"
+#include "Crypto/PubnubCipherContextCache.h"
 #include "PubnubSubsystem.h"
 #include "FunctionLibraries/PubnubCryptoUtilities.h"
 
@@ -13,6 +14,17 @@ THIRD_PARTY_INCLUDES_START
 #include <openssl/rand.h>
 THIRD_PARTY_INCLUDES_END
 
+void UPubnubLegacyCryptor::SetCipherKey(const FString& NewCipherKey)
+{
+    uint8 NewLegacyKey[32];
+    MakeLegacyKeyAsciiHex32(NewCipherKey, NewLegacyKey);
+
+    FRWScopeLock WriteLock(LegacyKeyLock, SLT_Write);
+    CipherKey = NewCipherKey;
+    FMemory::Memcpy(LegacyKey, NewLegacyKey, 32);
+    KeyGeneration = NewCipherKey.IsEmpty() ? 0 : PubnubCipherContextCache::NextKeyGeneration();
+}
+
 // Identifier is legacy: zeros (matches PUBNUB_LEGACY_CRYPTO_IDENTIFIER)
 TArray<uint8> UPubnubLegacyCryptor::GetIdentifier_Implementation()
 {
@@ -21,21 +33,14 @@ TArray<uint8> UPubnubLegacyCryptor::GetIdentifier_Implementation()
 
 FPubnubEncryptedData UPubnubLegacyCryptor::Encrypt_Implementation(const FString& Data)
 {
-    if(CipherKey.IsEmpty())
-    {
-        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't encrypt data. Use SetCipherKey before encrypting/decrypting data"));
-        return FPubnubEncryptedData();
-    }
-    
     // Convert input text to UTF-8 bytes
     FTCHARToUTF8 UTF8Data(*Data);
-    TArray<uint8> PlainDataBytes;
-    PlainDataBytes.Append(reinterpret_cast<const uint8*>(UTF8Data.Get()), UTF8Data.Length());
 
     // Encrypt
     TArray<uint8> EncryptedDataBytes;
+    TArray<uint8> Metadata;
     FPubnubEncryptedData Out;
-    if (!EncryptDataLegacy(PlainDataBytes, EncryptedDataBytes)) {
+    if (!EncryptBytes(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(UTF8Data.Get()), UTF8Data.Length()), EncryptedDataBytes, Metadata)) {
         return Out;
     }
     
@@ -46,12 +51,6 @@ FPubnubEncryptedData UPubnubLegacyCryptor::Encrypt_Implementation(const FString&
 
 FString UPubnubLegacyCryptor::Decrypt_Implementation(const FPubnubEncryptedData& Data)
 {
-    if(CipherKey.IsEmpty())
-    {
-        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't decrypt data. Use SetCipherKey before encrypting/decrypting data"));
-        return "";
-    }
-    
     // Decode Base64
     TArray<uint8> Cipher;
     if (!UPubnubCryptoUtilities::Base64Decode(Data.EncryptedData, Cipher)) {
@@ -60,19 +59,43 @@ FString UPubnubLegacyCryptor::Decrypt_Implementation(const FPubnubEncryptedData&
 
     // Decrypt
     TArray<uint8> Plain;
-    if (!DecryptDataLegacy(Cipher, Plain)) {
+    if (!DecryptBytes(Cipher, TConstArrayView<uint8>(), Plain)) {
         return FString();
     }
 
-    // Ensure null-terminated to safely construct FString
-    Plain.Add(0);
-    return FString(UTF8_TO_TCHAR(reinterpret_cast<const char*>(Plain.GetData())));
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Plain.GetData()), Plain.Num());
+    return FString(Converter.Length(), Converter.Get());
+}
+
+bool UPubnubLegacyCryptor::EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata)
+{
+    // Legacy format has no metadata, random IV (if used) is part of the ciphertext
+    OutMetadata.Reset();
+    if(CipherKey.IsEmpty())
+    {
+        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't encrypt data. Use SetCipherKey before encrypting/decrypting data"));
+        OutEncryptedData.Reset();
+        return false;
+    }
+    return EncryptDataLegacy(Data, OutEncryptedData);
+}
+
+bool UPubnubLegacyCryptor::DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData)
+{
+    if(CipherKey.IsEmpty())
+    {
+        UE_LOG(PubnubLog, Warning, TEXT("CipherKey is empty, can't decrypt data. Use SetCipherKey before encrypting/decrypting data"));
+        OutData.Reset();
+        return false;
+    }
+    return DecryptDataLegacy(EncryptedData, OutData);
 }
 
-bool UPubnubLegacyCryptor::EncryptDataLegacy(const TArray<uint8>& Plain, TArray<uint8>& OutCipher)
+bool UPubnubLegacyCryptor::EncryptDataLegacy(TConstArrayView<uint8> Plain, TArray<uint8>& OutCipher)
 {
-    // Key (ASCII-hex 32 from SHA256 first 16 bytes)
-    TArray<uint8_t> KeyAsciiHex; MakeLegacyKeyAsciiHex32(KeyAsciiHex);
+    // Key (ASCII-hex 32 from SHA256 first 16 bytes), derived once per cipher key
+    uint8 Key[32]; uint64 Generation = 0;
+    GetLegacyKey(Key, Generation);
 
     uint8 IV[16];
     if (UseRandomIV) {
@@ -81,46 +104,39 @@ bool UPubnubLegacyCryptor::EncryptDataLegacy(const TArray<uint8>& Plain, TArray<
         GetFixedIV16(IV);
     }
 
-    // Encrypt with IV
-    TArray<uint8> Cipher;
-    if (!Aes256CbcEncrypt(KeyAsciiHex, IV, Plain, Cipher)) return false;
-
-    // If random IV is used, prefix IV
+    // If random IV is used, prefix IV. Ciphertext is written right after it
+    OutCipher.Reset();
     if (UseRandomIV) {
-        OutCipher.Reset();
         OutCipher.Append(IV, 16);
-        OutCipher.Append(Cipher);
-    } else {
-        OutCipher = MoveTemp(Cipher);
     }
-    return true;
+    return Aes256CbcEncrypt(Key, Generation, IV, Plain, OutCipher);
 }
 
-bool UPubnubLegacyCryptor::DecryptDataLegacy(const TArray<uint8>& Cipher, TArray<uint8>& OutPlain)
+bool UPubnubLegacyCryptor::DecryptDataLegacy(TConstArrayView<uint8> Cipher, TArray<uint8>& OutPlain)
 {
-    TArray<uint8_t> KeyAsciiHex; MakeLegacyKeyAsciiHex32(KeyAsciiHex);
+    uint8 Key[32]; uint64 Generation = 0;
+    GetLegacyKey(Key, Generation);
 
     if (UseRandomIV) {
         if (Cipher.Num() < 16) return false;
         const uint8* IV   = Cipher.GetData();
         const uint8* Data = Cipher.GetData() + 16;
         const int32  Len  = Cipher.Num() - 16;
-        return Aes256CbcDecrypt(KeyAsciiHex, IV, Data, Len, OutPlain);
+        return Aes256CbcDecrypt(Key, Generation, IV, Data, Len, OutPlain);
     } else {
         uint8 FixedIV[16]; GetFixedIV16(FixedIV);
-        return Aes256CbcDecrypt(KeyAsciiHex, FixedIV, Cipher.GetData(), Cipher.Num(), OutPlain);
+        return Aes256CbcDecrypt(Key, Generation, FixedIV, Cipher.GetData(), Cipher.Num(), OutPlain);
     }
 }
 
-void UPubnubLegacyCryptor::MakeLegacyKeyAsciiHex32(TArray<uint8_t>& OutKeyAsciiHex32) const
+void UPubnubLegacyCryptor::MakeLegacyKeyAsciiHex32(const FString& Key, uint8 OutKeyAsciiHex32[32])
 {
     // pbcc_cipher_key_hash: takes SHA256 of cipher_key string, then formats first 16 bytes as 32 ascii hex chars
-    FTCHARToUTF8 UTF8Key(*CipherKey);
+    FTCHARToUTF8 UTF8Key(*Key);
 
     uint8_t digest[32];
     SHA256(reinterpret_cast<const unsigned char*>(UTF8Key.Get()), UTF8Key.Length(), digest);
 
-    OutKeyAsciiHex32.SetNum(32);
     static const char* hex = "0123456789abcdef";
     for (int i = 0; i < 16; ++i) {
         OutKeyAsciiHex32[i*2 + 0] = static_cast<uint8_t>(hex[(digest[i] >> 4) & 0xF]);
@@ -128,18 +144,41 @@ void UPubnubLegacyCryptor::MakeLegacyKeyAsciiHex32(TArray<uint8_t>& OutKeyAsciiH
     }
 }
 
+void UPubnubLegacyCryptor::GetLegacyKey(uint8 OutKey[32], uint64& OutKeyGeneration)
+{
+    {
+        FRWScopeLock ReadLock(LegacyKeyLock, SLT_ReadOnly);
+        if (KeyGeneration != 0) {
+            FMemory::Memcpy(OutKey, LegacyKey, 32);
+            OutKeyGeneration = KeyGeneration;
+            return;
+        }
+    }
+
+    // CipherKey was set without SetCipherKey (e.g. by a derived class), derive the key once now
+    FRWScopeLock WriteLock(LegacyKeyLock, SLT_Write);
+    if (KeyGeneration == 0) {
+        MakeLegacyKeyAsciiHex32(CipherKey, LegacyKey);
+        KeyGeneration = PubnubCipherContextCache::NextKeyGeneration();
+    }
+    FMemory::Memcpy(OutKey, LegacyKey, 32);
+    OutKeyGeneration = KeyGeneration;
+}
+
 void UPubnubLegacyCryptor::GetFixedIV16(uint8 OutIV[16])
 {
     const char* kIV = "0123456789012345"; // exactly 16 bytes
     FMemory::Memcpy(OutIV, kIV, 16);
 }
 
-// AES-256-CBC encrypt: Key must be 32 bytes (ASCII-hex from legacy hash), IV must be 16 bytes
-bool UPubnubLegacyCryptor::Aes256CbcEncrypt(const TArray<uint8>& Key, const uint8* IV, const TArray<uint8>& In, TArray<uint8>& Out)
+// AES-256-CBC encrypt: Key must be 32 bytes (ASCII-hex from legacy hash), IV must be 16 bytes. Ciphertext is appended to Out.
+// Uses this thread's reusable context, which keeps the key schedule while the key generation stays the same.
+bool UPubnubLegacyCryptor::Aes256CbcEncrypt(const uint8* Key, uint64 InKeyGeneration, const uint8* IV, TConstArrayView<uint8> In, TArray<uint8>& Out)
 {
-    Out.SetNum(In.Num() + EVP_MAX_BLOCK_LENGTH);
+    const int32 Offset = Out.Num();
+    Out.SetNumUninitialized(Offset + In.Num() + EVP_MAX_BLOCK_LENGTH);
 
-    EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* Ctx = PubnubCipherContextCache::AcquireAes256CbcContext(true, Key, InKeyGeneration, IV);
     if (!Ctx) {
         Out.Empty();
         return false;
@@ -149,28 +188,23 @@ bool UPubnubLegacyCryptor::Aes256CbcEncrypt(const TArray<uint8>& Key, const uint
     bool ok = false;
 
     do {
-        if (EVP_EncryptInit_ex(Ctx, EVP_aes_256_cbc(), nullptr, Key.GetData(), IV) != 1) break;
-
-        if (EVP_EncryptUpdate(Ctx, Out.GetData(), &len, In.GetData(), In.Num()) != 1) break;
+        if (EVP_EncryptUpdate(Ctx, Out.GetData() + Offset, &len, In.GetData(), In.Num()) != 1) break;
 
         int written = len;
-        if (EVP_EncryptFinal_ex(Ctx, Out.GetData() + written, &len) != 1) break;
+        if (EVP_EncryptFinal_ex(Ctx, Out.GetData() + Offset + written, &len) != 1) break;
 
-        Out.SetNum(written + len);
+        Out.SetNum(Offset + written + len);
         ok = true;
     } while (false);
 
-    EVP_CIPHER_CTX_free(Ctx);
     if (!ok) { Out.Empty(); }
     return ok;
 }
 
 // AES-256-CBC decrypt: Key must be 32 bytes (ASCII-hex from legacy hash), IV must be 16 bytes
-bool UPubnubLegacyCryptor::Aes256CbcDecrypt(const TArray<uint8>& Key, const uint8* IV, const uint8* Data, int32 DataLen, TArray<uint8>& Out)
+bool UPubnubLegacyCryptor::Aes256CbcDecrypt(const uint8* Key, uint64 InKeyGeneration, const uint8* IV, const uint8* Data, int32 DataLen, TArray<uint8>& Out)
 {
-    Out.SetNum(DataLen + EVP_MAX_BLOCK_LENGTH);
-
-    EVP_CIPHER_CTX* Ctx = EVP_CIPHER_CTX_new();
+    EVP_CIPHER_CTX* Ctx = PubnubCipherContextCache::AcquireAes256CbcContext(false, Key, InKeyGeneration, IV);
     if (!Ctx) {
         Out.Empty();
         return false;
@@ -179,11 +213,10 @@ bool UPubnubLegacyCryptor::Aes256CbcDecrypt(const TArray<uint8>& Key, const uint
     int len = 0;
     bool ok = false;
 
-    Out.SetNumUninitialized(DataLen);
+    //EVP_DecryptUpdate may need one extra block of space
+    Out.SetNumUninitialized(DataLen + EVP_MAX_BLOCK_LENGTH);
 
     do {
-        if (EVP_DecryptInit_ex(Ctx, EVP_aes_256_cbc(), nullptr, Key.GetData(), IV) != 1) break;
-
         if (EVP_DecryptUpdate(Ctx, Out.GetData(), &len, Data, DataLen) != 1) break;
         int written = len;
 
@@ -193,7 +226,6 @@ bool UPubnubLegacyCryptor::Aes256CbcDecrypt(const TArray<uint8>& Key, const uint
         ok = true;
     } while (false);
 
-    EVP_CIPHER_CTX_free(Ctx);
     if (!ok) { Out.Empty(); }
     return ok;
 }
\ No newline at end of file
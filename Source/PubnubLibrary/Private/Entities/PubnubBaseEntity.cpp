@@ -14,6 +14,13 @@ UPubnubSubscription* UPubnubBaseEntity::CreateSubscription(FPubnubSubscribeSetti
 		return nullptr;
 	}
 
+	//Released subscription of the same entity is already set up, only its delegates have to be bound again
+	if(UPubnubSubscription* PooledSubscription = PubnubClient->TakePooledSubscription(EntityID, EntityType, SubscribeSettings.ReceivePresenceEvents))
+	{
+		PooledSubscription->FilterExpression = SubscribeSettings.FilterExpression;
+		return PooledSubscription;
+	}
+
 	UPubnubSubscription* Subscription = UPubnubInternalUtilities::SafeNewObject<UPubnubSubscription>(this);
 
 	Subscription->InitSubscription(PubnubClient, this, SubscribeSettings);
@@ -0,0 +1,74 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Entities/PubnubCCoreEntityCache.h"
+#include "FunctionLibraries/PubnubInternalUtilities.h"
+#include "Misc/ScopeLock.h"
+
+
+FPubnubCCoreEntityCache::FPubnubCCoreEntityCache(int32 InCapacity)
+	: Capacity(FMath::Max(InCapacity, 0))
+{
+}
+
+FPubnubCCoreEntityCache::~FPubnubCCoreEntityCache()
+{
+	FreeEntities();
+}
+
+pubnub_subscription_t* FPubnubCCoreEntityCache::AllocSubscription(pubnub_t* Context, const FString& EntityID, EPubnubEntityType EntityType, const pubnub_subscription_options_t& Options)
+{
+	FScopeLock Lock(&Mutex);
+
+	//Entities of another context can't be used, the cache starts over for the new one
+	if(Context != EntitiesContext)
+	{
+		FreeEntities();
+		EntitiesContext = Context;
+	}
+
+	const FEntityKey Key(EntityType, EntityID);
+	if(pubnub_entity_t** CachedEntity = Entities.Find(Key))
+	{
+		return pubnub_subscription_alloc(*CachedEntity, &Options);
+	}
+
+	pubnub_entity_t* Entity = UPubnubInternalUtilities::EEAllocEntity(Context, EntityID, EntityType);
+	if(!Entity)
+	{
+		return nullptr;
+	}
+	pubnub_subscription_t* Subscription = pubnub_subscription_alloc(Entity, &Options);
+
+	if(Capacity == 0)
+	{
+		pubnub_entity_free(reinterpret_cast<void**>(&Entity));
+		return Subscription;
+	}
+
+	if(Entities.Num() >= Capacity)
+	{
+		//Entity is still referenced by its subscriptions, this only drops the cache reference
+		auto It = Entities.CreateIterator();
+		pubnub_entity_free(reinterpret_cast<void**>(&It.Value()));
+		It.RemoveCurrent();
+	}
+	Entities.Add(Key, Entity);
+	return Subscription;
+}
+
+void FPubnubCCoreEntityCache::FreeEntities()
+{
+	FScopeLock Lock(&Mutex);
+	for(TPair<FEntityKey, pubnub_entity_t*>& Pair : Entities)
+	{
+		pubnub_entity_free(reinterpret_cast<void**>(&Pair.Value));
+	}
+	Entities.Empty();
+	EntitiesContext = nullptr;
+}
+
+int32 FPubnubCCoreEntityCache::Num() const
+{
+	FScopeLock Lock(&Mutex);
+	return Entities.Num();
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubEnumLibrary.h"
+#include "PubnubKeyFuncs.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "PubNub.h"
+THIRD_PARTY_INCLUDES_END
+
+/**
+ * C-Core entities (channels, groups, App Context objects) kept alive between subscriptions, keyed by entity type and ID.
+ *
+ * Every C-Core subscription takes its own reference to the entity it's allocated for, so the cache only holds one more.
+ * Subscribing to the same entity again allocates only the subscription, not the entity.
+ * When the cache is full, one entity is released to make room. Entities belong to a single context,
+ * so FreeEntities has to be called before that context is freed.
+ */
+class FPubnubCCoreEntityCache
+{
+public:
+
+	explicit FPubnubCCoreEntityCache(int32 InCapacity);
+	~FPubnubCCoreEntityCache();
+
+	FPubnubCCoreEntityCache(const FPubnubCCoreEntityCache&) = delete;
+	FPubnubCCoreEntityCache& operator=(const FPubnubCCoreEntityCache&) = delete;
+
+	//Allocates subscription for given entity. Returns nullptr if entity or subscription couldn't be allocated
+	pubnub_subscription_t* AllocSubscription(pubnub_t* Context, const FString& EntityID, EPubnubEntityType EntityType, const pubnub_subscription_options_t& Options);
+
+	//Releases references to all cached entities. Subscriptions allocated from them stay valid
+	void FreeEntities();
+
+	int32 Num() const;
+
+private:
+
+	mutable FCriticalSection Mutex;
+	using FEntityKey = TPair<EPubnubEntityType, FString>;
+	TMap<FEntityKey, pubnub_entity_t*, FDefaultSetAllocator, TPubnubCaseSensitiveKeyFuncs<FEntityKey, pubnub_entity_t*>> Entities;
+	//Context all cached entities were allocated with
+	pubnub_t* EntitiesContext = nullptr;
+	int32 Capacity = 0;
+};
@@ -0,0 +1,126 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Entities/PubnubChannelHandlerIndex.h"
+
+
+bool FPubnubChannelHandlerIndex::GetWildcardPrefix(const FString& Channel, FString& OutPrefix)
+{
+	if(!Channel.EndsWith(TEXT("*"), ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+	OutPrefix = Channel.LeftChop(1);
+	return true;
+}
+
+bool FPubnubChannelHandlerIndex::Add(int32 HandlerID, const FString& Channel)
+{
+	if(Channel.IsEmpty() || HandlerChannels.Contains(HandlerID))
+	{
+		return false;
+	}
+
+	FHandlerChannel HandlerChannel;
+	HandlerChannel.bIsWildcard = GetWildcardPrefix(Channel, HandlerChannel.Key);
+	if(!HandlerChannel.bIsWildcard)
+	{
+		HandlerChannel.Key = Channel;
+		ExactHandlers.FindOrAdd(HandlerChannel.Key).Add(HandlerID);
+	}
+	else
+	{
+		FHandlerIDArray& PrefixHandlerIDs = PrefixHandlers.FindOrAdd(HandlerChannel.Key);
+		if(PrefixHandlerIDs.IsEmpty())
+		{
+			const int32 PrefixLength = HandlerChannel.Key.Len();
+			int32 Index = 0;
+			while(Index < PrefixLengths.Num() && PrefixLengths[Index].Key > PrefixLength)
+			{
+				Index++;
+			}
+			if(Index < PrefixLengths.Num() && PrefixLengths[Index].Key == PrefixLength)
+			{
+				PrefixLengths[Index].Value++;
+			}
+			else
+			{
+				PrefixLengths.Insert(TPair<int32, int32>(PrefixLength, 1), Index);
+			}
+		}
+		PrefixHandlerIDs.Add(HandlerID);
+	}
+
+	HandlerChannels.Add(HandlerID, MoveTemp(HandlerChannel));
+	return true;
+}
+
+bool FPubnubChannelHandlerIndex::Remove(int32 HandlerID)
+{
+	FHandlerChannel HandlerChannel;
+	if(!HandlerChannels.RemoveAndCopyValue(HandlerID, HandlerChannel))
+	{
+		return false;
+	}
+
+	FHandlersMap& Handlers = HandlerChannel.bIsWildcard ? PrefixHandlers : ExactHandlers;
+	FHandlerIDArray* HandlerIDs = Handlers.Find(HandlerChannel.Key);
+	if(!HandlerIDs)
+	{
+		return true;
+	}
+
+	//Keep the order, handlers of the same channel are called in the order they were bound
+	HandlerIDs->Remove(HandlerID);
+	if(!HandlerIDs->IsEmpty())
+	{
+		return true;
+	}
+	Handlers.Remove(HandlerChannel.Key);
+
+	if(HandlerChannel.bIsWildcard)
+	{
+		const int32 PrefixLength = HandlerChannel.Key.Len();
+		for(int32 Index = 0; Index < PrefixLengths.Num(); Index++)
+		{
+			if(PrefixLengths[Index].Key == PrefixLength)
+			{
+				if(--PrefixLengths[Index].Value == 0)
+				{
+					PrefixLengths.RemoveAt(Index);
+				}
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+void FPubnubChannelHandlerIndex::FindHandlers(FStringView Channel, FHandlerIDArray& OutHandlerIDs) const
+{
+	if(const FHandlerIDArray* HandlerIDs = ExactHandlers.FindByHash(PubnubKeyFuncs::CaseSensitiveHash(Channel), Channel))
+	{
+		OutHandlerIDs.Append(*HandlerIDs);
+	}
+
+	for(const TPair<int32, int32>& PrefixLength : PrefixLengths)
+	{
+		if(PrefixLength.Key > Channel.Len())
+		{
+			continue;
+		}
+		//Looked up by a view of the channel, so no prefix string is created for every message
+		const FStringView Prefix = Channel.Left(PrefixLength.Key);
+		if(const FHandlerIDArray* HandlerIDs = PrefixHandlers.FindByHash(PubnubKeyFuncs::CaseSensitiveHash(Prefix), Prefix))
+		{
+			OutHandlerIDs.Append(*HandlerIDs);
+		}
+	}
+}
+
+void FPubnubChannelHandlerIndex::Empty()
+{
+	ExactHandlers.Empty();
+	PrefixHandlers.Empty();
+	PrefixLengths.Empty();
+	HandlerChannels.Empty();
+}
@@ -8,6 +8,50 @@
 #include "PubnubInternalMacros.h"
 #include "PubnubInternalStructLibrary.h"
 
+namespace
+{
+	TWeakObjectPtr<UPubnubSubscriptionBase> GetListenerOwner(const FPubnubInternalSubscriptionListenerUserData& UserData)
+	{
+		return UserData.WeakSubscription;
+	}
+
+	TWeakObjectPtr<UPubnubSubscriptionBase> GetListenerOwner(const FPubnubInternalSubscriptionSetListenerUserData& UserData)
+	{
+		return UserData.WeakSubscriptionSet;
+	}
+
+	uint32 GetListenerGeneration(const FPubnubInternalSubscriptionListenerUserData& UserData)
+	{
+		return UserData.Generation.load(std::memory_order_relaxed);
+	}
+
+	//Subscription sets are never pooled
+	uint32 GetListenerGeneration(const FPubnubInternalSubscriptionSetListenerUserData& UserData)
+	{
+		return 0;
+	}
+
+	//C-Core listener callback. Every listener type is a separate instantiation, so each has its own function pointer to register and remove
+	template<typename UserDataType, EPubnubListenerType ListenerType>
+	void QueueReceivedMessage(const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
+	{
+		if(!user_data)
+		{return;}
+
+		const UserDataType* ListenerUserDataPtr = static_cast<const UserDataType*>(user_data);
+		if(!ListenerUserDataPtr->MessageQueue)
+		{return;}
+
+		FPubnubReceivedMessageQueue& Queue = *ListenerUserDataPtr->MessageQueue;
+		FPubnubReceivedMessage Received;
+		Received.Message = UPubnubUtilities::NativeMessageFromPubnubMessage(message, *Queue.MessageArena);
+		Received.Subscription = GetListenerOwner(*ListenerUserDataPtr);
+		Received.ListenerType = ListenerType;
+		Received.ListenerGeneration = GetListenerGeneration(*ListenerUserDataPtr);
+		Queue.Enqueue(MoveTemp(Received));
+	}
+}
+
 void UPubnubSubscriptionBase::BeginDestroy()
 {
 	CleanUpSubscription();
@@ -15,6 +59,130 @@ void UPubnubSubscriptionBase::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+void UPubnubSubscriptionBase::ClearDelegates()
+{
+	OnPubnubMessage.Clear();
+	OnPubnubMessageNative.Clear();
+	OnPubnubSignal.Clear();
+	OnPubnubSignalNative.Clear();
+	OnPubnubPresenceEvent.Clear();
+	OnPubnubPresenceEventNative.Clear();
+	OnPubnubObjectEvent.Clear();
+	OnPubnubObjectEventNative.Clear();
+	OnPubnubMessageAction.Clear();
+	OnPubnubMessageActionNative.Clear();
+	FOnPubnubAnyMessageType.Clear();
+	FOnPubnubAnyMessageTypeNative.Clear();
+	OnPubnubNativeMessage.Clear();
+}
+
+bool UPubnubSubscriptionBase::IsMessageDataDelegateBound(EPubnubListenerType ListenerType, bool bIsPresenceEvent) const
+{
+	if(FOnPubnubAnyMessageType.IsBound() || FOnPubnubAnyMessageTypeNative.IsBound())
+	{
+		return true;
+	}
+
+	switch(ListenerType)
+	{
+	case EPubnubListenerType::PLT_Message:
+		return bIsPresenceEvent ? OnPubnubPresenceEvent.IsBound() || OnPubnubPresenceEventNative.IsBound() : OnPubnubMessage.IsBound() || OnPubnubMessageNative.IsBound();
+	case EPubnubListenerType::PLT_Signal:
+		return OnPubnubSignal.IsBound() || OnPubnubSignalNative.IsBound();
+	case EPubnubListenerType::PLT_Objects:
+		return OnPubnubObjectEvent.IsBound() || OnPubnubObjectEventNative.IsBound();
+	case EPubnubListenerType::PLT_MessageAction:
+		return OnPubnubMessageAction.IsBound() || OnPubnubMessageActionNative.IsBound();
+	default:
+		return false;
+	}
+}
+
+void UPubnubSubscriptionBase::BroadcastReceivedMessage(const FPubnubNativeMessage& NativeMessage, EPubnubListenerType ListenerType)
+{
+	if(!IsInitialized || !PubnubClient)
+	{return;}
+
+	OnPubnubNativeMessage.Broadcast(NativeMessage, ListenerType);
+
+	const bool bIsPresenceEvent = NativeMessage.bIsPresenceEvent;
+	if(!IsInitialized || !IsMessageDataDelegateBound(ListenerType, bIsPresenceEvent))
+	{return;}
+	const FPubnubMessageData MessageData = NativeMessage.ToMessageData();
+
+	// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
+	switch(ListenerType)
+	{
+	case EPubnubListenerType::PLT_Message:
+		// In C-Core there is no separate listener for Presence Events. They come together with published messages,
+		// the listener already marked which one is which
+		if(bIsPresenceEvent)
+		{
+			if(IsInitialized)
+			{
+				OnPubnubPresenceEvent.Broadcast(MessageData);
+			}
+			if(IsInitialized)
+			{
+				OnPubnubPresenceEventNative.Broadcast(MessageData);
+			}
+		}
+		else
+		{
+			if(IsInitialized)
+			{
+				OnPubnubMessage.Broadcast(MessageData);
+			}
+			if(IsInitialized)
+			{
+				OnPubnubMessageNative.Broadcast(MessageData);
+			}
+		}
+		break;
+	case EPubnubListenerType::PLT_Signal:
+		if(IsInitialized)
+		{
+			OnPubnubSignal.Broadcast(MessageData);
+		}
+		if(IsInitialized)
+		{
+			OnPubnubSignalNative.Broadcast(MessageData);
+		}
+		break;
+	case EPubnubListenerType::PLT_Objects:
+		if(IsInitialized)
+		{
+			OnPubnubObjectEvent.Broadcast(MessageData);
+		}
+		if(IsInitialized)
+		{
+			OnPubnubObjectEventNative.Broadcast(MessageData);
+		}
+		break;
+	case EPubnubListenerType::PLT_MessageAction:
+		if(IsInitialized)
+		{
+			OnPubnubMessageAction.Broadcast(MessageData);
+		}
+		if(IsInitialized)
+		{
+			OnPubnubMessageActionNative.Broadcast(MessageData);
+		}
+		break;
+	default:
+		break;
+	}
+
+	if(IsInitialized)
+	{
+		FOnPubnubAnyMessageType.Broadcast(MessageData);
+	}
+	if(IsInitialized)
+	{
+		FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
+	}
+}
+
 FPubnubOperationResult UPubnubSubscription::Subscribe(FPubnubSubscriptionCursor Cursor)
 {
 	PUBNUB_ENTITY_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
@@ -146,6 +314,44 @@ UPubnubSubscriptionSet* UPubnubSubscription::AddSubscription(UPubnubSubscription
 	return SubscriptionSet;
 }
 
+void UPubnubSubscription::Release()
+{
+	if(!IsInitialized || bIsReleased)
+	{return;}
+
+	bIsReleased = true;
+	ClearDelegates();
+
+	if(!bIsSubscribed || !IsValid(PubnubClient))
+	{
+		ReturnToPool();
+		return;
+	}
+
+	//Goes to the pool once it's unsubscribed, so it's never handed out while C-Core still delivers its messages
+	TWeakObjectPtr<UPubnubSubscription> WeakThis = MakeWeakObjectPtr(this);
+	FOnPubnubSubscribeOperationResponseNative OnUnsubscribed;
+	OnUnsubscribed.BindLambda([WeakThis](const FPubnubOperationResult& Result)
+	{
+		if(UPubnubSubscription* Subscription = WeakThis.Get())
+		{
+			Subscription->ReturnToPool();
+		}
+	});
+	PubnubClient->UnsubscribeWithSubscriptionAsync(this, OnUnsubscribed);
+}
+
+void UPubnubSubscription::ReturnToPool()
+{
+	if(!IsInitialized)
+	{return;}
+
+	if(!IsValid(PubnubClient) || !PubnubClient->AddSubscriptionToPool(this))
+	{
+		CleanUpSubscription();
+	}
+}
+
 void UPubnubSubscription::InitSubscription(UPubnubClient* InPubnubClient, UPubnubBaseEntity* Entity, FPubnubSubscribeSettings InSubscribeSettings)
 {
 	if(!InPubnubClient)
@@ -159,7 +365,12 @@ void UPubnubSubscription::InitSubscription(UPubnubClient* InPubnubClient, UPubnu
 		return;
 	}
 	PubnubClient = InPubnubClient;
-	CCoreSubscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(InPubnubClient->ctx_ee, Entity->EntityID, Entity->EntityType, InSubscribeSettings);
+	CCoreSubscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(InPubnubClient->ctx_ee, Entity->EntityID, Entity->EntityType, InSubscribeSettings, InPubnubClient->CCoreEntityCache);
+	PoolEntityID = Entity->EntityID;
+	PoolEntityType = Entity->EntityType;
+	bPoolReceivePresenceEvents = InSubscribeSettings.ReceivePresenceEvents;
+	FilterExpression = InSubscribeSettings.FilterExpression;
+	bCanBePooled = CCoreSubscription != nullptr;
 
 	InternalInit();
 
@@ -198,170 +409,14 @@ void UPubnubSubscription::InternalInit()
 	// Set weak pointer to this object in the heap payload
 	FPubnubInternalSubscriptionListenerUserData* UserData = new FPubnubInternalSubscriptionListenerUserData();
 	UserData->WeakSubscription = this;
+	UserData->MessageQueue = PubnubClient->ReceivedMessageQueue;
 	ListenerUserData = UserData;
 
-	// Create callbacks for each Listener type
-
-	// Messages and Presence
-	pubnub_subscribe_message_callback_t CallbackMessages = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscription> SubscriptionWeak = ListenerUserDataPtr->WeakSubscription;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscription* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				if(!S->PubnubClient)
-				{return;}
-				// In C-Core there is no separate listener for Presence Events. They come together with published messages.
-				// So we check if it's Presence Event here and choose equivalent delegates to call
-				// Check IsInitialized before each broadcast to prevent race conditions during destruction
-				if(MessageData.Channel.Contains("-pnpres"))
-				{
-					// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast 
-					if(S->IsInitialized)
-					{
-						S->OnPubnubPresenceEvent.Broadcast(MessageData);
-					}
-					if(S->IsInitialized)
-					{
-						S->OnPubnubPresenceEventNative.Broadcast(MessageData);
-					}
-				}
-				else
-				{
-					if(S->IsInitialized)
-					{
-						S->OnPubnubMessage.Broadcast(MessageData);
-					}
-					if(S->IsInitialized)
-					{
-						S->OnPubnubMessageNative.Broadcast(MessageData);
-					}
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Signals
-	pubnub_subscribe_message_callback_t CallbackSignals = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscription> SubscriptionWeak = ListenerUserDataPtr->WeakSubscription;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscription* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				if(!S->PubnubClient)
-				{return;}
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubSignal.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubSignalNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Objects (App Context)
-	pubnub_subscribe_message_callback_t CallbackObjects = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscription> SubscriptionWeak = ListenerUserDataPtr->WeakSubscription;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscription* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				if(!S->PubnubClient)
-				{return;}
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubObjectEvent.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubObjectEventNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Message Actions
-	pubnub_subscribe_message_callback_t CallbackMessageActions= +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscription> SubscriptionWeak = ListenerUserDataPtr->WeakSubscription;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscription* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				if(!S->PubnubClient)
-				{return;}
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubMessageAction.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubMessageActionNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
+	// Create callbacks for each Listener type. They only queue received messages, the client broadcasts them on the game thread
+	pubnub_subscribe_message_callback_t CallbackMessages = &QueueReceivedMessage<FPubnubInternalSubscriptionListenerUserData, EPubnubListenerType::PLT_Message>;
+	pubnub_subscribe_message_callback_t CallbackSignals = &QueueReceivedMessage<FPubnubInternalSubscriptionListenerUserData, EPubnubListenerType::PLT_Signal>;
+	pubnub_subscribe_message_callback_t CallbackObjects = &QueueReceivedMessage<FPubnubInternalSubscriptionListenerUserData, EPubnubListenerType::PLT_Objects>;
+	pubnub_subscribe_message_callback_t CallbackMessageActions = &QueueReceivedMessage<FPubnubInternalSubscriptionListenerUserData, EPubnubListenerType::PLT_MessageAction>;
 
 	UserData->MessageCb = CallbackMessages;
 	UserData->SignalCb = CallbackSignals;
@@ -417,18 +472,7 @@ void UPubnubSubscription::CleanUpSubscription()
 	bIsSubscribed = false;
 
 	// Clear all delegates to prevent broadcasting during destruction
-	OnPubnubMessage.Clear();
-	OnPubnubMessageNative.Clear();
-	OnPubnubSignal.Clear();
-	OnPubnubSignalNative.Clear();
-	OnPubnubPresenceEvent.Clear();
-	OnPubnubPresenceEventNative.Clear();
-	OnPubnubObjectEvent.Clear();
-	OnPubnubObjectEventNative.Clear();
-	OnPubnubMessageAction.Clear();
-	OnPubnubMessageActionNative.Clear();
-	FOnPubnubAnyMessageType.Clear();
-	FOnPubnubAnyMessageTypeNative.Clear();
+	ClearDelegates();
 
 	if (IsValid(PubnubClient))
 	{
@@ -690,6 +734,7 @@ void UPubnubSubscriptionSet::InitSubscriptionSet(UPubnubClient* InPubnubClient,
 	}
 	PubnubClient = InPubnubClient;
 	CCoreSubscriptionSet = UPubnubInternalUtilities::EEGetSubscriptionSetForEntities(InPubnubClient->ctx_ee, Channels, ChannelGroups, InSubscribeSettings);
+	FilterExpression = InSubscribeSettings.FilterExpression;
 
 	InternalInit();
 
@@ -715,6 +760,7 @@ void UPubnubSubscriptionSet::InitWithSubscriptions(UPubnubClient* InPubnubClient
 	CCoreSubscriptionSet = pubnub_subscription_set_alloc_with_subscriptions(Subscription1->CCoreSubscription, Subscription2->CCoreSubscription, nullptr);
 	Subscriptions.Add(Subscription1);
 	Subscriptions.Add(Subscription2);
+	FilterExpression = Subscription1->FilterExpression.IsEmpty() ? Subscription2->FilterExpression : Subscription1->FilterExpression;
 
 	InternalInit();
 
@@ -749,162 +795,14 @@ void UPubnubSubscriptionSet::InternalInit()
 	// Set weak pointer to this object in the heap payload
 	FPubnubInternalSubscriptionSetListenerUserData* UserData = new FPubnubInternalSubscriptionSetListenerUserData();
 	UserData->WeakSubscriptionSet = this;
+	UserData->MessageQueue = PubnubClient->ReceivedMessageQueue;
 	ListenerUserData = UserData;
 
-	// Create callbacks for each Listener type
-
-	// Messages and Presence
-	pubnub_subscribe_message_callback_t CallbackMessages = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionSetListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionSetListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscriptionSet> SubscriptionWeak = ListenerUserDataPtr->WeakSubscriptionSet;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscriptionSet* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				// In C-Core there is no separate listener for Presence Events. They come together with published messages.
-				// So we check if it's Presence Event here and choose equivalent delegates to call
-				// Check IsInitialized before each broadcast to prevent race conditions during destruction
-				if(MessageData.Channel.Contains("-pnpres"))
-				{
-					// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-					if(S->IsInitialized)
-					{
-						S->OnPubnubPresenceEvent.Broadcast(MessageData);
-					}
-					if(S->IsInitialized)
-					{
-						S->OnPubnubPresenceEventNative.Broadcast(MessageData);
-					}
-				}
-				else
-				{
-					if(S->IsInitialized)
-					{
-						S->OnPubnubMessage.Broadcast(MessageData);
-					}
-					if(S->IsInitialized)
-					{
-						S->OnPubnubMessageNative.Broadcast(MessageData);
-					}
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Signals
-	pubnub_subscribe_message_callback_t CallbackSignals = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionSetListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionSetListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscriptionSet> SubscriptionWeak = ListenerUserDataPtr->WeakSubscriptionSet;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscriptionSet* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubSignal.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubSignalNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Objects (App Context)
-	pubnub_subscribe_message_callback_t CallbackObjects = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionSetListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionSetListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscriptionSet> SubscriptionWeak = ListenerUserDataPtr->WeakSubscriptionSet;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscriptionSet* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubObjectEvent.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubObjectEventNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
-
-	// Message Actions
-	pubnub_subscribe_message_callback_t CallbackMessageActions= +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		if(!user_data)
-		{return;}
-		
-		FPubnubInternalSubscriptionSetListenerUserData* ListenerUserDataPtr = static_cast<FPubnubInternalSubscriptionSetListenerUserData*>(user_data);
-		TWeakObjectPtr<UPubnubSubscriptionSet> SubscriptionWeak = ListenerUserDataPtr->WeakSubscriptionSet;
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, SubscriptionWeak]()
-		{
-			if (UPubnubSubscriptionSet* S = SubscriptionWeak.Get(); IsValid(S) && S->IsInitialized)
-			{
-				// Subscription could be deinitialized from user's logic on any of these calls, so we need to check IsInitialized for every broadcast
-				if(S->IsInitialized)
-				{
-					S->OnPubnubMessageAction.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->OnPubnubMessageActionNative.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageType.Broadcast(MessageData);
-				}
-				if(S->IsInitialized)
-				{
-					S->FOnPubnubAnyMessageTypeNative.Broadcast(MessageData);
-				}
-			}
-		});
-	};
+	// Create callbacks for each Listener type. They only queue received messages, the client broadcasts them on the game thread
+	pubnub_subscribe_message_callback_t CallbackMessages = &QueueReceivedMessage<FPubnubInternalSubscriptionSetListenerUserData, EPubnubListenerType::PLT_Message>;
+	pubnub_subscribe_message_callback_t CallbackSignals = &QueueReceivedMessage<FPubnubInternalSubscriptionSetListenerUserData, EPubnubListenerType::PLT_Signal>;
+	pubnub_subscribe_message_callback_t CallbackObjects = &QueueReceivedMessage<FPubnubInternalSubscriptionSetListenerUserData, EPubnubListenerType::PLT_Objects>;
+	pubnub_subscribe_message_callback_t CallbackMessageActions = &QueueReceivedMessage<FPubnubInternalSubscriptionSetListenerUserData, EPubnubListenerType::PLT_MessageAction>;
 
 	UserData->MessageCb = CallbackMessages;
 	UserData->SignalCb = CallbackSignals;
@@ -961,18 +859,7 @@ void UPubnubSubscriptionSet::CleanUpSubscription()
 
 	// Clear all delegates to prevent broadcasting during destruction
 	// This must be done after setting IsInitialized = false so queued async tasks will skip broadcasting
-	OnPubnubMessage.Clear();
-	OnPubnubMessageNative.Clear();
-	OnPubnubSignal.Clear();
-	OnPubnubSignalNative.Clear();
-	OnPubnubPresenceEvent.Clear();
-	OnPubnubPresenceEventNative.Clear();
-	OnPubnubObjectEvent.Clear();
-	OnPubnubObjectEventNative.Clear();
-	OnPubnubMessageAction.Clear();
-	OnPubnubMessageActionNative.Clear();
-	FOnPubnubAnyMessageType.Clear();
-	FOnPubnubAnyMessageTypeNative.Clear();
+	ClearDelegates();
 
 	if (IsValid(PubnubClient))
 	{
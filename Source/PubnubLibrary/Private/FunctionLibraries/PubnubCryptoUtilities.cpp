@@ -1,6 +1,9 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "FunctionLibraries/PubnubCryptoUtilities.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "Crypto/PubnubCryptorInterface.h"
+#include "Async/ParallelFor.h"
 #include "Misc/Base64.h"
 
 
@@ -99,4 +102,51 @@ bool UPubnubCryptoUtilities::ConvertStringToBytes(const FString& String, uint8*&
 	OutData[BytesLen] = '\0';                // ensure ASCIIZ
 	OutSize = static_cast<size_t>(BytesLen); // report logical size without terminator
 	return true;
-}
\ No newline at end of file
+}
+
+bool UPubnubCryptoUtilities::CopyBytesForCCore(TConstArrayView<uint8> Data, uint8*& OutData, size_t& OutSize)
+{
+	if (Data.Num() == 0) { OutData = nullptr; OutSize = 0; return false; }
+
+	OutData = static_cast<uint8*>(malloc(Data.Num() + 1)); // +1 for '\0'
+	if (!OutData) { OutSize = 0; return false; }
+
+	FMemory::Memcpy(OutData, Data.GetData(), Data.Num());
+	OutData[Data.Num()] = '\0';
+	OutSize = static_cast<size_t>(Data.Num());
+	return true;
+}
+
+void UPubnubCryptoUtilities::DecryptHistoryMessages(UObject* CryptoProvider, TArray<FPubnubHistoryMessageData>& Messages)
+{
+	if (!CryptoProvider || Messages.IsEmpty()) return;
+
+	if (!IPubnubCryptoProviderInterface::IsThreadSafe(CryptoProvider))
+	{
+		//Blueprint (or not thread safe) providers are called one message at a time through ProviderDecrypt
+		for (FPubnubHistoryMessageData& Message : Messages)
+		{
+			const FString Plain = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(CryptoProvider, Message.Message);
+			// If decryption failed - for example when history message was not encrypted, but crypto module is set, just leave the message as it is
+			if (Plain.IsEmpty()) continue;
+
+			//Not encrypted messages are deserialized automatically, encrypted ones are handled the same way as messages received from subscribe
+			FTCHARToUTF8 PlainUTF8(*Plain);
+			Message.Message = UPubnubJsonUtilities::JsonPayloadToMessageString(PlainUTF8.Get(), PlainUTF8.Length());
+		}
+		return;
+	}
+
+	ParallelFor(Messages.Num(), [CryptoProvider, &Messages](int32 Index)
+	{
+		//Scratch buffers live as long as the worker thread, so a page of messages doesn't allocate them for each message
+		static thread_local TArray<uint8> Encrypted;
+		static thread_local TArray<uint8> Plain;
+
+		FPubnubHistoryMessageData& Message = Messages[Index];
+		if (Message.Message.IsEmpty() || !FBase64::Decode(Message.Message, Encrypted)) return;
+		if (!IPubnubCryptoProviderInterface::ProviderDecryptBytes(CryptoProvider, Encrypted, Plain) || Plain.IsEmpty()) return;
+
+		Message.Message = UPubnubJsonUtilities::JsonPayloadToMessageString(reinterpret_cast<const char*>(Plain.GetData()), Plain.Num());
+	});
+}
@@ -4,6 +4,7 @@
 #include "PubnubClient.h"
 #include "PubnubLibraryVersion.h"
 #include "FunctionLibraries/PubnubUtilities.h"
+#include "Entities/PubnubCCoreEntityCache.h"
 
 FString UPubnubInternalUtilities::GetPubnubSdkVersionSuffix()
 {
@@ -27,6 +28,63 @@ void UPubnubInternalUtilities::PublishUESettingsToPubnubPublishOptions(const FPu
 	PubnubPublishOptions.method = (pubnub_method)(uint8)PublishSettings.PublishMethod;
 }
 
+EPubnubPublishMethod UPubnubInternalUtilities::GetPublishMethodForMessageSize(EPubnubPublishMethod RequestedMethod, int32 MessageSizeBytes, int32 CompressionThresholdBytes)
+{
+	//Only the default method is changed, any other was chosen on purpose
+	if(RequestedMethod != EPubnubPublishMethod::PPM_SendViaGET || CompressionThresholdBytes < 0 || MessageSizeBytes < CompressionThresholdBytes)
+	{
+		return RequestedMethod;
+	}
+	return EPubnubPublishMethod::PPM_SendViaPOSTwithGZIP;
+}
+
+bool UPubnubInternalUtilities::IsRetryableResult(EPubnubRetryEndpoint Endpoint, pubnub_res Result, int32 HttpStatus)
+{
+	switch(Result)
+	{
+	case PNR_OK:
+	case PNR_STARTED:
+	//Cancelled by the client itself (deinitialization), not by the network
+	case PNR_CANCELLED:
+		return false;
+	//Request never reached the server
+	case PNR_ADDR_RESOLUTION_FAILED:
+	case PNR_WAIT_CONNECT_TIMEOUT:
+	case PNR_CONNECT_FAILED:
+		return true;
+	case PNR_CONNECTION_TIMEOUT:
+	case PNR_TIMEOUT:
+	case PNR_IO_ERROR:
+		//Publish or signal could already be stored, sending it again would duplicate the message
+		return Endpoint != EPubnubRetryEndpoint::PRE_MessageSend;
+	default:
+		if(Endpoint == EPubnubRetryEndpoint::PRE_MessageSend)
+		{
+			return HttpStatus == 429;
+		}
+		return HttpStatus == 429 || (HttpStatus >= 500 && HttpStatus < 600);
+	}
+}
+
+bool UPubnubInternalUtilities::CanRetry(const FPubnubRetryConfig& RetryConfig, EPubnubRetryEndpoint Endpoint, int32 RetriesDone)
+{
+	return RetryConfig.Policy != EPubnubRetryPolicy::PRP_None
+		&& RetriesDone < RetryConfig.MaxRetries
+		&& !RetryConfig.ExcludedEndpoints.Contains(Endpoint);
+}
+
+float UPubnubInternalUtilities::GetRetryDelaySeconds(const FPubnubRetryConfig& RetryConfig, int32 RetryIndex, float JitterAlpha)
+{
+	const float BaseDelay = FMath::Max(RetryConfig.DelaySeconds, 0.1f);
+	float Delay = BaseDelay;
+	if(RetryConfig.Policy == EPubnubRetryPolicy::PRP_Exponential)
+	{
+		//Exponent is capped, so large retry counts don't overflow before the maximum is applied
+		Delay = FMath::Min(BaseDelay * FMath::Pow(2.0f, static_cast<float>(FMath::Clamp(RetryIndex, 0, 30))), FMath::Max(RetryConfig.MaximumDelaySeconds, BaseDelay));
+	}
+	return Delay + FMath::Max(RetryConfig.JitterSeconds, 0.0f) * FMath::Clamp(JitterAlpha, 0.0f, 1.0f);
+}
+
 void UPubnubInternalUtilities::HereNowUESettingsToPubnubHereNowOptions(const FPubnubListUsersFromChannelSettings& HereNowSettings, pubnub_here_now_options& PubnubHereNowOptions)
 {
 	PubnubHereNowOptions.disable_uuids = HereNowSettings.DisableUserID;
@@ -56,31 +114,40 @@ void UPubnubInternalUtilities::FetchHistoryUESettingsToPbFetchHistoryOptions(con
 	FetchHistorySettings.End.IsEmpty() ? PubnubFetchHistoryOptions.end = NULL : nullptr;
 }
 
-pubnub_subscription_t* UPubnubInternalUtilities::EEGetSubscriptionForEntity(pubnub_t* Context, FString EntityID, EPubnubEntityType EntityType, FPubnubSubscribeSettings Options)
+pubnub_entity_t* UPubnubInternalUtilities::EEAllocEntity(pubnub_t* Context, const FString& EntityID, EPubnubEntityType EntityType)
 {
-	pubnub_subscription_options_t PnOptions = pubnub_subscription_options_defopts();
-	PnOptions.receive_presence_events = Options.ReceivePresenceEvents;
-
 	FUTF8StringHolder EntityIDHolder(EntityID);
-	pubnub_entity_t* PubnubEntity = nullptr;
 	switch (EntityType)
 	{
 	case EPubnubEntityType::PEnT_Channel:
-		PubnubEntity = reinterpret_cast<pubnub_entity_t*>(pubnub_channel_alloc(Context, EntityIDHolder.Get()));
-		break;
+		return reinterpret_cast<pubnub_entity_t*>(pubnub_channel_alloc(Context, EntityIDHolder.Get()));
 	case EPubnubEntityType::PEnT_ChannelGroup:
-		PubnubEntity = reinterpret_cast<pubnub_entity_t*>(pubnub_channel_group_alloc(Context, EntityIDHolder.Get()));
-		break;
+		return reinterpret_cast<pubnub_entity_t*>(pubnub_channel_group_alloc(Context, EntityIDHolder.Get()));
 	case EPubnubEntityType::PEnT_ChannelMetadata:
-		PubnubEntity = reinterpret_cast<pubnub_entity_t*>(pubnub_channel_metadata_alloc(Context, EntityIDHolder.Get()));
-		break;
+		return reinterpret_cast<pubnub_entity_t*>(pubnub_channel_metadata_alloc(Context, EntityIDHolder.Get()));
 	case EPubnubEntityType::PEnT_UserMetadata:
-		PubnubEntity = reinterpret_cast<pubnub_entity_t*>(pubnub_user_metadata_alloc(Context, EntityIDHolder.Get()));
-		break;
+		return reinterpret_cast<pubnub_entity_t*>(pubnub_user_metadata_alloc(Context, EntityIDHolder.Get()));
 	default:
 		UE_LOG(PubnubLog, Error, TEXT("Unknown entity type: %d"), (int32)EntityType);
 		return nullptr;
 	}
+}
+
+pubnub_subscription_t* UPubnubInternalUtilities::EEGetSubscriptionForEntity(pubnub_t* Context, FString EntityID, EPubnubEntityType EntityType, FPubnubSubscribeSettings Options, FPubnubCCoreEntityCache* EntityCache)
+{
+	pubnub_subscription_options_t PnOptions = pubnub_subscription_options_defopts();
+	PnOptions.receive_presence_events = Options.ReceivePresenceEvents;
+
+	if(EntityCache)
+	{
+		return EntityCache->AllocSubscription(Context, EntityID, EntityType, PnOptions);
+	}
+
+	pubnub_entity_t* PubnubEntity = EEAllocEntity(Context, EntityID, EntityType);
+	if(!PubnubEntity)
+	{
+		return nullptr;
+	}
 	pubnub_subscription_t* Subscription = pubnub_subscription_alloc(PubnubEntity, &PnOptions);
 	
 	pubnub_entity_free(reinterpret_cast<void**>(&PubnubEntity));
@@ -117,6 +184,38 @@ pubnub_subscription_set_t* UPubnubInternalUtilities::EEGetSubscriptionSetForEnti
 	return SubscriptionSet;
 }
 
+pubnub_subscription_set_t* UPubnubInternalUtilities::EEGetSubscriptionSetForSubscriptions(const TArray<pubnub_subscription_t*>& Subscriptions, FPubnubSubscribeSettings Options)
+{
+	if(Subscriptions.Num() < 2)
+	{
+		UE_LOG(PubnubLog, Error, TEXT("EEGetSubscriptionSetForSubscriptions Failed, subscription set needs at least two subscriptions"));
+		return nullptr;
+	}
+
+	pubnub_subscription_options_t PnOptions = pubnub_subscription_options_defopts();
+	PnOptions.receive_presence_events = Options.ReceivePresenceEvents;
+
+	pubnub_subscription_set_t* SubscriptionSet = pubnub_subscription_set_alloc_with_subscriptions(Subscriptions[0], Subscriptions[1], &PnOptions);
+	if(!SubscriptionSet)
+	{
+		UE_LOG(PubnubLog, Error, TEXT("EEGetSubscriptionSetForSubscriptions Failed, pubnub_subscription_set_alloc_with_subscriptions didn't create subscription set"));
+		return nullptr;
+	}
+
+	for(int32 i = 2; i < Subscriptions.Num(); ++i)
+	{
+		const enum pubnub_res AddResult = pubnub_subscription_set_add(SubscriptionSet, Subscriptions[i]);
+		if(AddResult != PNR_OK)
+		{
+			UE_LOG(PubnubLog, Error, TEXT("EEGetSubscriptionSetForSubscriptions Failed, can't add subscription to the set. Error: %s"), UTF8_TO_TCHAR(pubnub_res_2_string(AddResult)));
+			pubnub_subscription_set_free(&SubscriptionSet);
+			return nullptr;
+		}
+	}
+
+	return SubscriptionSet;
+}
+
 bool UPubnubInternalUtilities::EEAddListenerAndSubscribe(pubnub_subscription_t* Subscription, pubnub_subscribe_message_callback_t Callback, UPubnubClient* PubnubClient)
 {
 	if(!PubnubClient)
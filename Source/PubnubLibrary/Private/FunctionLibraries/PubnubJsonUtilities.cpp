@@ -97,6 +97,1037 @@ FString UPubnubJsonUtilities::DeserializeString(const FString InString)
 	return Parsed;
 }
 
+namespace
+{
+	//Validating JSON scanner working directly on UTF-8 bytes. It only moves a pointer, so it never allocates
+	struct FPubnubJsonScanner
+	{
+		const uint8* Current = nullptr;
+		const uint8* End = nullptr;
+
+		//Protects the stack from maliciously deep payloads
+		static constexpr int32 MaxDepth = 512;
+
+		static bool IsHexDigit(uint8 C)
+		{
+			return (C >= '0' && C <= '9') || (C >= 'a' && C <= 'f') || (C >= 'A' && C <= 'F');
+		}
+
+		static bool IsDigit(uint8 C)
+		{
+			return C >= '0' && C <= '9';
+		}
+
+		void SkipWhitespace()
+		{
+			while(Current < End && (*Current == ' ' || *Current == '\t' || *Current == '\n' || *Current == '\r'))
+			{
+				Current++;
+			}
+		}
+
+		bool Consume(uint8 C)
+		{
+			if(Current < End && *Current == C)
+			{
+				Current++;
+				return true;
+			}
+			return false;
+		}
+
+		bool ScanDigits()
+		{
+			const uint8* Start = Current;
+			while(Current < End && IsDigit(*Current))
+			{
+				Current++;
+			}
+			return Current != Start;
+		}
+
+		bool ScanLiteral(const char* Literal, int32 LiteralLength)
+		{
+			if(End - Current < LiteralLength || FMemory::Memcmp(Current, Literal, LiteralLength) != 0)
+			{
+				return false;
+			}
+			Current += LiteralLength;
+			return true;
+		}
+
+		//Expects Current to point at the opening quote
+		bool ScanString()
+		{
+			Current++;
+			while(Current < End)
+			{
+				const uint8 C = *Current++;
+				if(C == '"')
+				{
+					return true;
+				}
+				if(C < 0x20)
+				{
+					return false;
+				}
+				if(C != '\\')
+				{
+					continue;
+				}
+				if(Current >= End)
+				{
+					return false;
+				}
+				switch(*Current++)
+				{
+				case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+					break;
+				case 'u':
+					if(End - Current < 4 || !IsHexDigit(Current[0]) || !IsHexDigit(Current[1]) || !IsHexDigit(Current[2]) || !IsHexDigit(Current[3]))
+					{
+						return false;
+					}
+					Current += 4;
+					break;
+				default:
+					return false;
+				}
+			}
+			return false;
+		}
+
+		bool ScanNumber()
+		{
+			Consume('-');
+			if(Current >= End)
+			{
+				return false;
+			}
+			//Leading zeros are not allowed
+			if(!Consume('0') && !ScanDigits())
+			{
+				return false;
+			}
+			if(Consume('.') && !ScanDigits())
+			{
+				return false;
+			}
+			if(Consume('e') || Consume('E'))
+			{
+				if(!Consume('+'))
+				{
+					Consume('-');
+				}
+				if(!ScanDigits())
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool ScanValue(int32 Depth)
+		{
+			SkipWhitespace();
+			if(Current >= End)
+			{
+				return false;
+			}
+
+			switch(*Current)
+			{
+			case '{':
+				if(Depth >= MaxDepth)
+				{
+					return false;
+				}
+				Current++;
+				SkipWhitespace();
+				if(Consume('}'))
+				{
+					return true;
+				}
+				while(true)
+				{
+					SkipWhitespace();
+					if(Current >= End || *Current != '"' || !ScanString())
+					{
+						return false;
+					}
+					SkipWhitespace();
+					if(!Consume(':') || !ScanValue(Depth + 1))
+					{
+						return false;
+					}
+					SkipWhitespace();
+					if(!Consume(','))
+					{
+						return Consume('}');
+					}
+				}
+			case '[':
+				if(Depth >= MaxDepth)
+				{
+					return false;
+				}
+				Current++;
+				SkipWhitespace();
+				if(Consume(']'))
+				{
+					return true;
+				}
+				while(true)
+				{
+					if(!ScanValue(Depth + 1))
+					{
+						return false;
+					}
+					SkipWhitespace();
+					if(!Consume(','))
+					{
+						return Consume(']');
+					}
+				}
+			case '"':
+				return ScanString();
+			case 't':
+				return ScanLiteral("true", 4);
+			case 'f':
+				return ScanLiteral("false", 5);
+			case 'n':
+				return ScanLiteral("null", 4);
+			default:
+				return ScanNumber();
+			}
+		}
+	};
+
+	uint32 ParseHex4(const uint8* Data)
+	{
+		uint32 Value = 0;
+		for(int32 i = 0; i < 4; i++)
+		{
+			const uint8 C = Data[i];
+			const uint32 Digit = C <= '9' ? C - '0' : (C | 0x20) - 'a' + 10;
+			Value = (Value << 4) | Digit;
+		}
+		return Value;
+	}
+
+	void AppendCodePoint(FString& Out, uint32 CodePoint)
+	{
+		//TCHAR is UTF-16 on most platforms, so characters outside of BMP need a surrogate pair
+		if(sizeof(TCHAR) == 2 && CodePoint > 0xFFFF)
+		{
+			CodePoint -= 0x10000;
+			Out.AppendChar(static_cast<TCHAR>(0xD800 + (CodePoint >> 10)));
+			Out.AppendChar(static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF)));
+			return;
+		}
+		Out.AppendChar(static_cast<TCHAR>(CodePoint));
+	}
+
+	//Decodes one UTF-8 sequence starting at Current. Malformed sequences are replaced the same way FUTF8ToTCHAR does
+	uint32 DecodeUtf8(const uint8*& Current, const uint8* End)
+	{
+		const uint8 Lead = *Current++;
+		if(Lead < 0x80)
+		{
+			return Lead;
+		}
+
+		int32 ContinuationCount;
+		uint32 CodePoint;
+		uint32 MinCodePoint;
+		if((Lead & 0xE0) == 0xC0)		{ ContinuationCount = 1; CodePoint = Lead & 0x1F; MinCodePoint = 0x80; }
+		else if((Lead & 0xF0) == 0xE0)	{ ContinuationCount = 2; CodePoint = Lead & 0x0F; MinCodePoint = 0x800; }
+		else if((Lead & 0xF8) == 0xF0)	{ ContinuationCount = 3; CodePoint = Lead & 0x07; MinCodePoint = 0x10000; }
+		else
+		{
+			return UNICODE_BOGUS_CHAR_CODEPOINT;
+		}
+
+		for(int32 i = 0; i < ContinuationCount; i++)
+		{
+			if(Current >= End || (*Current & 0xC0) != 0x80)
+			{
+				return UNICODE_BOGUS_CHAR_CODEPOINT;
+			}
+			CodePoint = (CodePoint << 6) | (*Current++ & 0x3F);
+		}
+
+		if(CodePoint < MinCodePoint || CodePoint > 0x10FFFF || (CodePoint >= 0xD800 && CodePoint <= 0xDFFF))
+		{
+			return UNICODE_BOGUS_CHAR_CODEPOINT;
+		}
+		return CodePoint;
+	}
+
+	//Unescapes already validated JSON string. Data has to point right after the opening quote
+	FString UnescapeJsonString(const uint8* Current, const uint8* End)
+	{
+		FString Out;
+		//Unescaped string is never longer than its UTF-8 form, so this is the only allocation
+		Out.Reserve(static_cast<int32>(End - Current));
+
+		while(Current < End)
+		{
+			const uint8 C = *Current;
+			if(C == '"')
+			{
+				break;
+			}
+			if(C != '\\')
+			{
+				if(C >= 0x80)
+				{
+					AppendCodePoint(Out, DecodeUtf8(Current, End));
+					continue;
+				}
+				//Most of the strings are plain ASCII, so copy the whole run of such characters at once
+				const uint8* RunStart = Current;
+				while(Current < End && *Current < 0x80 && *Current != '"' && *Current != '\\')
+				{
+					Current++;
+				}
+				Out.AppendChars(reinterpret_cast<const ANSICHAR*>(RunStart), static_cast<int32>(Current - RunStart));
+				continue;
+			}
+
+			const uint8 Escape = Current[1];
+			Current += 2;
+			switch(Escape)
+			{
+			case 'b': Out.AppendChar(TEXT('\b')); break;
+			case 'f': Out.AppendChar(TEXT('\f')); break;
+			case 'n': Out.AppendChar(TEXT('\n')); break;
+			case 'r': Out.AppendChar(TEXT('\r')); break;
+			case 't': Out.AppendChar(TEXT('\t')); break;
+			case 'u':
+				{
+					uint32 CodePoint = ParseHex4(Current);
+					Current += 4;
+					//Join escaped surrogate pair into a single code point
+					if(CodePoint >= 0xD800 && CodePoint <= 0xDBFF && End - Current >= 6 && Current[0] == '\\' && Current[1] == 'u')
+					{
+						const uint32 LowSurrogate = ParseHex4(Current + 2);
+						if(LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+						{
+							CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+							Current += 6;
+						}
+					}
+					AppendCodePoint(Out, CodePoint);
+					break;
+				}
+			default:
+				//Quote, backslash and slash are just escaped versions of themselves
+				Out.AppendChar(static_cast<TCHAR>(Escape));
+				break;
+			}
+		}
+		return Out;
+	}
+
+	//Parses JSON number token the same way FJsonValueNumber stores it. Tokens too long for the buffer are rejected
+	bool ParseJsonNumber(const uint8* Start, const uint8* End, double& OutNumber)
+	{
+		ANSICHAR NumberBuffer[128];
+		const int32 Length = static_cast<int32>(End - Start);
+		if(Length <= 0 || Length >= UE_ARRAY_COUNT(NumberBuffer))
+		{
+			return false;
+		}
+		FMemory::Memcpy(NumberBuffer, Start, Length);
+		NumberBuffer[Length] = '\0';
+		OutNumber = FCStringAnsi::Atod(NumberBuffer);
+		return true;
+	}
+
+	//Raw (still escaped) bytes of an object key
+	struct FPubnubJsonKey
+	{
+		const uint8* Data = nullptr;
+		int32 Length = 0;
+
+		//Case insensitive, the same as field lookup in FJsonObject
+		template<int32 N>
+		bool Is(const ANSICHAR (&Name)[N]) const
+		{
+			return Length == N - 1 && FCStringAnsi::Strnicmp(reinterpret_cast<const ANSICHAR*>(Data), Name, N - 1) == 0;
+		}
+	};
+
+	/**
+	 * SAX-style reader for App Context and History responses. It walks UTF-8 response once and writes fields straight into the result structs,
+	 * values that are not needed are only validated and skipped. Typed reads follow TryGet*Field rules of FJsonObject,
+	 * so value of unexpected type leaves the field untouched instead of failing the whole response.
+	 */
+	struct FPubnubResponseReader
+	{
+		FPubnubJsonScanner Scanner;
+
+		//Fields of the operation result, resolved when the whole response is read
+		int32 Status = 0;
+		bool bError = false;
+		FString ErrorMessage;
+		FString Message;
+		const uint8* ErrorObjectStart = nullptr;
+		const uint8* ErrorObjectEnd = nullptr;
+
+		FPubnubResponseReader(const char* Data, int32 Length)
+		{
+			Scanner.Current = reinterpret_cast<const uint8*>(Data);
+			Scanner.End = Data ? Scanner.Current + FMath::Max(Length, 0) : Scanner.Current;
+		}
+
+		uint8 Peek()
+		{
+			Scanner.SkipWhitespace();
+			return Scanner.Current < Scanner.End ? *Scanner.Current : 0;
+		}
+
+		static bool IsContainer(uint8 First)
+		{
+			return First == '{' || First == '[';
+		}
+
+		bool SkipValue(int32 Depth)
+		{
+			return Scanner.ScanValue(Depth);
+		}
+
+		//Calls OnField(Key, ValueDepth) for every field. Handler has to consume the value
+		template<typename FieldHandlerType>
+		bool ReadObject(int32 Depth, FieldHandlerType&& OnField)
+		{
+			if(Peek() != '{' || Depth >= FPubnubJsonScanner::MaxDepth)
+			{
+				return false;
+			}
+			Scanner.Current++;
+			if(Peek() == '}')
+			{
+				Scanner.Current++;
+				return true;
+			}
+			while(true)
+			{
+				if(Peek() != '"')
+				{
+					return false;
+				}
+				const uint8* KeyStart = Scanner.Current;
+				if(!Scanner.ScanString())
+				{
+					return false;
+				}
+				FPubnubJsonKey Key;
+				Key.Data = KeyStart + 1;
+				Key.Length = static_cast<int32>(Scanner.Current - KeyStart) - 2;
+
+				Scanner.SkipWhitespace();
+				if(!Scanner.Consume(':') || !OnField(Key, Depth + 1))
+				{
+					return false;
+				}
+				Scanner.SkipWhitespace();
+				if(!Scanner.Consume(','))
+				{
+					return Scanner.Consume('}');
+				}
+			}
+		}
+
+		//Calls OnElement(ElementDepth) for every element. Handler has to consume the value
+		template<typename ElementHandlerType>
+		bool ReadArray(int32 Depth, ElementHandlerType&& OnElement)
+		{
+			if(Peek() != '[' || Depth >= FPubnubJsonScanner::MaxDepth)
+			{
+				return false;
+			}
+			Scanner.Current++;
+			if(Peek() == ']')
+			{
+				Scanner.Current++;
+				return true;
+			}
+			while(true)
+			{
+				if(!OnElement(Depth + 1))
+				{
+					return false;
+				}
+				Scanner.SkipWhitespace();
+				if(!Scanner.Consume(','))
+				{
+					return Scanner.Consume(']');
+				}
+			}
+		}
+
+		bool ReadString(FString& OutString, int32 Depth)
+		{
+			const uint8 First = Peek();
+			const uint8* Start = Scanner.Current;
+			if(!Scanner.ScanValue(Depth))
+			{
+				return false;
+			}
+			switch(First)
+			{
+			case '"':
+				OutString = UnescapeJsonString(Start + 1, Scanner.Current);
+				break;
+			case '{': case '[': case 'n':
+				break;
+			default:
+				//Numbers and booleans are accepted as strings, just like FJsonValue::TryGetString does
+				OutString = UPubnubJsonUtilities::JsonPayloadToMessageString(reinterpret_cast<const char*>(Start), static_cast<int32>(Scanner.Current - Start));
+				break;
+			}
+			return true;
+		}
+
+		bool ReadInt(int32& OutNumber, int32 Depth)
+		{
+			const uint8 First = Peek();
+			const uint8* Start = Scanner.Current;
+			if(!Scanner.ScanValue(Depth))
+			{
+				return false;
+			}
+			double Number = 0.0;
+			if((First == '-' || FPubnubJsonScanner::IsDigit(First)) && ParseJsonNumber(Start, Scanner.Current, Number) && Number >= MIN_int32 && Number <= MAX_int32)
+			{
+				OutNumber = FMath::RoundToInt(Number);
+			}
+			return true;
+		}
+
+		bool ReadBool(bool& OutBool, int32 Depth)
+		{
+			const uint8 First = Peek();
+			if(!Scanner.ScanValue(Depth))
+			{
+				return false;
+			}
+			if(First == 't' || First == 'f')
+			{
+				OutBool = First == 't';
+			}
+			return true;
+		}
+
+		//Objects are kept as raw JSON substring, there is no need to build and serialize them again
+		bool ReadRawObject(FString& OutJson, int32 Depth)
+		{
+			const uint8 First = Peek();
+			const uint8* Start = Scanner.Current;
+			if(!Scanner.ScanValue(Depth))
+			{
+				return false;
+			}
+			if(First == '{')
+			{
+				FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Start), static_cast<int32>(Scanner.Current - Start));
+				OutJson = FString(Converter.Length(), Converter.Get());
+			}
+			return true;
+		}
+
+		bool ReadUserData(FPubnubUserData& UserData, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			return ReadObject(Depth, [this, &UserData](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("id"))			{ return ReadString(UserData.UserID, ValueDepth); }
+				if(Key.Is("name"))			{ return ReadString(UserData.UserName, ValueDepth); }
+				if(Key.Is("externalId"))	{ return ReadString(UserData.ExternalID, ValueDepth); }
+				if(Key.Is("profileUrl"))	{ return ReadString(UserData.ProfileUrl, ValueDepth); }
+				if(Key.Is("email"))			{ return ReadString(UserData.Email, ValueDepth); }
+				if(Key.Is("status"))		{ return ReadString(UserData.Status, ValueDepth); }
+				if(Key.Is("type"))			{ return ReadString(UserData.Type, ValueDepth); }
+				if(Key.Is("updated"))		{ return ReadString(UserData.Updated, ValueDepth); }
+				if(Key.Is("eTag"))			{ return ReadString(UserData.ETag, ValueDepth); }
+				if(Key.Is("custom"))		{ return ReadRawObject(UserData.Custom, ValueDepth); }
+				return SkipValue(ValueDepth);
+			});
+		}
+
+		bool ReadChannelData(FPubnubChannelData& ChannelData, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			return ReadObject(Depth, [this, &ChannelData](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("id"))			{ return ReadString(ChannelData.ChannelID, ValueDepth); }
+				if(Key.Is("name"))			{ return ReadString(ChannelData.ChannelName, ValueDepth); }
+				if(Key.Is("description"))	{ return ReadString(ChannelData.Description, ValueDepth); }
+				if(Key.Is("status"))		{ return ReadString(ChannelData.Status, ValueDepth); }
+				if(Key.Is("type"))			{ return ReadString(ChannelData.Type, ValueDepth); }
+				if(Key.Is("updated"))		{ return ReadString(ChannelData.Updated, ValueDepth); }
+				if(Key.Is("eTag"))			{ return ReadString(ChannelData.ETag, ValueDepth); }
+				if(Key.Is("custom"))		{ return ReadRawObject(ChannelData.Custom, ValueDepth); }
+				return SkipValue(ValueDepth);
+			});
+		}
+
+		bool ReadMembershipData(FPubnubMembershipData& MembershipData, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			return ReadObject(Depth, [this, &MembershipData](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("channel"))		{ return ReadChannelData(MembershipData.Channel, ValueDepth); }
+				if(Key.Is("custom"))		{ return ReadRawObject(MembershipData.Custom, ValueDepth); }
+				if(Key.Is("status"))		{ return ReadString(MembershipData.Status, ValueDepth); }
+				if(Key.Is("type"))			{ return ReadString(MembershipData.Type, ValueDepth); }
+				if(Key.Is("updated"))		{ return ReadString(MembershipData.Updated, ValueDepth); }
+				if(Key.Is("eTag"))			{ return ReadString(MembershipData.ETag, ValueDepth); }
+				return SkipValue(ValueDepth);
+			});
+		}
+
+		bool ReadChannelMemberData(FPubnubChannelMemberData& ChannelMemberData, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			return ReadObject(Depth, [this, &ChannelMemberData](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("uuid"))			{ return ReadUserData(ChannelMemberData.User, ValueDepth); }
+				if(Key.Is("custom"))		{ return ReadRawObject(ChannelMemberData.Custom, ValueDepth); }
+				if(Key.Is("status"))		{ return ReadString(ChannelMemberData.Status, ValueDepth); }
+				if(Key.Is("type"))			{ return ReadString(ChannelMemberData.Type, ValueDepth); }
+				if(Key.Is("updated"))		{ return ReadString(ChannelMemberData.Updated, ValueDepth); }
+				if(Key.Is("eTag"))			{ return ReadString(ChannelMemberData.ETag, ValueDepth); }
+				return SkipValue(ValueDepth);
+			});
+		}
+
+		//Like ReadRawObject, but whitespace outside of strings is dropped, so the result matches condensed Json writer output
+		bool ReadCondensedJson(FString& OutJson, int32 Depth)
+		{
+			const uint8 First = Peek();
+			const uint8* Start = Scanner.Current;
+			if(!Scanner.ScanValue(Depth))
+			{
+				return false;
+			}
+			if(!IsContainer(First))
+			{
+				return true;
+			}
+
+			thread_local TArray<ANSICHAR> CondensedBuffer;
+			CondensedBuffer.Reset(static_cast<int32>(Scanner.Current - Start));
+			bool bInString = false;
+			for(const uint8* Current = Start; Current < Scanner.Current; Current++)
+			{
+				const uint8 C = *Current;
+				if(bInString)
+				{
+					CondensedBuffer.Add(static_cast<ANSICHAR>(C));
+					if(C == '\\')
+					{
+						CondensedBuffer.Add(static_cast<ANSICHAR>(*++Current));
+					}
+					else if(C == '"')
+					{
+						bInString = false;
+					}
+				}
+				else if(C != ' ' && C != '\t' && C != '\n' && C != '\r')
+				{
+					CondensedBuffer.Add(static_cast<ANSICHAR>(C));
+					bInString = C == '"';
+				}
+			}
+			FUTF8ToTCHAR Converter(CondensedBuffer.GetData(), CondensedBuffer.Num());
+			OutJson = FString(Converter.Length(), Converter.Get());
+			return true;
+		}
+
+		//Message actions are grouped by type and value: {"type": {"value": [{"uuid": ..., "actionTimetoken": ...}]}}
+		bool ReadHistoryMessageActions(FPubnubHistoryMessageData& HistoryMessage, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			FPubnubMessageActionData MessageAction;
+			MessageAction.MessageTimetoken = HistoryMessage.Timetoken;
+			return ReadObject(Depth, [&](const FPubnubJsonKey& TypeKey, int32 TypeDepth)
+			{
+				if(Peek() != '{')
+				{
+					return SkipValue(TypeDepth);
+				}
+				MessageAction.Type = UnescapeJsonString(TypeKey.Data, TypeKey.Data + TypeKey.Length);
+				return ReadObject(TypeDepth, [&](const FPubnubJsonKey& ValueKey, int32 ValueDepth)
+				{
+					if(Peek() != '[')
+					{
+						return SkipValue(ValueDepth);
+					}
+					MessageAction.Value = UnescapeJsonString(ValueKey.Data, ValueKey.Data + ValueKey.Length);
+					return ReadArray(ValueDepth, [&](int32 ActionDepth)
+					{
+						if(Peek() != '{')
+						{
+							return SkipValue(ActionDepth);
+						}
+						const bool bRead = ReadObject(ActionDepth, [&](const FPubnubJsonKey& Key, int32 FieldDepth)
+						{
+							if(Key.Is("uuid"))				{ return ReadString(MessageAction.UserID, FieldDepth); }
+							if(Key.Is("actionTimetoken"))	{ return ReadString(MessageAction.ActionTimetoken, FieldDepth); }
+							return SkipValue(FieldDepth);
+						});
+						HistoryMessage.MessageActions.Add(MessageAction);
+						return bRead;
+					});
+				});
+			});
+		}
+
+		bool ReadHistoryMessage(FPubnubHistoryMessageData& HistoryMessage, int32 Depth)
+		{
+			if(Peek() != '{')
+			{
+				return SkipValue(Depth);
+			}
+			//Actions take the message timetoken, which can come after them in the response
+			const uint8* ActionsStart = nullptr;
+			int32 ActionsDepth = 0;
+			const bool bRead = ReadObject(Depth, [&](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("message"))
+				{
+					return IsContainer(Peek()) ? ReadCondensedJson(HistoryMessage.Message, ValueDepth) : ReadString(HistoryMessage.Message, ValueDepth);
+				}
+				if(Key.Is("meta"))
+				{
+					return IsContainer(Peek()) ? ReadCondensedJson(HistoryMessage.Meta, ValueDepth) : ReadString(HistoryMessage.Meta, ValueDepth);
+				}
+				if(Key.Is("uuid"))					{ return ReadString(HistoryMessage.UserID, ValueDepth); }
+				if(Key.Is("timetoken"))				{ return ReadString(HistoryMessage.Timetoken, ValueDepth); }
+				if(Key.Is("message_type"))			{ return ReadString(HistoryMessage.MessageType, ValueDepth); }
+				if(Key.Is("custom_message_type"))	{ return ReadString(HistoryMessage.CustomMessageType, ValueDepth); }
+				if(Key.Is("actions"))
+				{
+					ActionsStart = Peek() == '{' ? Scanner.Current : nullptr;
+					ActionsDepth = ValueDepth;
+				}
+				return SkipValue(ValueDepth);
+			});
+			if(!bRead || !ActionsStart)
+			{
+				return bRead;
+			}
+
+			//Actions were already validated, so read them again now when the timetoken is known
+			const uint8* MessageEnd = Scanner.Current;
+			Scanner.Current = ActionsStart;
+			const bool bActionsRead = ReadHistoryMessageActions(HistoryMessage, ActionsDepth);
+			Scanner.Current = MessageEnd;
+			return bActionsRead;
+		}
+
+		/**
+		 * Reads the whole response object. Fields of the operation result are read here,
+		 * OnField(Key, ValueDepth) is called for every other field and has to consume its value.
+		 * Returns false if response is not a correct JSON object.
+		 */
+		template<typename FieldHandlerType>
+		bool ReadResponse(FieldHandlerType&& OnField)
+		{
+			const bool bParsed = ReadObject(0, [&](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("status"))		{ return ReadInt(Status, ValueDepth); }
+				if(Key.Is("error"))
+				{
+					//App Context returns error details as an object in this field
+					ErrorObjectStart = Peek() == '{' ? Scanner.Current : nullptr;
+					if(!ReadBool(bError, ValueDepth))
+					{
+						return false;
+					}
+					ErrorObjectEnd = Scanner.Current;
+					return true;
+				}
+				if(Key.Is("error_message"))	{ return ReadString(ErrorMessage, ValueDepth); }
+				if(Key.Is("message"))		{ return ReadString(Message, ValueDepth); }
+				return OnField(Key, ValueDepth);
+			});
+
+			Scanner.SkipWhitespace();
+			return bParsed && Scanner.Current == Scanner.End;
+		}
+
+		/**
+		 * Reads the whole paginated response. Every element of "data" is read with ReadElement straight into the Elements array.
+		 * Returns false if response is not a correct JSON object, in such case nothing is added to Elements.
+		 */
+		template<typename ElementType, typename ElementReaderType>
+		bool ReadPage(TArray<ElementType>& Elements, FPubnubPage& Page, int32& TotalCount, ElementReaderType&& ReadElement)
+		{
+			const int32 InitialNum = Elements.Num();
+			FPubnubPage PageData = Page;
+			int32 ReadTotalCount = TotalCount;
+
+			const bool bParsed = ReadResponse([&](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("next"))			{ return ReadString(PageData.Next, ValueDepth); }
+				if(Key.Is("prev"))			{ return ReadString(PageData.Prev, ValueDepth); }
+				if(Key.Is("totalCount"))	{ return ReadInt(ReadTotalCount, ValueDepth); }
+				if(Key.Is("data") && Peek() == '[')
+				{
+					return ReadArray(ValueDepth, [&](int32 ElementDepth)
+					{
+						return (this->*ReadElement)(Elements.AddDefaulted_GetRef(), ElementDepth);
+					});
+				}
+				return SkipValue(ValueDepth);
+			});
+
+			if(!bParsed)
+			{
+				Elements.SetNum(InitialNum);
+				return false;
+			}
+
+			Page = PageData;
+			TotalCount = ReadTotalCount;
+			return true;
+		}
+
+		//Reads response with a single App Context object in "data". Output is only written when the whole response is correct
+		template<typename ObjectType, typename ObjectReaderType>
+		bool ReadSingleObject(ObjectType& Object, ObjectReaderType&& ReadData)
+		{
+			ObjectType ReadObjectData;
+			bool bHasData = false;
+			const bool bParsed = ReadResponse([&](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(Key.Is("data") && Peek() == '{')
+				{
+					ReadObjectData = ObjectType();
+					bHasData = true;
+					return (this->*ReadData)(ReadObjectData, ValueDepth);
+				}
+				return SkipValue(ValueDepth);
+			});
+
+			if(bParsed && bHasData)
+			{
+				Object = MoveTemp(ReadObjectData);
+			}
+			return bParsed;
+		}
+
+		/**
+		 * Reads History response. At the moment C-Core and UE SDK support fetching history from one channel, so only the first one is read.
+		 * Returns false if response is not a correct JSON object, in such case nothing is added to Messages.
+		 */
+		bool ReadHistory(TArray<FPubnubHistoryMessageData>& Messages)
+		{
+			const int32 InitialNum = Messages.Num();
+			bool bChannelRead = false;
+
+			const bool bParsed = ReadResponse([&](const FPubnubJsonKey& Key, int32 ValueDepth)
+			{
+				if(!Key.Is("channels") || Peek() != '{')
+				{
+					return SkipValue(ValueDepth);
+				}
+				return ReadObject(ValueDepth, [&](const FPubnubJsonKey& ChannelKey, int32 ChannelDepth)
+				{
+					if(bChannelRead || Peek() != '[')
+					{
+						return SkipValue(ChannelDepth);
+					}
+					bChannelRead = true;
+					const FString Channel = UnescapeJsonString(ChannelKey.Data, ChannelKey.Data + ChannelKey.Length);
+					return ReadArray(ChannelDepth, [&](int32 MessageDepth)
+					{
+						FPubnubHistoryMessageData& HistoryMessage = Messages.AddDefaulted_GetRef();
+						HistoryMessage.Channel = Channel;
+						return ReadHistoryMessage(HistoryMessage, MessageDepth);
+					});
+				});
+			});
+
+			if(!bParsed)
+			{
+				Messages.SetNum(InitialNum);
+			}
+			return bParsed;
+		}
+
+		//Same rules as UPubnubJsonUtilities::GetOperationResultFromJson
+		FPubnubOperationResult GetOperationResult() const
+		{
+			FPubnubOperationResult Result;
+			Result.Status = Status;
+			Result.Error = bError;
+			Result.ErrorMessage = ErrorMessage.IsEmpty() ? Message : ErrorMessage;
+			return Result;
+		}
+
+		//Same rules as UPubnubJsonUtilities::GetOperationResultFromJson_AppContext
+		FPubnubOperationResult GetAppContextOperationResult() const
+		{
+			FPubnubOperationResult Result = GetOperationResult();
+			if(Result.Status != 200)
+			{
+				Result.Error = true;
+				if(Result.ErrorMessage.IsEmpty() && ErrorObjectStart)
+				{
+					//Error responses are rare and small, so it's fine to go through the DOM to keep the condensed format
+					FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(ErrorObjectStart), static_cast<int32>(ErrorObjectEnd - ErrorObjectStart));
+					TSharedPtr<FJsonObject> ErrorJsonObject;
+					if(UPubnubJsonUtilities::StringToJsonObject(FString(Converter.Length(), Converter.Get()), ErrorJsonObject))
+					{
+						Result.ErrorMessage = UPubnubJsonUtilities::JsonObjectToString(ErrorJsonObject);
+					}
+				}
+			}
+			return Result;
+		}
+	};
+
+	template<typename ElementType>
+	void AppContextPageJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<ElementType>& Elements, FPubnubPage& Page, int& TotalCount,
+		bool (FPubnubResponseReader::*ReadElement)(ElementType&, int32))
+	{
+		FPubnubResponseReader Reader(ResponseJson, Length);
+		if(!Reader.ReadPage(Elements, Page, TotalCount, ReadElement))
+		{
+			Result.Error = true;
+			Result.ErrorMessage = "Failed to parse Response";
+			return;
+		}
+		Result = Reader.GetAppContextOperationResult();
+	}
+
+	template<typename ObjectType>
+	void AppContextObjectJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, ObjectType& Object,
+		bool (FPubnubResponseReader::*ReadData)(ObjectType&, int32))
+	{
+		FPubnubResponseReader Reader(ResponseJson, Length);
+		if(!Reader.ReadSingleObject(Object, ReadData))
+		{
+			Result.Error = true;
+			Result.ErrorMessage = "Failed to parse Response";
+			return;
+		}
+		Result = Reader.GetAppContextOperationResult();
+	}
+}
+
+EPubnubJsonPayloadType UPubnubJsonUtilities::ClassifyJsonPayload(const char* Data, int32 Length)
+{
+	if(!Data || Length <= 0)
+	{
+		return EPubnubJsonPayloadType::Invalid;
+	}
+
+	FPubnubJsonScanner Scanner;
+	Scanner.Current = reinterpret_cast<const uint8*>(Data);
+	Scanner.End = Scanner.Current + Length;
+
+	Scanner.SkipWhitespace();
+	if(Scanner.Current >= Scanner.End)
+	{
+		return EPubnubJsonPayloadType::Invalid;
+	}
+
+	EPubnubJsonPayloadType Type;
+	switch(*Scanner.Current)
+	{
+	case '{': Type = EPubnubJsonPayloadType::Object; break;
+	case '[': Type = EPubnubJsonPayloadType::Array; break;
+	case '"': Type = EPubnubJsonPayloadType::String; break;
+	case 't': case 'f': Type = EPubnubJsonPayloadType::Boolean; break;
+	case 'n': Type = EPubnubJsonPayloadType::Null; break;
+	default: Type = EPubnubJsonPayloadType::Number; break;
+	}
+
+	if(!Scanner.ScanValue(0))
+	{
+		return EPubnubJsonPayloadType::Invalid;
+	}
+
+	//Nothing but whitespace is allowed after the root value
+	Scanner.SkipWhitespace();
+	return Scanner.Current == Scanner.End ? Type : EPubnubJsonPayloadType::Invalid;
+}
+
+FString UPubnubJsonUtilities::JsonPayloadToMessageString(const char* Data, int32 Length)
+{
+	if(!Data || Length <= 0)
+	{
+		return FString();
+	}
+
+	const uint8* Begin = reinterpret_cast<const uint8*>(Data);
+	const uint8* End = Begin + Length;
+
+	switch(ClassifyJsonPayload(Data, Length))
+	{
+	case EPubnubJsonPayloadType::String:
+		{
+			const uint8* Current = Begin;
+			while(*Current != '"')
+			{
+				Current++;
+			}
+			return UnescapeJsonString(Current + 1, End);
+		}
+	case EPubnubJsonPayloadType::Number:
+		{
+			//Numbers are formatted the same way FJsonValueNumber does it. Numbers too long for the buffer are kept as they are
+			ANSICHAR NumberBuffer[128];
+			if(Length < UE_ARRAY_COUNT(NumberBuffer))
+			{
+				FMemory::Memcpy(NumberBuffer, Data, Length);
+				NumberBuffer[Length] = '\0';
+				return FString::SanitizeFloat(FCStringAnsi::Atod(NumberBuffer), 0);
+			}
+			break;
+		}
+	case EPubnubJsonPayloadType::Boolean:
+		{
+			//Whitespace around the value is allowed, so check the first meaningful character
+			const uint8* Current = Begin;
+			while(*Current != 't' && *Current != 'f')
+			{
+				Current++;
+			}
+			return *Current == 't' ? TEXT("true") : TEXT("false");
+		}
+	case EPubnubJsonPayloadType::Null:
+		return FString();
+	default:
+		//Objects, arrays and not a Json payloads are returned as they are
+		break;
+	}
+
+	FUTF8ToTCHAR Converter(Data, Length);
+	return FString(Converter.Length(), Converter.Get());
+}
+
 void UPubnubJsonUtilities::AddObjectFieldToJson(const FString& FieldName, const FString& JsonObjectString, TSharedPtr<FJsonObject>& JsonObject, bool AddNullFieldIfEmpty)
 {
 	if (JsonObjectString.IsEmpty() && !AddNullFieldIfEmpty)
@@ -383,185 +1414,64 @@ void UPubnubJsonUtilities::ListUsersFromChannelJsonToData(FString ResponseJson,
 
 void UPubnubJsonUtilities::FetchHistoryJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubHistoryMessageData> &Messages)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	FetchHistoryJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, Messages);
+}
 
-	if(!StringToJsonObject(ResponseJson, JsonObject))
+void UPubnubJsonUtilities::FetchHistoryJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubHistoryMessageData>& Messages)
+{
+	FPubnubResponseReader Reader(ResponseJson, Length);
+	if(!Reader.ReadHistory(Messages))
 	{
 		Result.Error = true;
 		Result.ErrorMessage = "Failed to parse Response";
 		return;
 	}
-
-	Result = GetOperationResultFromJson(JsonObject);
-
-	if(!JsonObject->HasField(ANSI_TO_TCHAR("channels")))
-	{
-		return;
-	}
-
-	TSharedPtr<FJsonObject> ChannelsJsonObject = JsonObject->GetObjectField(ANSI_TO_TCHAR("channels"));
-	
-	for(auto Iterator = ChannelsJsonObject->Values.CreateIterator(); Iterator; ++Iterator)
-	{
-		TSharedPtr<FJsonValue> ChannelJsonValue = Iterator.Value();
-		
-		//Iterate through all messages from the response
-		for(auto MessageValue : ChannelJsonValue->AsArray())
-		{
-			FPubnubHistoryMessageData CurrentMessage;
-			CurrentMessage.Channel = Iterator.Key();
-			if(!MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("message"), CurrentMessage.Message))
-			{
-				const TSharedPtr<FJsonObject>* MetaJsonObject = nullptr;
-				if(MessageValue->AsObject()->TryGetObjectField(ANSI_TO_TCHAR("message"), MetaJsonObject))
-				{
-					CurrentMessage.Message = JsonObjectToString(*MetaJsonObject);
-				}
-			}
-			MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("uuid"), CurrentMessage.UserID);
-			MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("timetoken"), CurrentMessage.Timetoken);
-			MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("message_type"), CurrentMessage.MessageType);
-			MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("custom_message_type"), CurrentMessage.CustomMessageType);
-			if(!MessageValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("meta"), CurrentMessage.Meta))
-			{
-				const TSharedPtr<FJsonObject>* MetaJsonObject = nullptr;
-				if(MessageValue->AsObject()->TryGetObjectField(ANSI_TO_TCHAR("meta"), MetaJsonObject))
-				{
-					CurrentMessage.Meta = JsonObjectToString(*MetaJsonObject);
-				}
-			}
-
-			//Iterate through all message actions from the message
-			const TSharedPtr<FJsonObject>* MessageActionsJsonObject = nullptr;
-			if(MessageValue->AsObject()->TryGetObjectField(ANSI_TO_TCHAR("actions"), MessageActionsJsonObject))
-			{
-				FPubnubMessageActionData CurrentMessageAction;
-				CurrentMessageAction.MessageTimetoken = CurrentMessage.Timetoken;
-				for(auto ActionsTypeIterator = MessageActionsJsonObject->Get()->Values.CreateIterator(); ActionsTypeIterator; ++ActionsTypeIterator)
-				{
-					CurrentMessageAction.Type = ActionsTypeIterator.Key();
-					for(auto ActionsValueIterator = ActionsTypeIterator.Value()->AsObject()->Values.CreateIterator(); ActionsValueIterator; ++ActionsValueIterator)
-					{
-						CurrentMessageAction.Value = ActionsValueIterator.Key();
-						for(auto MessageActionValue : ActionsValueIterator.Value()->AsArray())
-						{
-							MessageActionValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("uuid"), CurrentMessageAction.UserID);
-							MessageActionValue->AsObject()->TryGetStringField(ANSI_TO_TCHAR("actionTimetoken"), CurrentMessageAction.ActionTimetoken);
-							CurrentMessage.MessageActions.Add(CurrentMessageAction);
-						}
-					}
-				}
-			}
-
-			Messages.Add(CurrentMessage);
-		}
-		//At the moment C-Core and UE SDK support Fetching history from one channel. 
-		break;
-	}
+	Result = Reader.GetOperationResult();
 }
 
 void UPubnubJsonUtilities::GetAllUserMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubUserData>& UsersData, FPubnubPage& Page, int& TotalCount)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-	
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
-	
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("next"), Page.Next);
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("prev"), Page.Prev);
-	JsonObject->TryGetNumberField(ANSI_TO_TCHAR("totalCount"), TotalCount);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetAllUserMetadataJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, UsersData, Page, TotalCount);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		TArray<TSharedPtr<FJsonValue>> UuidsJsonValue = JsonObject->GetArrayField(ANSI_TO_TCHAR("data"));
-		
-		for(auto UuidJsonValue : UuidsJsonValue)
-		{
-			FPubnubUserData CurrentUuidData = GetUserDataFromJson(JsonObjectToString(UuidJsonValue->AsObject()));
-			UsersData.Add(CurrentUuidData);
-		}
-	}
+void UPubnubJsonUtilities::GetAllUserMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubUserData>& UsersData, FPubnubPage& Page, int& TotalCount)
+{
+	AppContextPageJsonToData(ResponseJson, Length, Result, UsersData, Page, TotalCount, &FPubnubResponseReader::ReadUserData);
 }
 
 void UPubnubJsonUtilities::GetUserMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, FPubnubUserData& UserData)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetUserMetadataJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, UserData);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		const TSharedPtr<FJsonObject> *DataJsonObject = nullptr;
-		if(JsonObject->TryGetObjectField(ANSI_TO_TCHAR("data"), DataJsonObject))
-		{
-			UserData = GetUserDataFromJson(JsonObjectToString(*DataJsonObject));
-		}
-	}
+void UPubnubJsonUtilities::GetUserMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, FPubnubUserData& UserData)
+{
+	AppContextObjectJsonToData(ResponseJson, Length, Result, UserData, &FPubnubResponseReader::ReadUserData);
 }
 
 void UPubnubJsonUtilities::GetAllChannelMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubChannelData>& ChannelsData, FPubnubPage& Page, int& TotalCount)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-	
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
-	
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("next"), Page.Next);
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("prev"), Page.Prev);
-	JsonObject->TryGetNumberField(ANSI_TO_TCHAR("totalCount"), TotalCount);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetAllChannelMetadataJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, ChannelsData, Page, TotalCount);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		TArray<TSharedPtr<FJsonValue>> ChannelsJsonValue = JsonObject->GetArrayField(ANSI_TO_TCHAR("data"));
-		
-		for(auto ChannelJsonValue : ChannelsJsonValue)
-		{
-			FPubnubChannelData CurrentChannelData = GetChannelDataFromJson(JsonObjectToString(ChannelJsonValue->AsObject()));
-			ChannelsData.Add(CurrentChannelData);
-		}
-	}
+void UPubnubJsonUtilities::GetAllChannelMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubChannelData>& ChannelsData, FPubnubPage& Page, int& TotalCount)
+{
+	AppContextPageJsonToData(ResponseJson, Length, Result, ChannelsData, Page, TotalCount, &FPubnubResponseReader::ReadChannelData);
 }
 
 void UPubnubJsonUtilities::GetChannelMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, FPubnubChannelData& ChannelData)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-	
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetChannelMetadataJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, ChannelData);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		const TSharedPtr<FJsonObject> *DataJsonObject = nullptr;
-		if(JsonObject->TryGetObjectField(ANSI_TO_TCHAR("data"), DataJsonObject))
-		{
-			ChannelData = GetChannelDataFromJson(JsonObjectToString(*DataJsonObject));
-		}
-	}
+void UPubnubJsonUtilities::GetChannelMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, FPubnubChannelData& ChannelData)
+{
+	AppContextObjectJsonToData(ResponseJson, Length, Result, ChannelData, &FPubnubResponseReader::ReadChannelData);
 }
 
 void UPubnubJsonUtilities::GetMessageActionsJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubMessageActionData>& MessageActions)
@@ -622,48 +1532,24 @@ void UPubnubJsonUtilities::AddMessageActionJsonToData(FString ResponseJson, FPub
 
 void UPubnubJsonUtilities::GetMembershipsJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubMembershipData>& MembershipsData, FPubnubPage& Page, int& TotalCount)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
-	
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("next"), Page.Next);
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("prev"), Page.Prev);
-	JsonObject->TryGetNumberField(ANSI_TO_TCHAR("totalCount"), TotalCount);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetMembershipsJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, MembershipsData, Page, TotalCount);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		MembershipsData = GetMembershipsDataArrayFromJson(JsonObject);
-	}
+void UPubnubJsonUtilities::GetMembershipsJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubMembershipData>& MembershipsData, FPubnubPage& Page, int& TotalCount)
+{
+	AppContextPageJsonToData(ResponseJson, Length, Result, MembershipsData, Page, TotalCount, &FPubnubResponseReader::ReadMembershipData);
 }
 
 void UPubnubJsonUtilities::GetChannelMembersJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubChannelMemberData>& MembershipsData, FPubnubPage& Page, int& TotalCount)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		Result.Error = true;
-		Result.ErrorMessage = "Failed to parse Response";
-		return;
-	}
-
-	Result = GetOperationResultFromJson_AppContext(JsonObject);
-	
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("next"), Page.Next);
-	JsonObject->TryGetStringField(ANSI_TO_TCHAR("prev"), Page.Prev);
-	JsonObject->TryGetNumberField(ANSI_TO_TCHAR("totalCount"), TotalCount);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	GetChannelMembersJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, MembershipsData, Page, TotalCount);
+}
 
-	if(JsonObject->HasField(ANSI_TO_TCHAR("data")))
-	{
-		MembershipsData = GetChannelMembersDataArrayFromJson(JsonObject);
-	}
+void UPubnubJsonUtilities::GetChannelMembersJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubChannelMemberData>& MembershipsData, FPubnubPage& Page, int& TotalCount)
+{
+	AppContextPageJsonToData(ResponseJson, Length, Result, MembershipsData, Page, TotalCount, &FPubnubResponseReader::ReadChannelMemberData);
 }
 
 FPubnubUserData UPubnubJsonUtilities::GetUserDataFromJson(FString ResponseJson)
@@ -823,14 +1709,13 @@ FString UPubnubJsonUtilities::GetJsonFromMembershipInputData(const FPubnubMember
 
 TArray<FPubnubMembershipData> UPubnubJsonUtilities::GetMembershipsDataArrayFromJson(FString ResponseJson)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		return {};
-	}
-
-	return GetMembershipsDataArrayFromJson(JsonObject);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	FPubnubOperationResult Result;
+	TArray<FPubnubMembershipData> MembershipsDataArray;
+	FPubnubPage Page;
+	int TotalCount = 0;
+	GetMembershipsJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, MembershipsDataArray, Page, TotalCount);
+	return MembershipsDataArray;
 }
 
 TArray<FPubnubMembershipData> UPubnubJsonUtilities::GetMembershipsDataArrayFromJson(TSharedPtr<FJsonObject> JsonObject)
@@ -945,14 +1830,13 @@ FString UPubnubJsonUtilities::GetJsonFromChannelMemberData(const FPubnubChannelM
 
 TArray<FPubnubChannelMemberData> UPubnubJsonUtilities::GetChannelMembersDataArrayFromJson(FString ResponseJson)
 {
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-	if(!StringToJsonObject(ResponseJson, JsonObject))
-	{
-		return {};
-	}
-
-	return GetChannelMembersDataArrayFromJson(JsonObject);
+	FTCHARToUTF8 ResponseUtf8(*ResponseJson);
+	FPubnubOperationResult Result;
+	TArray<FPubnubChannelMemberData> ChannelMembersDataArray;
+	FPubnubPage Page;
+	int TotalCount = 0;
+	GetChannelMembersJsonToData(ResponseUtf8.Get(), ResponseUtf8.Length(), Result, ChannelMembersDataArray, Page, TotalCount);
+	return ChannelMembersDataArray;
 }
 
 TArray<FPubnubChannelMemberData> UPubnubJsonUtilities::GetChannelMembersDataArrayFromJson(TSharedPtr<FJsonObject> JsonObject)
@@ -1087,6 +1971,16 @@ FPubnubOperationResult UPubnubJsonUtilities::GetOperationResultFromJson_AppConte
 	return GetOperationResultFromJson_AppContext(JsonObject);
 }
 
+FPubnubOperationResult UPubnubJsonUtilities::GetOperationResultFromJson_AppContext(const char* ResponseJson, int32 Length)
+{
+	FPubnubResponseReader Reader(ResponseJson, Length);
+	const bool bParsed = Reader.ReadResponse([&Reader](const FPubnubJsonKey&, int32 ValueDepth)
+	{
+		return Reader.SkipValue(ValueDepth);
+	});
+	return bParsed ? Reader.GetAppContextOperationResult() : FPubnubOperationResult();
+}
+
 FPubnubChannelUpdateData UPubnubJsonUtilities::GetChannelUpdateDataFromMessageContent(const FString& MessageContent)
 {
 	FPubnubChannelUpdateData ChannelUpdateData;
@@ -219,40 +219,57 @@ FString UPubnubTokenUtilities::ReworkParsedToken(const FString& ParsedToken)
 
 int UPubnubTokenUtilities::CalculateChannelPermissionsBitmask(const FPubnubChannelPermissions& Perms)
 {
-	// Calculate bitmask for channel permissions based on individual permission flags
-	// Bit values: READ=1, WRITE=2, MANAGE=4, DELETE=8, GET=32, UPDATE=64, JOIN=128
 	int Bitmask = 0;
-	if (Perms.Read) Bitmask |= 1;
-	if (Perms.Write) Bitmask |= 2;
-	if (Perms.Manage) Bitmask |= 4;
-	if (Perms.Delete) Bitmask |= 8;
-	if (Perms.Get) Bitmask |= 32;
-	if (Perms.Update) Bitmask |= 64;
-	if (Perms.Join) Bitmask |= 128;
+	if (Perms.Read) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Read);
+	if (Perms.Write) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Write);
+	if (Perms.Manage) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Manage);
+	if (Perms.Delete) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Delete);
+	if (Perms.Get) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Get);
+	if (Perms.Update) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Update);
+	if (Perms.Join) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Join);
 	return Bitmask;
 }
 
 int UPubnubTokenUtilities::CalculateChannelGroupPermissionsBitmask(const FPubnubChannelGroupPermissions& Perms)
 {
-	// Calculate bitmask for channel group permissions based on individual permission flags
-	// Bit values: READ=1, MANAGE=4
 	int Bitmask = 0;
-	if (Perms.Read) Bitmask |= 1;
-	if (Perms.Manage) Bitmask |= 4;
+	if (Perms.Read) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Read);
+	if (Perms.Manage) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Manage);
 	return Bitmask;
 }
 
 int UPubnubTokenUtilities::CalculateUserPermissionsBitmask(const FPubnubUserPermissions& Perms)
 {
-	// Calculate bitmask for user permissions based on individual permission flags
-	// Bit values: DELETE=8, GET=32, UPDATE=64
 	int Bitmask = 0;
-	if (Perms.Delete) Bitmask |= 8;
-	if (Perms.Get) Bitmask |= 32;
-	if (Perms.Update) Bitmask |= 64;
+	if (Perms.Delete) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Delete);
+	if (Perms.Get) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Get);
+	if (Perms.Update) Bitmask |= GetPermissionBit(EPubnubTokenPermission::PTP_Update);
 	return Bitmask;
 }
 
+int UPubnubTokenUtilities::GetPermissionBit(EPubnubTokenPermission Permission)
+{
+	// Bit values: READ=1, WRITE=2, MANAGE=4, DELETE=8, GET=32, UPDATE=64, JOIN=128
+	switch(Permission)
+	{
+	case EPubnubTokenPermission::PTP_Read:
+		return 1;
+	case EPubnubTokenPermission::PTP_Write:
+		return 2;
+	case EPubnubTokenPermission::PTP_Manage:
+		return 4;
+	case EPubnubTokenPermission::PTP_Delete:
+		return 8;
+	case EPubnubTokenPermission::PTP_Get:
+		return 32;
+	case EPubnubTokenPermission::PTP_Update:
+		return 64;
+	case EPubnubTokenPermission::PTP_Join:
+		return 128;
+	}
+	return 0;
+}
+
 TSharedPtr<FJsonObject> UPubnubTokenUtilities::ConvertChannelPermissionsFromBitmask(const TSharedPtr<FJsonObject>& SourceObject)
 {
 	TSharedPtr<FJsonObject> ConvertedObject = MakeShareable(new FJsonObject);
@@ -309,16 +326,14 @@ TSharedPtr<FJsonObject> UPubnubTokenUtilities::CreateChannelPermissionsFromBitma
 	TSharedPtr<FJsonObject> PermissionsObject = MakeShareable(new FJsonObject);
 	
 	// Channel permissions: Read, Write, Delete, Get, Update, Manage, Join
-	// Based on bit values: READ=1, WRITE=2, MANAGE=4, DELETE=8, GET=32, UPDATE=64, JOIN=128
-	
 	// Always include all relevant channel permissions
-	PermissionsObject->SetBoolField(TEXT("Read"), (Bitmask & 1) != 0);
-	PermissionsObject->SetBoolField(TEXT("Write"), (Bitmask & 2) != 0);
-	PermissionsObject->SetBoolField(TEXT("Manage"), (Bitmask & 4) != 0);
-	PermissionsObject->SetBoolField(TEXT("Delete"), (Bitmask & 8) != 0);
-	PermissionsObject->SetBoolField(TEXT("Get"), (Bitmask & 32) != 0);
-	PermissionsObject->SetBoolField(TEXT("Update"), (Bitmask & 64) != 0);
-	PermissionsObject->SetBoolField(TEXT("Join"), (Bitmask & 128) != 0);
+	PermissionsObject->SetBoolField(TEXT("Read"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Read)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Write"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Write)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Manage"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Manage)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Delete"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Delete)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Get"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Get)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Update"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Update)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Join"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Join)) != 0);
 	
 	return PermissionsObject;
 }
@@ -328,11 +343,9 @@ TSharedPtr<FJsonObject> UPubnubTokenUtilities::CreateChannelGroupPermissionsFrom
 	TSharedPtr<FJsonObject> PermissionsObject = MakeShareable(new FJsonObject);
 	
 	// Channel Group permissions: Read, Manage
-	// Based on bit values: READ=1, MANAGE=4
-	
 	// Always include all relevant channel group permissions
-	PermissionsObject->SetBoolField(TEXT("Read"), (Bitmask & 1) != 0);
-	PermissionsObject->SetBoolField(TEXT("Manage"), (Bitmask & 4) != 0);
+	PermissionsObject->SetBoolField(TEXT("Read"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Read)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Manage"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Manage)) != 0);
 	
 	return PermissionsObject;
 }
@@ -342,12 +355,10 @@ TSharedPtr<FJsonObject> UPubnubTokenUtilities::CreateUserPermissionsFromBitmask(
 	TSharedPtr<FJsonObject> PermissionsObject = MakeShareable(new FJsonObject);
 	
 	// User permissions: Delete, Get, Update
-	// Based on bit values: DELETE=8, GET=32, UPDATE=64
-	
 	// Always include all relevant user permissions
-	PermissionsObject->SetBoolField(TEXT("Delete"), (Bitmask & 8) != 0);
-	PermissionsObject->SetBoolField(TEXT("Get"), (Bitmask & 32) != 0);
-	PermissionsObject->SetBoolField(TEXT("Update"), (Bitmask & 64) != 0);
+	PermissionsObject->SetBoolField(TEXT("Delete"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Delete)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Get"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Get)) != 0);
+	PermissionsObject->SetBoolField(TEXT("Update"), (Bitmask & GetPermissionBit(EPubnubTokenPermission::PTP_Update)) != 0);
 	
 	return PermissionsObject;
 }
\ No newline at end of file
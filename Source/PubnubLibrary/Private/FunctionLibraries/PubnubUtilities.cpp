@@ -5,6 +5,7 @@
 #include "Config/PubnubSettings.h"
 #include "Entities/PubnubSubscription.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "PubnubNativeMessage.h"
 #include "Kismet/KismetMathLibrary.h"
 
 
@@ -18,10 +19,19 @@ FPubnubConfig UPubnubUtilities::PubnubConfigFromPluginSettings(UPubnubSettings*
 }
 
 FString UPubnubUtilities::PubnubGetLastServerHttpResponse(pubnub_t* Context)
+{
+	return Utf8ViewToString(PubnubGetLastServerHttpResponseView(Context));
+}
+
+FAnsiStringView UPubnubUtilities::PubnubGetLastServerHttpResponseView(pubnub_t* Context)
 {
 	pubnub_char_mem_block LastServerResponse;
 	pubnub_last_http_response_body(Context, &LastServerResponse);
-	return PubnubCharMemBlockToString(LastServerResponse);
+	if (!LastServerResponse.ptr || LastServerResponse.size == 0)
+	{
+		return FAnsiStringView();
+	}
+	return FAnsiStringView(LastServerResponse.ptr, static_cast<int32>(LastServerResponse.size));
 }
 
 int UPubnubUtilities::RoundLimitForPubnubFunctions(int ProvidedLimit)
@@ -65,6 +75,17 @@ FString UPubnubUtilities::PubnubCharMemBlockToString(const pubnub_char_mem_block
 	return FString(Converter.Length(), Converter.Get());
 }
 
+FString UPubnubUtilities::Utf8ViewToString(FAnsiStringView Utf8View)
+{
+	if (Utf8View.IsEmpty())
+	{
+		return FString();
+	}
+	
+	FUTF8ToTCHAR Converter(Utf8View.GetData(), Utf8View.Len());
+	return FString(Converter.Length(), Converter.Get());
+}
+
 FString UPubnubUtilities::ArrayOfStringsToCommaSeparatedString(const TArray<FString> ArrayOfStrings)
 {
 	FString FinalString = "";
@@ -136,13 +157,8 @@ FString UPubnubUtilities::GetNameFromFunctionMacro(FString FunctionName)
 FPubnubMessageData UPubnubUtilities::UEMessageFromPubnubMessage(pubnub_v2_message PubnubMessage)
 {
 	FPubnubMessageData MessageData;
-	MessageData.Message = PubnubCharMemBlockToString(PubnubMessage.payload);
-
-	//If message was just a string, we need to deserialize it
-	if(!UPubnubJsonUtilities::IsCorrectJsonString(MessageData.Message, false))
-	{
-		MessageData.Message = UPubnubJsonUtilities::DeserializeString(MessageData.Message);
-	}
+	//Payload is classified and, if it was just a string, unescaped in one pass straight from C-Core memory
+	MessageData.Message = UPubnubJsonUtilities::JsonPayloadToMessageString(PubnubMessage.payload.ptr, static_cast<int32>(PubnubMessage.payload.size));
 	
 	MessageData.Channel = PubnubCharMemBlockToString(PubnubMessage.channel);
 	MessageData.UserID = PubnubCharMemBlockToString(PubnubMessage.publisher);
@@ -154,6 +170,46 @@ FPubnubMessageData UPubnubUtilities::UEMessageFromPubnubMessage(pubnub_v2_messag
 	return MessageData;
 }
 
+FPubnubNativeMessage UPubnubUtilities::NativeMessageFromPubnubMessage(const pubnub_v2_message& PubnubMessage, FPubnubMessageArena& Arena)
+{
+	auto ToView = [](const pubnub_char_mem_block& MemBlock)
+	{
+		return MemBlock.ptr && MemBlock.size > 0 ? FAnsiStringView(MemBlock.ptr, static_cast<int32>(MemBlock.size)) : FAnsiStringView();
+	};
+
+	FPubnubNativeMessage NativeMessage;
+	const FAnsiStringView Payload = ToView(PubnubMessage.payload);
+	const FAnsiStringView Metadata = ToView(PubnubMessage.metadata);
+	if(!Payload.IsEmpty() || !Metadata.IsEmpty())
+	{
+		NativeMessage.Block = Arena.Acquire(Payload.Len() + Metadata.Len());
+		NativeMessage.Payload = NativeMessage.Block->Append(Payload);
+		NativeMessage.Metadata = NativeMessage.Block->Append(Metadata);
+	}
+
+	FPubnubNameTable& NameTable = FPubnubNameTable::Get();
+	NativeMessage.Channel = NameTable.Intern(ToView(PubnubMessage.channel));
+	NativeMessage.UserID = NameTable.Intern(ToView(PubnubMessage.publisher));
+	NativeMessage.CustomMessageType = NameTable.Intern(ToView(PubnubMessage.custom_message_type));
+	NativeMessage.MatchOrGroup = NameTable.Intern(ToView(PubnubMessage.match_or_group));
+	NativeMessage.Timetoken = FPubnubNativeMessage::ParseTimetoken(ToView(PubnubMessage.tt));
+	NativeMessage.MessageType = (EPubnubMessageType)(PubnubMessage.message_type);
+	NativeMessage.bIsPresenceEvent = IsPresenceEventMessage(PubnubMessage);
+	return NativeMessage;
+}
+
+bool UPubnubUtilities::IsPresenceEventMessage(const pubnub_v2_message& PubnubMessage)
+{
+	static constexpr char PresenceSuffix[] = "-pnpres";
+	static constexpr size_t PresenceSuffixLength = sizeof(PresenceSuffix) - 1;
+
+	if(PubnubMessage.message_type != pbsbPublished || !PubnubMessage.channel.ptr || PubnubMessage.channel.size < PresenceSuffixLength)
+	{
+		return false;
+	}
+	return FMemory::Memcmp(PubnubMessage.channel.ptr + PubnubMessage.channel.size - PresenceSuffixLength, PresenceSuffix, PresenceSuffixLength) == 0;
+}
+
 FString UPubnubUtilities::MembershipIncludeToString(const FPubnubMembershipInclude& MembershipInclude)
 {
 	FString FinalString = "";
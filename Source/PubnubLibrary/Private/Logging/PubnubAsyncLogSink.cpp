@@ -0,0 +1,174 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Logging/PubnubAsyncLogSink.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/RunnableThread.h"
+
+
+void FPubnubLogRecord::SetCCoreField(ECCoreField Field, const char* Utf8Value)
+{
+	if(!Utf8Value)
+	{
+		return;
+	}
+
+	CCoreFieldOffsets[static_cast<int32>(Field)] = CCoreFields.Num();
+	CCoreFields.Append(Utf8Value, FCStringAnsi::Strlen(Utf8Value) + 1);
+}
+
+const char* FPubnubLogRecord::GetCCoreField(ECCoreField Field) const
+{
+	const int32 Offset = CCoreFieldOffsets[static_cast<int32>(Field)];
+	return Offset != INDEX_NONE ? CCoreFields.GetData() + Offset : "";
+}
+
+FPubnubAsyncLogSink::FPubnubAsyncLogSink(uint32 InQueueCapacity, FBatchHandler InBatchHandler)
+	: Queue(InQueueCapacity)
+	, BatchHandler(MoveTemp(InBatchHandler))
+{
+	Batch.Reserve(MaxBatchSize);
+	WakeUpEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	Thread = FRunnableThread::Create(this, TEXT("PubnubLogThread"), 0, TPri_BelowNormal);
+	ThreadId.store(Thread ? Thread->GetThreadID() : 0);
+}
+
+FPubnubAsyncLogSink::~FPubnubAsyncLogSink()
+{
+	Shutdown();
+	FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+	WakeUpEvent = nullptr;
+}
+
+bool FPubnubAsyncLogSink::Enqueue(FPubnubLogRecord&& Record)
+{
+	//Logger that logs from the sink thread would wait for itself if the queue was full
+	if(FPlatformTLS::GetCurrentThreadId() == ThreadId.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+	ActiveProducers.fetch_add(1);
+	if(!bAcceptingMessages.load())
+	{
+		ActiveProducers.fetch_sub(1);
+		return false;
+	}
+
+	const bool bImportant = static_cast<uint8>(Record.LogLevel) >= static_cast<uint8>(EPubnubLogLevel::PLL_Warning);
+	if(Queue.TryPush(MoveTemp(Record)))
+	{
+		EnqueuedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	else if(bImportant)
+	{
+		//Waits only a bounded time, so a stuck logger can't stall the thread that logs
+		BackpressureCount.fetch_add(1, std::memory_order_relaxed);
+		if(Queue.Push(MoveTemp(Record), MaxBackpressureWaitSeconds))
+		{
+			EnqueuedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+	else
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//Pairs with the fence in Run: either the sink thread sees the new message, or we see that it's going to sleep
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if(bSinkSleeping.load() && bSinkSleeping.exchange(false))
+	{
+		WakeUpEvent->Trigger();
+	}
+
+	ActiveProducers.fetch_sub(1);
+	return true;
+}
+
+void FPubnubAsyncLogSink::Shutdown()
+{
+	if(!Thread)
+	{
+		return;
+	}
+
+	bAcceptingMessages.store(false);
+	//Producers that already passed the check have to finish pushing, otherwise their messages would be lost
+	while(ActiveProducers.load() > 0)
+	{
+		FPlatformProcess::Yield();
+	}
+
+	//Sink thread dispatches everything that is still queued before it exits
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+	ThreadId.store(0);
+}
+
+FPubnubAsyncLogStats FPubnubAsyncLogSink::GetStats() const
+{
+	FPubnubAsyncLogStats Stats;
+	Stats.EnqueuedCount = EnqueuedCount.load(std::memory_order_relaxed);
+	Stats.DispatchedCount = DispatchedCount.load(std::memory_order_relaxed);
+	Stats.DroppedCount = DroppedCount.load(std::memory_order_relaxed);
+	Stats.BackpressureCount = BackpressureCount.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+uint32 FPubnubAsyncLogSink::Run()
+{
+	while(!bStopRequested.load())
+	{
+		if(DispatchBatch() > 0)
+		{
+			continue;
+		}
+
+		bSinkSleeping.store(true);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		//Message could have been pushed right before we announced we're going to sleep
+		if(DispatchBatch() > 0)
+		{
+			bSinkSleeping.store(false);
+			continue;
+		}
+		WakeUpEvent->Wait();
+		bSinkSleeping.store(false);
+	}
+
+	while(DispatchBatch() > 0)
+	{
+	}
+	return 0;
+}
+
+void FPubnubAsyncLogSink::Stop()
+{
+	bStopRequested.store(true);
+	WakeUpEvent->Trigger();
+}
+
+int32 FPubnubAsyncLogSink::DispatchBatch()
+{
+	Batch.Reset();
+	FPubnubLogRecord Record;
+	while(Batch.Num() < MaxBatchSize && Queue.TryPop(Record))
+	{
+		Batch.Add(MoveTemp(Record));
+	}
+
+	if(Batch.IsEmpty())
+	{
+		return 0;
+	}
+
+	BatchHandler(Batch);
+	DispatchedCount.fetch_add(Batch.Num(), std::memory_order_relaxed);
+	return Batch.Num();
+}
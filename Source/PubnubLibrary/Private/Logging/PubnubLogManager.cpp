@@ -1,21 +1,32 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "Logging/PubnubLogManager.h"
+#include "Logging/PubnubAsyncLogSink.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/GarbageCollection.h"
 #include "PubnubClient.h"
 
 
-static const TArray<FString> FalseCCoreLogPhrases = {
-	TEXT("errno=0('No error')"),
-	TEXT("errno=9('Bad file descriptor')"),
-	TEXT("errno=2('No such file or directory')"),
-	TEXT("errno=35('Resource temporarily unavailable')")
+std::atomic<uint32> UPubnubLogManager::LogLevelsEpoch{0};
+
+//Errno reports C-Core emits for normal non-blocking socket operation. They are not real errors, so they are never logged
+static const char* const FalseCCoreLogPhrases[] = {
+	"errno=0('No error')",
+	"errno=9('Bad file descriptor')",
+	"errno=2('No such file or directory')",
+	"errno=35('Resource temporarily unavailable')"
 };
 
-static bool ShouldCCoreLogBeSkipped(const FString& Message)
+static bool ContainsFalseCCoreLogPhrase(const char* Text)
 {
-	for (const FString& LogSkipPhrase : FalseCCoreLogPhrases)
+	if (!Text)
+	{
+		return false;
+	}
+
+	for (const char* LogSkipPhrase : FalseCCoreLogPhrases)
 	{
-		if (Message.Contains(LogSkipPhrase))
+		if (FCStringAnsi::Strstr(Text, LogSkipPhrase))
 		{
 			return true;
 		}
@@ -23,6 +34,61 @@ static bool ShouldCCoreLogBeSkipped(const FString& Message)
 	return false;
 }
 
+static bool LogValueContainsFalseCCoreLogPhrase(const pubnub_log_value_t* Value)
+{
+	if (!Value)
+	{
+		return false;
+	}
+
+	switch (pubnub_log_value_type(Value))
+	{
+	case PUBNUB_LOG_VALUE_STRING:
+		return ContainsFalseCCoreLogPhrase(pubnub_log_value_get_string(Value));
+	case PUBNUB_LOG_VALUE_MAP:
+	case PUBNUB_LOG_VALUE_ARRAY:
+		for (const pubnub_log_value_t* Element = pubnub_log_value_first(Value); Element != nullptr; Element = pubnub_log_value_next(Element))
+		{
+			if (LogValueContainsFalseCCoreLogPhrase(Element))
+			{
+				return true;
+			}
+		}
+		return false;
+	default:
+		return false;
+	}
+}
+
+//Checks raw UTF-8 fields of the message, so skipped messages are never converted to FString
+static bool ShouldCCoreLogBeSkipped(const pubnub_log_message_t* Message)
+{
+	switch (Message->message_type)
+	{
+	case PUBNUB_LOG_MESSAGE_TYPE_TEXT:
+		return ContainsFalseCCoreLogPhrase(reinterpret_cast<const pubnub_log_message_text_t*>(Message)->message);
+	case PUBNUB_LOG_MESSAGE_TYPE_ERROR:
+	{
+		const pubnub_log_message_error_t* ErrorMessage = reinterpret_cast<const pubnub_log_message_error_t*>(Message);
+		return ContainsFalseCCoreLogPhrase(ErrorMessage->error_message) || ContainsFalseCCoreLogPhrase(ErrorMessage->details);
+	}
+	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_REQUEST:
+	{
+		const pubnub_log_message_network_request_t* NetworkMessage = reinterpret_cast<const pubnub_log_message_network_request_t*>(Message);
+		return ContainsFalseCCoreLogPhrase(NetworkMessage->url) || ContainsFalseCCoreLogPhrase(NetworkMessage->details);
+	}
+	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_RESPONSE:
+		return ContainsFalseCCoreLogPhrase(reinterpret_cast<const pubnub_log_message_network_response_t*>(Message)->url);
+	case PUBNUB_LOG_MESSAGE_TYPE_OBJECT:
+	{
+		const pubnub_log_message_object_t* ObjectMessage = reinterpret_cast<const pubnub_log_message_object_t*>(Message);
+		return ContainsFalseCCoreLogPhrase(ObjectMessage->details) || LogValueContainsFalseCCoreLogPhrase(ObjectMessage->message);
+	}
+	default:
+		return false;
+	}
+}
+
 static EPubnubLogLevel ConvertCCoreLogLevel(const enum pubnub_log_level InLevel)
 {
 	switch (InLevel)
@@ -140,51 +206,83 @@ static FString BuildCCoreObjectMessage(const pubnub_log_message_object_t* Object
 	return Output;
 }
 
-static FString BuildCCoreLogMessage(const pubnub_log_message_t* Message)
+//Copies raw fields of C-Core message into the record, so it can be formatted later on the sink thread.
+//Structured object messages point to values owned by C-Core, so they are formatted right away
+static void FillCCoreLogRecord(const pubnub_log_message_t* Message, FPubnubLogRecord& OutRecord)
 {
-	if (!Message)
-	{
-		return TEXT("Unknown C-Core log message.");
-	}
+	typedef FPubnubLogRecord::ECCoreField ECCoreField;
+
+	OutRecord.SetCCoreField(ECCoreField::Location, Message->location);
+	OutRecord.SetCCoreField(ECCoreField::PubnubID, Message->pubnub_id);
 
 	switch (Message->message_type)
 	{
 	case PUBNUB_LOG_MESSAGE_TYPE_TEXT:
-	{
-		const pubnub_log_message_text_t* TextMessage = reinterpret_cast<const pubnub_log_message_text_t*>(Message);
-		return UTF8_TO_TCHAR(TextMessage->message ? TextMessage->message : "");
-	}
+		OutRecord.SetCCoreField(ECCoreField::Text, reinterpret_cast<const pubnub_log_message_text_t*>(Message)->message);
+		break;
 	case PUBNUB_LOG_MESSAGE_TYPE_ERROR:
 	{
 		const pubnub_log_message_error_t* ErrorMessage = reinterpret_cast<const pubnub_log_message_error_t*>(Message);
-		const FString MessageText = UTF8_TO_TCHAR(ErrorMessage->error_message ? ErrorMessage->error_message : "");
-		const FString DetailsText = UTF8_TO_TCHAR(ErrorMessage->details ? ErrorMessage->details : "");
-		return DetailsText.IsEmpty()
-			? FString::Printf(TEXT("Error %d: %s"), ErrorMessage->error_code, *MessageText)
-			: FString::Printf(TEXT("Error %d: %s (%s)"), ErrorMessage->error_code, *MessageText, *DetailsText);
+		OutRecord.SetCCoreField(ECCoreField::Text, ErrorMessage->error_message);
+		OutRecord.SetCCoreField(ECCoreField::Details, ErrorMessage->details);
+		OutRecord.CCoreCode = ErrorMessage->error_code;
+		break;
 	}
 	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_REQUEST:
 	{
 		const pubnub_log_message_network_request_t* NetworkMessage = reinterpret_cast<const pubnub_log_message_network_request_t*>(Message);
-		const FString Url = UTF8_TO_TCHAR(NetworkMessage->url ? NetworkMessage->url : "");
-		const FString Details = UTF8_TO_TCHAR(NetworkMessage->details ? NetworkMessage->details : "");
-		return Details.IsEmpty()
-			? FString::Printf(TEXT("Network request: %s"), *Url)
-			: FString::Printf(TEXT("Network request: %s (%s)"), *Url, *Details);
+		OutRecord.SetCCoreField(ECCoreField::Text, NetworkMessage->url);
+		OutRecord.SetCCoreField(ECCoreField::Details, NetworkMessage->details);
+		break;
 	}
 	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_RESPONSE:
 	{
 		const pubnub_log_message_network_response_t* NetworkResponse = reinterpret_cast<const pubnub_log_message_network_response_t*>(Message);
-		const FString Url = UTF8_TO_TCHAR(NetworkResponse->url ? NetworkResponse->url : "");
-		return FString::Printf(TEXT("Network response: %s status=%d"), *Url, NetworkResponse->status_code);
+		OutRecord.SetCCoreField(ECCoreField::Text, NetworkResponse->url);
+		OutRecord.CCoreCode = NetworkResponse->status_code;
+		break;
 	}
 	case PUBNUB_LOG_MESSAGE_TYPE_OBJECT:
+		OutRecord.Message = BuildCCoreObjectMessage(reinterpret_cast<const pubnub_log_message_object_t*>(Message));
+		return;
+	default:
+		OutRecord.Message = TEXT("Unknown C-Core log message type.");
+		return;
+	}
+	OutRecord.CCoreMessageType = Message->message_type;
+}
+
+static FString BuildCCoreLogMessage(const FPubnubLogRecord& Record)
+{
+	typedef FPubnubLogRecord::ECCoreField ECCoreField;
+
+	switch (Record.CCoreMessageType)
 	{
-		const pubnub_log_message_object_t* ObjectMessage = reinterpret_cast<const pubnub_log_message_object_t*>(Message);
-		return BuildCCoreObjectMessage(ObjectMessage);
+	case PUBNUB_LOG_MESSAGE_TYPE_TEXT:
+		return UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Text));
+	case PUBNUB_LOG_MESSAGE_TYPE_ERROR:
+	{
+		const FString MessageText = UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Text));
+		const FString DetailsText = UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Details));
+		return DetailsText.IsEmpty()
+			? FString::Printf(TEXT("Error %d: %s"), Record.CCoreCode, *MessageText)
+			: FString::Printf(TEXT("Error %d: %s (%s)"), Record.CCoreCode, *MessageText, *DetailsText);
+	}
+	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_REQUEST:
+	{
+		const FString Url = UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Text));
+		const FString Details = UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Details));
+		return Details.IsEmpty()
+			? FString::Printf(TEXT("Network request: %s"), *Url)
+			: FString::Printf(TEXT("Network request: %s (%s)"), *Url, *Details);
+	}
+	case PUBNUB_LOG_MESSAGE_TYPE_NETWORK_RESPONSE:
+	{
+		const FString Url = UTF8_TO_TCHAR(Record.GetCCoreField(ECCoreField::Text));
+		return FString::Printf(TEXT("Network response: %s status=%d"), *Url, Record.CCoreCode);
 	}
 	default:
-		return TEXT("Unknown C-Core log message type.");
+		return Record.Message;
 	}
 }
 
@@ -223,6 +321,7 @@ void UPubnubLogManager::AddLogger(const TScriptInterface<IPubnubLoggerInterface>
 		return;
 	}
 
+	FScopeLock Lock(&LoggersMutex);
 	for (const TObjectPtr<UObject>& ExistingLogger : LoggerObjects)
 	{
 		if (ExistingLogger == LoggerObject)
@@ -232,6 +331,7 @@ void UPubnubLogManager::AddLogger(const TScriptInterface<IPubnubLoggerInterface>
 	}
 
 	LoggerObjects.Add(LoggerObject);
+	RebuildDispatchTable();
 }
 
 void UPubnubLogManager::RemoveLogger(const TScriptInterface<IPubnubLoggerInterface>& Logger)
@@ -242,19 +342,24 @@ void UPubnubLogManager::RemoveLogger(const TScriptInterface<IPubnubLoggerInterfa
 		return;
 	}
 
+	FScopeLock Lock(&LoggersMutex);
 	LoggerObjects.RemoveAll([LoggerObject](const TObjectPtr<UObject>& Entry)
 	{
 		return Entry == LoggerObject;
 	});
+	RebuildDispatchTable();
 }
 
 void UPubnubLogManager::ClearLoggers()
 {
+	FScopeLock Lock(&LoggersMutex);
 	LoggerObjects.Reset();
+	RebuildDispatchTable();
 }
 
 TArray<TScriptInterface<IPubnubLoggerInterface>> UPubnubLogManager::GetLoggers() const
 {
+	FScopeLock Lock(&LoggersMutex);
 	TArray<TScriptInterface<IPubnubLoggerInterface>> Result;
 	Result.Reserve(LoggerObjects.Num());
 
@@ -280,49 +385,233 @@ void UPubnubLogManager::SetUESdkEmitterID(const FString& InEmitterID)
 	UESdkEmitterID = InEmitterID.IsEmpty() ? TEXT("PubNub-unknown") : InEmitterID;
 }
 
+EPubnubLogLevel UPubnubLogManager::GetMostVerboseEnabledLevel(EPubnubLogSource Source)
+{
+	for (uint8 Level = 0; Level < static_cast<uint8>(EPubnubLogLevel::PLL_None); ++Level)
+	{
+		if (IsLogEnabled(static_cast<EPubnubLogLevel>(Level), Source))
+		{
+			return static_cast<EPubnubLogLevel>(Level);
+		}
+	}
+	return EPubnubLogLevel::PLL_None;
+}
+
+void UPubnubLogManager::NotifyLogLevelsChanged()
+{
+	LogLevelsEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
 void UPubnubLogManager::Log(EPubnubLogLevel Level, EPubnubLogSource Source, const FString& Message, const FString& Callsite)
 {
-	if (Level == EPubnubLogLevel::PLL_None)
+	if (!IsLogEnabled(Level, Source))
 	{
 		return;
 	}
 
-	FPubnubLogMessage PubnubLogMessage;
-	PubnubLogMessage.LogLevel = Level;
-	PubnubLogMessage.Source = Source;
-	PubnubLogMessage.Message = Message;
-	PubnubLogMessage.TimestampUtc = FDateTime::UtcNow();
-	PubnubLogMessage.Callsite = Callsite;
-	PubnubLogMessage.PubnubInstanceID = Source == EPubnubLogSource::PLS_CCore ? TEXT("PubNub-unknown") : UESdkEmitterID;
-	DispatchMessage(PubnubLogMessage);
+	FPubnubLogRecord Record;
+	Record.LogLevel = Level;
+	Record.Source = Source;
+	Record.Message = Message;
+	Record.TimestampUtc = FDateTime::UtcNow();
+	Record.Callsite = Callsite;
+	SubmitRecord(MoveTemp(Record));
+}
+
+void UPubnubLogManager::EnableAsyncDispatch(int32 QueueCapacity)
+{
+	if (AsyncSink.load())
+	{
+		return;
+	}
+
+	//Records are turned into messages here, on the sink thread, so threads that log don't format anything
+	FPubnubAsyncLogSink* Sink = new FPubnubAsyncLogSink(FMath::Max(QueueCapacity, 64), [this](TArrayView<const FPubnubLogRecord> Records)
+	{
+		for (const FPubnubLogRecord& Record : Records)
+		{
+			DispatchMessage(BuildLogMessage(Record));
+		}
+	});
+	AsyncSink.store(Sink);
+}
+
+void UPubnubLogManager::DisableAsyncDispatch()
+{
+	if (FPubnubAsyncLogSink* Sink = AsyncSink.load())
+	{
+		Sink->Shutdown();
+	}
+}
+
+FPubnubAsyncLogStats UPubnubLogManager::GetAsyncLogStats() const
+{
+	const FPubnubAsyncLogSink* Sink = AsyncSink.load();
+	return Sink ? Sink->GetStats() : FPubnubAsyncLogStats();
+}
+
+void UPubnubLogManager::BeginDestroy()
+{
+	if (FPubnubAsyncLogSink* Sink = AsyncSink.exchange(nullptr))
+	{
+		//Threads that loaded the sink before it was cleared are still using it
+		while (ActiveSubmitters.load() > 0)
+		{
+			FPlatformProcess::Yield();
+		}
+		Sink->Shutdown();
+		delete Sink;
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPubnubLogManager::SubmitRecord(FPubnubLogRecord&& Record)
+{
+	//Counted before the sink is loaded, so BeginDestroy can't delete the sink while this thread is using it
+	ActiveSubmitters.fetch_add(1);
+	FPubnubAsyncLogSink* Sink = AsyncSink.load();
+	//Sink refuses records when it's shut down or when a logger logs from the sink thread - these are dispatched right away
+	const bool bQueued = Sink && Sink->Enqueue(MoveTemp(Record));
+	ActiveSubmitters.fetch_sub(1);
+
+	if (!bQueued)
+	{
+		DispatchMessage(BuildLogMessage(Record));
+	}
+}
+
+FPubnubLogMessage UPubnubLogManager::BuildLogMessage(const FPubnubLogRecord& Record) const
+{
+	FPubnubLogMessage Message;
+	Message.LogLevel = Record.LogLevel;
+	Message.Source = Record.Source;
+	Message.TimestampUtc = Record.TimestampUtc;
+	if (Record.Source == EPubnubLogSource::PLS_CCore)
+	{
+		Message.Message = BuildCCoreLogMessage(Record);
+		const char* Location = Record.GetCCoreField(FPubnubLogRecord::ECCoreField::Location);
+		Message.Callsite = *Location ? FString(UTF8_TO_TCHAR(Location)) : Record.Callsite;
+		Message.PubnubInstanceID = NormalizeCCoreEmitterID(Record.GetCCoreField(FPubnubLogRecord::ECCoreField::PubnubID));
+	}
+	else
+	{
+		Message.Message = Record.Message;
+		Message.Callsite = Record.Callsite;
+		Message.PubnubInstanceID = UESdkEmitterID;
+	}
+	return Message;
 }
 
 void UPubnubLogManager::DispatchMessage(const FPubnubLogMessage& Message)
 {
-	for (int32 Index = LoggerObjects.Num() - 1; Index >= 0; --Index)
+	TSharedPtr<const TArray<FLoggerDispatchEntry>, ESPMode::ThreadSafe> Table;
 	{
-		UObject* LoggerObject = LoggerObjects[Index].Get();
-		if (!LoggerObject
-			|| !IsValid(LoggerObject)
-			|| LoggerObject->IsUnreachable()
-			|| LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed)
-			|| !LoggerObject->GetClass()->ImplementsInterface(UPubnubLoggerInterface::StaticClass()))
+		FScopeLock Lock(&LoggersMutex);
+		if (CachedLevelsEpoch.load(std::memory_order_acquire) != LogLevelsEpoch.load(std::memory_order_acquire))
 		{
-			LoggerObjects.RemoveAt(Index);
-			continue;
+			RebuildDispatchTable();
 		}
+		Table = DispatchTable;
+	}
 
-		const EPubnubLogLevel MinimumLevel = Message.Source == EPubnubLogSource::PLS_CCore
-			? IPubnubLoggerInterface::Execute_GetMinimumCCoreLogLevel(LoggerObject)
-			: IPubnubLoggerInterface::Execute_GetMinimumLogLevel(LoggerObject);
+	if (!Table)
+	{
+		return;
+	}
+
+	const uint8 LevelBit = LevelMaskBit(Message.LogLevel);
+	const int32 SourceIndex = static_cast<int32>(Message.Source);
+	bool AnyLoggerInvalid = false;
+
+	//Loggers are called without the lock, so a slow logger doesn't block other threads and a logger can add or remove loggers.
+	//Changes made meanwhile are used from the next message
+	for (const FLoggerDispatchEntry& Entry : *Table)
+	{
+		if (!(Entry.LevelMask[SourceIndex] & LevelBit))
+		{
+			continue;
+		}
 
-		if (!IsLevelEnabled(Message.LogLevel, MinimumLevel))
+		//GC can't run while the guard is held, so the resolved logger stays alive for the whole call. No-op on the game thread, where GC runs
+		FGCScopeGuard GCGuard;
+		UObject* LoggerObject = Entry.Object.Get(/*bEvenIfPendingKill*/false);
+		if (!IsValid(LoggerObject) || LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed))
 		{
+			AnyLoggerInvalid = true;
 			continue;
 		}
 
-		DispatchLevelSpecific(LoggerObject, Message.LogLevel, Message);
+		DispatchLevelSpecific(Entry, LoggerObject, Message.LogLevel, Message);
+	}
+
+	if (AnyLoggerInvalid)
+	{
+		RebuildDispatchTable();
+	}
+}
+
+void UPubnubLogManager::RebuildDispatchTable()
+{
+	FScopeLock Lock(&LoggersMutex);
+
+	//Take the epoch first, so a level change that happens during the rebuild triggers another one
+	const uint32 Epoch = LogLevelsEpoch.load(std::memory_order_acquire);
+
+	LoggerObjects.RemoveAll([](const TObjectPtr<UObject>& Entry)
+	{
+		UObject* LoggerObject = Entry.Get();
+		return !IsValid(LoggerObject)
+			|| LoggerObject->IsUnreachable()
+			|| LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed)
+			|| !LoggerObject->GetClass()->ImplementsInterface(UPubnubLoggerInterface::StaticClass());
+	});
+
+	uint8 UEMask = 0;
+	uint8 CCoreMask = 0;
+	TSharedRef<TArray<FLoggerDispatchEntry>, ESPMode::ThreadSafe> NewTable = MakeShared<TArray<FLoggerDispatchEntry>, ESPMode::ThreadSafe>();
+	NewTable->Reserve(LoggerObjects.Num());
+
+	//Most recently added loggers are called first
+	for (int32 Index = LoggerObjects.Num() - 1; Index >= 0; --Index)
+	{
+		UObject* LoggerObject = LoggerObjects[Index].Get();
+
+		FLoggerDispatchEntry Entry;
+		Entry.Object = LoggerObject;
+		//Blueprint classes can override logger events, so they have to go through Execute_ thunks
+		if (LoggerObject->GetClass()->HasAnyClassFlags(CLASS_Native))
+		{
+			Entry.NativeInterface = Cast<IPubnubLoggerInterface>(LoggerObject);
+		}
+		Entry.LevelMask[static_cast<int32>(EPubnubLogSource::PLS_UE)] = LevelsFromMinimum(IPubnubLoggerInterface::Execute_GetMinimumLogLevel(LoggerObject));
+		Entry.LevelMask[static_cast<int32>(EPubnubLogSource::PLS_CCore)] = LevelsFromMinimum(IPubnubLoggerInterface::Execute_GetMinimumCCoreLogLevel(LoggerObject));
+
+		UEMask |= Entry.LevelMask[static_cast<int32>(EPubnubLogSource::PLS_UE)];
+		CCoreMask |= Entry.LevelMask[static_cast<int32>(EPubnubLogSource::PLS_CCore)];
+		NewTable->Add(Entry);
 	}
+	DispatchTable = NewTable;
+
+	EnabledLevelsMask[static_cast<int32>(EPubnubLogSource::PLS_UE)].store(UEMask, std::memory_order_relaxed);
+	EnabledLevelsMask[static_cast<int32>(EPubnubLogSource::PLS_CCore)].store(CCoreMask, std::memory_order_relaxed);
+	CachedLevelsEpoch.store(Epoch, std::memory_order_release);
+	NextLevelsRefreshCycles.store(FPlatformTime::Cycles64() + static_cast<uint64>(LevelsRefreshIntervalSeconds / FPlatformTime::GetSecondsPerCycle64()), std::memory_order_relaxed);
+}
+
+void UPubnubLogManager::RefreshCachedLevels()
+{
+	if (CachedLevelsEpoch.load(std::memory_order_acquire) == LogLevelsEpoch.load(std::memory_order_acquire))
+	{
+		//Periodic refresh - the thread that pushes the deadline forward does it, the rest keeps using the current cache
+		uint64 NextRefreshCycles = NextLevelsRefreshCycles.load(std::memory_order_relaxed);
+		const uint64 NowCycles = FPlatformTime::Cycles64();
+		if (NowCycles < NextRefreshCycles || !NextLevelsRefreshCycles.compare_exchange_strong(NextRefreshCycles, MAX_uint64, std::memory_order_relaxed))
+		{
+			return;
+		}
+	}
+	RebuildDispatchTable();
 }
 
 void UPubnubLogManager::HandleCCoreLog(const pubnub_log_message_t* Message)
@@ -332,30 +621,29 @@ void UPubnubLogManager::HandleCCoreLog(const pubnub_log_message_t* Message)
 		return;
 	}
 
-	const FString MessageText = BuildCCoreLogMessage(Message);
-	if (ShouldCCoreLogBeSkipped(MessageText))
+	//Both filters work on raw C-Core data, so nothing is converted or formatted for messages that are not logged
+	const EPubnubLogLevel Level = ConvertCCoreLogLevel(Message->level);
+	if (!IsLogEnabled(Level, EPubnubLogSource::PLS_CCore) || ShouldCCoreLogBeSkipped(Message))
 	{
 		return;
 	}
 
-	FPubnubLogMessage PubnubLogMessage;
-	PubnubLogMessage.LogLevel = ConvertCCoreLogLevel(Message->level);
-	PubnubLogMessage.Source = EPubnubLogSource::PLS_CCore;
-	PubnubLogMessage.Message = MessageText;
-	PubnubLogMessage.Callsite = UTF8_TO_TCHAR(Message->location ? Message->location : "");
-	PubnubLogMessage.PubnubInstanceID = NormalizeCCoreEmitterID(Message->pubnub_id);
+	FPubnubLogRecord Record;
+	Record.LogLevel = Level;
+	Record.Source = EPubnubLogSource::PLS_CCore;
+	FillCCoreLogRecord(Message, Record);
 
 	if (Message->timestamp.seconds > 0)
 	{
-		PubnubLogMessage.TimestampUtc = FDateTime::FromUnixTimestamp(static_cast<int64>(Message->timestamp.seconds))
+		Record.TimestampUtc = FDateTime::FromUnixTimestamp(static_cast<int64>(Message->timestamp.seconds))
 			+ FTimespan::FromMilliseconds(static_cast<double>(Message->timestamp.milliseconds));
 	}
 	else
 	{
-		PubnubLogMessage.TimestampUtc = FDateTime::UtcNow();
+		Record.TimestampUtc = FDateTime::UtcNow();
 	}
 
-	DispatchMessage(PubnubLogMessage);
+	SubmitRecord(MoveTemp(Record));
 }
 
 const pubnub_logger_interface& UPubnubLogManager::GetCCoreLoggerInterface()
@@ -374,23 +662,37 @@ const pubnub_logger_interface& UPubnubLogManager::GetCCoreLoggerInterface()
 	return LoggerInterface;
 }
 
-bool UPubnubLogManager::IsLevelEnabled(EPubnubLogLevel MessageLevel, EPubnubLogLevel MinimumLevel)
+uint8 UPubnubLogManager::LevelsFromMinimum(EPubnubLogLevel MinimumLevel)
 {
-	if (MinimumLevel == EPubnubLogLevel::PLL_None)
-	{
-		return false;
-	}
-
-	return static_cast<uint8>(MessageLevel) >= static_cast<uint8>(MinimumLevel);
+	//PLL_None shifts all bits out, so nothing is enabled
+	return static_cast<uint8>((AllLevelsMask << static_cast<uint8>(MinimumLevel)) & AllLevelsMask);
 }
 
-void UPubnubLogManager::DispatchLevelSpecific(UObject* LoggerObject, EPubnubLogLevel Level, const FPubnubLogMessage& Message)
+void UPubnubLogManager::DispatchLevelSpecific(const FLoggerDispatchEntry& Entry, UObject* LoggerObject, EPubnubLogLevel Level, const FPubnubLogMessage& Message)
 {
-	if (!LoggerObject
-		|| !IsValid(LoggerObject)
-		|| LoggerObject->IsUnreachable()
-		|| LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed))
+	if (IPubnubLoggerInterface* NativeLogger = Entry.NativeInterface)
 	{
+		switch (Level)
+		{
+		case EPubnubLogLevel::PLL_Trace:
+			NativeLogger->LogTrace_Implementation(Message);
+			break;
+		case EPubnubLogLevel::PLL_Debug:
+			NativeLogger->LogDebug_Implementation(Message);
+			break;
+		case EPubnubLogLevel::PLL_Info:
+			NativeLogger->LogInfo_Implementation(Message);
+			break;
+		case EPubnubLogLevel::PLL_Warning:
+			NativeLogger->LogWarning_Implementation(Message);
+			break;
+		case EPubnubLogLevel::PLL_Error:
+			NativeLogger->LogError_Implementation(Message);
+			break;
+		case EPubnubLogLevel::PLL_None:
+		default:
+			break;
+		}
 		return;
 	}
 
@@ -1,6 +1,7 @@
 // Copyright 2026 PubNub Inc. All Rights Reserved.
 
 #include "PubnubBaseLogger.h"
+#include "Logging/PubnubLogManager.h"
 
 void UPubnubBaseLogger::Log_Implementation(const FPubnubLogMessage& LogMessage)
 {
@@ -34,6 +35,7 @@ void UPubnubBaseLogger::LogError_Implementation(const FPubnubLogMessage& LogMess
 void UPubnubBaseLogger::SetMinimumLogLevel_Implementation(EPubnubLogLevel InLevel)
 {
 	MinimumLogLevel = InLevel;
+	UPubnubLogManager::NotifyLogLevelsChanged();
 }
 
 EPubnubLogLevel UPubnubBaseLogger::GetMinimumLogLevel_Implementation() const
@@ -44,6 +46,7 @@ EPubnubLogLevel UPubnubBaseLogger::GetMinimumLogLevel_Implementation() const
 void UPubnubBaseLogger::SetMinimumCCoreLogLevel_Implementation(EPubnubLogLevel InLevel)
 {
 	MinimumCCoreLogLevel = InLevel;
+	UPubnubLogManager::NotifyLogLevelsChanged();
 }
 
 EPubnubLogLevel UPubnubBaseLogger::GetMinimumCCoreLogLevel_Implementation() const
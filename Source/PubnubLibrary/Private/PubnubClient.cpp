@@ -7,9 +7,13 @@
 #include "PubnubSubsystem.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "Threads/PubnubFunctionThread.h"
+#include "Threads/PubnubContextPool.h"
+#include "AccessManager/PubnubTokenCache.h"
+#include "Async/Async.h"
 #include "FunctionLibraries/PubnubUtilities.h"
 #include "FunctionLibraries/PubnubInternalUtilities.h"
 #include "FunctionLibraries/PubnubTokenUtilities.h"
+#include "FunctionLibraries/PubnubCryptoUtilities.h"
 #include "PubnubDefaultLogger.h"
 #include "Logging/PubnubLogManager.h"
 #include "Entities/PubnubBaseEntity.h"
@@ -18,6 +22,7 @@
 #include "Entities/PubnubChannelMetadataEntity.h"
 #include "Entities/PubnubUserMetadataEntity.h"
 #include "Entities/PubnubSubscription.h"
+#include "Entities/PubnubCCoreEntityCache.h"
 #include "core/pubnub_logger.h"
 
 
@@ -25,8 +30,90 @@ struct CCoreSubscriptionCallback
 {
 	pubnub_subscribe_message_callback_t Callback;
 	pubnub_subscription_t* Subscription;
+	//Set this subscription was subscribed with, together with other global subscriptions. nullptr if it was subscribed on its own
+	pubnub_subscription_set_t* SubscriptionSet = nullptr;
+	//Subscribe settings the subscription was made with. Filter expression is not here - it's shared by the whole subscribe loop
+	bool bReceivePresenceEvents = false;
+
+	//Listener of all global subscriptions, triggered by the c-core event engine
+	static void OnClientMessage(const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
+	{
+		//User data holds its own reference to the queue, so it doesn't matter if the client released it in the meantime
+		const FPubnubInternalClientListenerUserData* ListenerUserData = static_cast<const FPubnubInternalClientListenerUserData*>(user_data);
+		if(!ListenerUserData || !ListenerUserData->MessageQueue)
+		{return;}
+
+		FPubnubReceivedMessageQueue& Queue = *ListenerUserData->MessageQueue;
+		FPubnubReceivedMessage Received;
+		Received.Message = UPubnubUtilities::NativeMessageFromPubnubMessage(message, *Queue.MessageArena);
+		Received.bForClient = true;
+		Queue.Enqueue(MoveTemp(Received));
+	}
 };
 
+template<typename ResultType>
+ResultType UPubnubClient::RunWithRetry_priv(TFunctionRef<ResultType(int32, float*)> Attempt)
+{
+	for(int32 RetriesDone = 0; ; RetriesDone++)
+	{
+		float RetryDelaySeconds = -1.0f;
+		ResultType Result = Attempt(RetriesDone, &RetryDelaySeconds);
+		if(RetryDelaySeconds < 0.0f)
+		{
+			return Result;
+		}
+
+		//Sync function blocks its caller anyway. Waited in short steps, so deinitialization doesn't wait for the whole delay
+		double RemainingSeconds = RetryDelaySeconds;
+		while(RemainingSeconds > 0.0 && IsInitialized.load(std::memory_order_acquire))
+		{
+			const double StepSeconds = FMath::Min(RemainingSeconds, 0.05);
+			FPlatformProcess::Sleep(static_cast<float>(StepSeconds));
+			RemainingSeconds -= StepSeconds;
+		}
+		if(!IsInitialized.load(std::memory_order_acquire))
+		{
+			return Result;
+		}
+	}
+}
+
+template<typename ResultType>
+void UPubnubClient::RunWithRetryAsync_priv(EPubnubOperationClass OperationClass, TFunction<ResultType(int32, float*)> Attempt, TFunction<void(const ResultType&)> OnFinished, int32 RetriesDone)
+{
+	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
+
+	PubnubCallsThread->AddFunctionToQueue( [WeakThis, OperationClass, Attempt = MoveTemp(Attempt), OnFinished = MoveTemp(OnFinished), RetriesDone]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		float RetryDelaySeconds = -1.0f;
+		ResultType Result = Attempt(RetriesDone, &RetryDelaySeconds);
+		if(RetryDelaySeconds < 0.0f)
+		{
+			OnFinished(Result);
+			return;
+		}
+
+		//One-shot ticker queues the next attempt after the delay, so the calls thread keeps running other operations meanwhile
+		UPubnubClient* ThisClient = WeakThis.Get();
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(ThisClient, [ThisClient, OperationClass, Attempt, OnFinished, RetriesDone, Result](float DeltaTime)
+		{
+			if(ThisClient->IsInitialized.load(std::memory_order_acquire) && ThisClient->PubnubCallsThread)
+			{
+				ThisClient->RunWithRetryAsync_priv<ResultType>(OperationClass, Attempt, OnFinished, RetriesDone + 1);
+			}
+			else
+			{
+				//Client was deinitialized during the delay, so the last failure is the final result
+				OnFinished(Result);
+			}
+			return false;
+		}), RetryDelaySeconds);
+	}, OperationClass);
+}
+
 void UPubnubClient::DestroyClient()
 {
 	if(!PubnubSubsystem)
@@ -65,7 +152,10 @@ FPubnubPublishMessageResult UPubnubClient::PublishMessage(FString Channel, FStri
 	PUBNUB_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	
-	return PublishMessage_priv(Channel, Message, PublishSettings);
+	return RunWithRetry_priv<FPubnubPublishMessageResult>([&](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return PublishMessage_priv(Channel, Message, PublishSettings, RetriesDone, OutRetryDelaySeconds);
+	});
 }
 
 void UPubnubClient::PublishMessageAsync(FString Channel, FString Message, FOnPubnubPublishMessageResponse OnPublishMessageResponse, FPubnubPublishSettings PublishSettings)
@@ -85,13 +175,12 @@ void UPubnubClient::PublishMessageAsync(FString Channel, FString Message, FOnPub
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, Message, NativeCallback, PublishSettings]
+	RunWithRetryAsync_priv<FPubnubPublishMessageResult>(EPubnubOperationClass::Publish, [WeakThis, Channel, Message, PublishSettings](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return WeakThis.Get()->PublishMessage_priv(Channel, Message, PublishSettings, RetriesDone, OutRetryDelaySeconds);
+	},
+	[NativeCallback](const FPubnubPublishMessageResult& PublishMessageResult)
 	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubPublishMessageResult PublishMessageResult = WeakThis.Get()->PublishMessage_priv(Channel, Message, PublishSettings);
-
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, PublishMessageResult.Result, PublishMessageResult.PublishedMessage);
 	});
@@ -103,13 +192,53 @@ void UPubnubClient::PublishMessageAsync(FString Channel, FString Message, FPubnu
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, Message, PublishSettings]
+	RunWithRetryAsync_priv<FPubnubPublishMessageResult>(EPubnubOperationClass::Publish, [WeakThis, Channel, Message, PublishSettings](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return WeakThis.Get()->PublishMessage_priv(Channel, Message, PublishSettings, RetriesDone, OutRetryDelaySeconds);
+	},
+	[](const FPubnubPublishMessageResult& PublishMessageResult) {});
+}
+
+TArray<FPubnubPublishMessageResult> UPubnubClient::PublishBatch(const TArray<FPubnubPublishRequest>& Requests)
+{
+	PUBNUB_RETURN_WRAPPER_ARRAY_IF_NOT_INITIALIZED(FPubnubPublishMessageResult, Requests.Num());
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	
+	return PublishBatch_priv(Requests);
+}
+
+void UPubnubClient::PublishBatchAsync(const TArray<FPubnubPublishRequest>& Requests, FOnPubnubPublishBatchResponse OnPublishBatchResponse)
+{
+	FOnPubnubPublishBatchResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnPublishBatchResponse](const TArray<FPubnubPublishMessageResult>& Results)
+	{
+		OnPublishBatchResponse.ExecuteIfBound(Results);
+	});
+
+	PublishBatchAsync(Requests, NativeCallback);
+}
+
+void UPubnubClient::PublishBatchAsync(const TArray<FPubnubPublishRequest>& Requests, FOnPubnubPublishBatchResponseNative NativeCallback)
+{
+	if(!IsInitialized || !PubnubCallsThread)
+	{
+		//Sync version fills the error for every request and doesn't touch the client
+		UPubnubUtilities::CallPubnubDelegate(NativeCallback, PublishBatch(Requests));
+		return;
+	}
+	
+	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
+
+	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Requests, NativeCallback]
 	{
 		if(!WeakThis.IsValid())
 		{return;}
 		
-		WeakThis.Get()->PublishMessage_priv(Channel, Message, PublishSettings);
-	});
+		TArray<FPubnubPublishMessageResult> Results = WeakThis.Get()->PublishBatch_priv(Requests);
+
+		//Execute provided delegate with results of the whole batch
+		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Results);
+	}, EPubnubOperationClass::Publish);
 }
 
 FPubnubSignalResult UPubnubClient::Signal(FString Channel, FString Message, FPubnubSignalSettings SignalSettings)
@@ -118,7 +247,10 @@ FPubnubSignalResult UPubnubClient::Signal(FString Channel, FString Message, FPub
 	PUBNUB_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	
-	return Signal_priv(Channel, Message, SignalSettings);
+	return RunWithRetry_priv<FPubnubSignalResult>([&](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return Signal_priv(Channel, Message, SignalSettings, RetriesDone, OutRetryDelaySeconds);
+	});
 }
 
 void UPubnubClient::SignalAsync(FString Channel, FString Message, FOnPubnubSignalResponse OnSignalResponse, FPubnubSignalSettings SignalSettings)
@@ -138,13 +270,12 @@ void UPubnubClient::SignalAsync(FString Channel, FString Message, FOnPubnubSigna
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, Message, NativeCallback, SignalSettings]
+	RunWithRetryAsync_priv<FPubnubSignalResult>(EPubnubOperationClass::Publish, [WeakThis, Channel, Message, SignalSettings](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return WeakThis.Get()->Signal_priv(Channel, Message, SignalSettings, RetriesDone, OutRetryDelaySeconds);
+	},
+	[NativeCallback](const FPubnubSignalResult& SignalResult)
 	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubSignalResult SignalResult = WeakThis.Get()->Signal_priv(Channel, Message, SignalSettings);
-
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SignalResult.Result, SignalResult.SignalMessage);
 	});
@@ -156,13 +287,11 @@ void UPubnubClient::SignalAsync(FString Channel, FString Message, FPubnubSignalS
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, Message, SignalSettings]
+	RunWithRetryAsync_priv<FPubnubSignalResult>(EPubnubOperationClass::Publish, [WeakThis, Channel, Message, SignalSettings](int32 RetriesDone, float* OutRetryDelaySeconds)
 	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		WeakThis.Get()->Signal_priv(Channel, Message, SignalSettings);
-	});
+		return WeakThis.Get()->Signal_priv(Channel, Message, SignalSettings, RetriesDone, OutRetryDelaySeconds);
+	},
+	[](const FPubnubSignalResult& SignalResult) {});
 }
 
 FPubnubOperationResult UPubnubClient::SubscribeToChannel(FString Channel, FPubnubSubscribeSettings SubscribeSettings)
@@ -187,19 +316,13 @@ void UPubnubClient::SubscribeToChannelAsync(FString Channel, FOnPubnubSubscribeO
 void UPubnubClient::SubscribeToChannelAsync(FString Channel, FOnPubnubSubscribeOperationResponseNative NativeCallback, FPubnubSubscribeSettings SubscribeSettings)
 {
 	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
-	
-	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
-
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, NativeCallback, SubscribeSettings]
-	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubOperationResult SubscribeResult = WeakThis.Get()->SubscribeToChannel_priv(Channel, SubscribeSettings);
 
-		//Execute provided delegate with results
-		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SubscribeResult);
-	});
+	FQueuedSubscriptionChange Change;
+	Change.ChannelsToAdd.Add(Channel);
+	Change.SubscribeSettings = SubscribeSettings;
+	Change.Callback = NativeCallback;
+	Change.bSingleEntity = true;
+	QueueSubscriptionChange(MoveTemp(Change));
 }
 
 void UPubnubClient::SubscribeToChannelAsync(FString Channel, FPubnubSubscribeSettings SubscribeSettings)
@@ -230,19 +353,13 @@ void UPubnubClient::SubscribeToGroupAsync(FString ChannelGroup, FOnPubnubSubscri
 void UPubnubClient::SubscribeToGroupAsync(FString ChannelGroup, FOnPubnubSubscribeOperationResponseNative NativeCallback, FPubnubSubscribeSettings SubscribeSettings)
 {
 	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
-	
-	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
-
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, ChannelGroup, NativeCallback, SubscribeSettings]
-	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubOperationResult SubscribeResult = WeakThis.Get()->SubscribeToGroup_priv(ChannelGroup, SubscribeSettings);
 
-		//Execute provided delegate with results
-		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SubscribeResult);
-	});
+	FQueuedSubscriptionChange Change;
+	Change.ChannelGroupsToAdd.Add(ChannelGroup);
+	Change.SubscribeSettings = SubscribeSettings;
+	Change.Callback = NativeCallback;
+	Change.bSingleEntity = true;
+	QueueSubscriptionChange(MoveTemp(Change));
 }
 
 void UPubnubClient::SubscribeToGroupAsync(FString ChannelGroup, FPubnubSubscribeSettings SubscribeSettings)
@@ -273,19 +390,12 @@ void UPubnubClient::UnsubscribeFromChannelAsync(FString Channel, FOnPubnubSubscr
 void UPubnubClient::UnsubscribeFromChannelAsync(FString Channel, FOnPubnubSubscribeOperationResponseNative NativeCallback)
 {
 	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
-	
-	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, NativeCallback]
-	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubOperationResult UnsubscribeResult = WeakThis.Get()->UnsubscribeFromChannel_priv(Channel);
-
-		//Execute provided delegate with results
-		UPubnubUtilities::CallPubnubDelegate(NativeCallback, UnsubscribeResult);
-	});
+	FQueuedSubscriptionChange Change;
+	Change.ChannelsToRemove.Add(Channel);
+	Change.Callback = NativeCallback;
+	Change.bSingleEntity = true;
+	QueueSubscriptionChange(MoveTemp(Change));
 }
 
 FPubnubOperationResult UPubnubClient::UnsubscribeFromGroup(FString ChannelGroup)
@@ -309,19 +419,12 @@ void UPubnubClient::UnsubscribeFromGroupAsync(FString ChannelGroup, FOnPubnubSub
 void UPubnubClient::UnsubscribeFromGroupAsync(FString ChannelGroup, FOnPubnubSubscribeOperationResponseNative NativeCallback)
 {
 	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
-	
-	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
-
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, ChannelGroup, NativeCallback]
-	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubOperationResult UnsubscribeResult = WeakThis.Get()->UnsubscribeFromGroup_priv(ChannelGroup);
 
-		//Execute provided delegate with results
-		UPubnubUtilities::CallPubnubDelegate(NativeCallback, UnsubscribeResult);
-	});
+	FQueuedSubscriptionChange Change;
+	Change.ChannelGroupsToRemove.Add(ChannelGroup);
+	Change.Callback = NativeCallback;
+	Change.bSingleEntity = true;
+	QueueSubscriptionChange(MoveTemp(Change));
 }
 
 FPubnubOperationResult UPubnubClient::UnsubscribeFromAll()
@@ -345,6 +448,9 @@ void UPubnubClient::UnsubscribeFromAllAsync(FOnPubnubSubscribeOperationResponse
 void UPubnubClient::UnsubscribeFromAllAsync(FOnPubnubSubscribeOperationResponseNative NativeCallback)
 {
 	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
+
+	//Subscriptions requested before this call can't be left for later, they would survive unsubscribing from all
+	ExpediteQueuedSubscriptionChanges();
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
@@ -357,7 +463,207 @@ void UPubnubClient::UnsubscribeFromAllAsync(FOnPubnubSubscribeOperationResponseN
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, UnsubscribeResult);
+	}, EPubnubOperationClass::StateChange);
+}
+
+int UPubnubClient::BindChannelHandler(FString Channel, FOnPubnubChannelMessage Handler, bool ReceivePresenceEvents)
+{
+	FOnPubnubChannelMessageNative NativeHandler;
+	NativeHandler.BindLambda([Handler](const FPubnubMessageData& Message, bool IsPresenceEvent)
+	{
+		Handler.ExecuteIfBound(Message, IsPresenceEvent);
+	});
+
+	return BindChannelHandler(Channel, NativeHandler, ReceivePresenceEvents);
+}
+
+int UPubnubClient::BindChannelHandler(FString Channel, FOnPubnubChannelMessageNative NativeHandler, bool ReceivePresenceEvents)
+{
+	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED(INDEX_NONE);
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	PUBNUB_RETURN_IF_FIELD_EMPTY(Channel, INDEX_NONE);
+
+	if(!NativeHandler.IsBound())
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(TEXT("Handler is not bound, nothing to call for the channel."));
+		return INDEX_NONE;
+	}
+
+	TSharedRef<FChannelHandler, ESPMode::ThreadSafe> ChannelHandler = MakeShared<FChannelHandler, ESPMode::ThreadSafe>();
+	ChannelHandler->Handler = MoveTemp(NativeHandler);
+	ChannelHandler->bReceivePresenceEvents = ReceivePresenceEvents;
+
+	FScopeLock ChannelHandlersLock(&ChannelHandlersMutex);
+	const int32 HandlerID = NextChannelHandlerID++;
+	ChannelHandlerIndex.Add(HandlerID, Channel);
+	ChannelHandlers.Add(HandlerID, ChannelHandler);
+	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("channel handler bound. HandlerID=%d, Channel=%s"), HandlerID, *Channel));
+	return HandlerID;
+}
+
+bool UPubnubClient::UnbindChannelHandler(int HandlerID)
+{
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+
+	FScopeLock ChannelHandlersLock(&ChannelHandlersMutex);
+	TSharedPtr<FChannelHandler, ESPMode::ThreadSafe> ChannelHandler;
+	if(!ChannelHandlers.RemoveAndCopyValue(HandlerID, ChannelHandler))
+	{
+		return false;
+	}
+	ChannelHandler->bIsBound = false;
+	ChannelHandlerIndex.Remove(HandlerID);
+	return true;
+}
+
+void UPubnubClient::UnbindAllChannelHandlers()
+{
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+
+	FScopeLock ChannelHandlersLock(&ChannelHandlersMutex);
+	for(TPair<int32, TSharedRef<FChannelHandler, ESPMode::ThreadSafe>>& Pair : ChannelHandlers)
+	{
+		Pair.Value->bIsBound = false;
+	}
+	ChannelHandlers.Empty();
+	ChannelHandlerIndex.Empty();
+}
+
+void UPubnubClient::SetSubscribeFilterExpression(FString FilterExpression)
+{
+	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED();
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+
+	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
+
+	//ctx_ee can be used only under SubscriptionOperationExecutionMutex, which may be held by a running subscribe operation, so don't wait for it here
+	PubnubCallsThread->AddFunctionToQueue([WeakThis, FilterExpression]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		FScopeLock SubscriptionExecutionLock(&WeakThis.Get()->SubscriptionOperationExecutionMutex);
+		WeakThis.Get()->ApplySubscribeFilterExpression_priv(FilterExpression, true);
+	}, EPubnubOperationClass::StateChange);
+}
+
+FString UPubnubClient::GetSubscribeFilterExpression() const
+{
+	FScopeLock FilterExpressionLock(&SubscribeFilterExpressionMutex);
+	return SubscribeFilterExpression;
+}
+
+void UPubnubClient::RouteMessageToChannelHandlers(const FPubnubNativeMessage& NativeMessage, TFunctionRef<const FPubnubMessageData&()> GetMessageData)
+{
+	const bool bIsPresenceEvent = NativeMessage.bIsPresenceEvent;
+	//Presence events of "channel-pnpres" go to handlers of "channel"
+	FStringView Channel(NativeMessage.Channel.ToString());
+	if(bIsPresenceEvent)
+	{
+		Channel.LeftChopInline(FCString::Strlen(TEXT("-pnpres")));
+	}
+
+	TArray<TSharedRef<FChannelHandler, ESPMode::ThreadSafe>, TInlineAllocator<8>> MatchingHandlers;
+	{
+		FScopeLock ChannelHandlersLock(&ChannelHandlersMutex);
+		if(ChannelHandlers.IsEmpty())
+		{
+			return;
+		}
+
+		FPubnubChannelHandlerIndex::FHandlerIDArray HandlerIDs;
+		ChannelHandlerIndex.FindHandlers(Channel, HandlerIDs);
+		for(const int32 HandlerID : HandlerIDs)
+		{
+			const TSharedRef<FChannelHandler, ESPMode::ThreadSafe>* ChannelHandler = ChannelHandlers.Find(HandlerID);
+			if(ChannelHandler && (!bIsPresenceEvent || (*ChannelHandler)->bReceivePresenceEvents))
+			{
+				MatchingHandlers.Add(*ChannelHandler);
+			}
+		}
+	}
+
+	//Handlers are called without the lock, so they can bind and unbind other handlers
+	for(const TSharedRef<FChannelHandler, ESPMode::ThreadSafe>& ChannelHandler : MatchingHandlers)
+	{
+		if(!IsInitialized)
+		{
+			return;
+		}
+		if(ChannelHandler->bIsBound)
+		{
+			ChannelHandler->Handler.ExecuteIfBound(GetMessageData(), bIsPresenceEvent);
+		}
+	}
+}
+
+FPubnubOperationResult UPubnubClient::SubscribeToChannels(TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	return UpdateSubscriptions_priv(Channels, ChannelGroups, {}, {}, SubscribeSettings);
+}
+
+void UPubnubClient::SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FOnPubnubSubscribeOperationResponse OnSubscribeToChannelsResponse, FPubnubSubscribeSettings SubscribeSettings)
+{
+	FOnPubnubSubscribeOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnSubscribeToChannelsResponse](FPubnubOperationResult Result)
+	{
+		OnSubscribeToChannelsResponse.ExecuteIfBound(Result);
+	});
+
+	SubscribeToChannelsAsync(Channels, ChannelGroups, NativeCallback, SubscribeSettings);
+}
+
+void UPubnubClient::SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FOnPubnubSubscribeOperationResponseNative NativeCallback, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
+
+	FQueuedSubscriptionChange Change;
+	Change.ChannelsToAdd = MoveTemp(Channels);
+	Change.ChannelGroupsToAdd = MoveTemp(ChannelGroups);
+	Change.SubscribeSettings = SubscribeSettings;
+	Change.Callback = NativeCallback;
+	QueueSubscriptionChange(MoveTemp(Change));
+}
+
+void UPubnubClient::SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED();
+	
+	SubscribeToChannelsAsync(Channels, ChannelGroups, nullptr, SubscribeSettings);
+}
+
+FPubnubOperationResult UPubnubClient::UpdateSubscriptions(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_RETURN_OPERATION_RESULT_IF_NOT_INITIALIZED();
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	return UpdateSubscriptions_priv(ChannelsToAdd, ChannelGroupsToAdd, ChannelsToRemove, ChannelGroupsToRemove, SubscribeSettings);
+}
+
+void UPubnubClient::UpdateSubscriptionsAsync(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FOnPubnubSubscribeOperationResponse OnUpdateSubscriptionsResponse, FPubnubSubscribeSettings SubscribeSettings)
+{
+	FOnPubnubSubscribeOperationResponseNative NativeCallback;
+	NativeCallback.BindLambda([OnUpdateSubscriptionsResponse](FPubnubOperationResult Result)
+	{
+		OnUpdateSubscriptionsResponse.ExecuteIfBound(Result);
 	});
+
+	UpdateSubscriptionsAsync(ChannelsToAdd, ChannelGroupsToAdd, ChannelsToRemove, ChannelGroupsToRemove, NativeCallback, SubscribeSettings);
+}
+
+void UPubnubClient::UpdateSubscriptionsAsync(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FOnPubnubSubscribeOperationResponseNative NativeCallback, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_ENSURE_CLIENT_INITIALIZED(NativeCallback);
+
+	FQueuedSubscriptionChange Change;
+	Change.ChannelsToAdd = MoveTemp(ChannelsToAdd);
+	Change.ChannelGroupsToAdd = MoveTemp(ChannelGroupsToAdd);
+	Change.ChannelsToRemove = MoveTemp(ChannelsToRemove);
+	Change.ChannelGroupsToRemove = MoveTemp(ChannelGroupsToRemove);
+	Change.SubscribeSettings = SubscribeSettings;
+	Change.Callback = NativeCallback;
+	QueueSubscriptionChange(MoveTemp(Change));
 }
 
 FPubnubOperationResult UPubnubClient::AddChannelToGroup(FString Channel, FString ChannelGroup)
@@ -541,7 +847,7 @@ void UPubnubClient::ListUsersFromChannelAsync(FString Channel, FOnPubnubListUser
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result.Result, Result.Data);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 FPubnubListUsersSubscribedChannelsResult UPubnubClient::ListUserSubscribedChannels(FString UserID)
@@ -579,7 +885,7 @@ void UPubnubClient::ListUserSubscribedChannelsAsync(FString UserID, FOnPubnubLis
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result.Result, Result.Channels);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 FPubnubOperationResult UPubnubClient::SetState(FString Channel, FString StateJson, FPubnubSetStateSettings SetStateSettings)
@@ -615,7 +921,7 @@ void UPubnubClient::SetStateAsync(FString Channel, FString StateJson, FOnPubnubS
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 void UPubnubClient::SetStateAsync(FString Channel, FString StateJson, FPubnubSetStateSettings SetStateSettings)
@@ -630,7 +936,7 @@ void UPubnubClient::SetStateAsync(FString Channel, FString StateJson, FPubnubSet
 		{return;}
 		
 		WeakThis.Get()->SetState_priv(Channel, StateJson, SetStateSettings);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 FPubnubGetStateResult UPubnubClient::GetState(FString Channel, FString ChannelGroup, FString UserID)
@@ -668,7 +974,7 @@ void UPubnubClient::GetStateAsync(FString Channel, FString ChannelGroup, FString
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result.Result, Result.StateResponse);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 FPubnubOperationResult UPubnubClient::Heartbeat(FString Channel, FString ChannelGroup)
@@ -691,7 +997,7 @@ void UPubnubClient::HeartbeatAsync(FString Channel, FString ChannelGroup)
 		{return;}
 		
 		WeakThis.Get()->Heartbeat_priv(Channel, ChannelGroup);
-	});
+	}, EPubnubOperationClass::Presence);
 }
 
 FPubnubGrantTokenResult UPubnubClient::GrantToken(int Ttl, FString AuthorizedUser, const FPubnubGrantTokenPermissions& Permissions, FString Meta)
@@ -776,6 +1082,14 @@ FString UPubnubClient::ParseToken(FString Token)
 	return ParseToken_priv(Token);
 }
 
+bool UPubnubClient::HasPermission(FString Token, EPubnubTokenResourceType ResourceType, FString ResourceID, EPubnubTokenPermission Permission)
+{
+	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED(false);
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+
+	return HasPermission_priv(Token, ResourceType, ResourceID, Permission);
+}
+
 void UPubnubClient::SetAuthToken(FString Token)
 {
 	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED();
@@ -796,7 +1110,7 @@ void UPubnubClient::SetAuthTokenAsync(FString Token)
 		{return;}
 
 		WeakThis.Get()->SetAuthToken_priv(Token);
-	});
+	}, EPubnubOperationClass::StateChange);
 }
 
 int UPubnubClient::SetOrigin(FString Origin)
@@ -809,7 +1123,26 @@ int UPubnubClient::SetOrigin(FString Origin)
 
 FString UPubnubClient::GetOrigin() const
 {
-	return pubnub_get_origin(ctx_pub);
+	if(!ContextPool)
+	{return "";}
+	
+	return pubnub_get_origin(ContextPool->GetPrimaryContext());
+}
+
+FPubnubConnectionStats UPubnubClient::GetConnectionStats() const
+{
+	if(!ContextPool)
+	{return FPubnubConnectionStats();}
+
+	return ContextPool->GetConnectionStats();
+}
+
+void UPubnubClient::ResetConnectionStats()
+{
+	if(!ContextPool)
+	{return;}
+
+	ContextPool->ResetConnectionStats();
 }
 
 FPubnubFetchHistoryResult UPubnubClient::FetchHistory(FString Channel, FPubnubFetchHistorySettings FetchHistorySettings)
@@ -818,7 +1151,10 @@ FPubnubFetchHistoryResult UPubnubClient::FetchHistory(FString Channel, FPubnubFe
 	PUBNUB_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	
-	return FetchHistory_priv(Channel, FetchHistorySettings);
+	return RunWithRetry_priv<FPubnubFetchHistoryResult>([&](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return FetchHistory_priv(Channel, FetchHistorySettings, RetriesDone, OutRetryDelaySeconds);
+	});
 }
 
 void UPubnubClient::FetchHistoryAsync(FString Channel, FOnPubnubFetchHistoryResponse OnFetchHistoryResponse, FPubnubFetchHistorySettings FetchHistorySettings)
@@ -838,13 +1174,12 @@ void UPubnubClient::FetchHistoryAsync(FString Channel, FOnPubnubFetchHistoryResp
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, NativeCallback, FetchHistorySettings]
+	RunWithRetryAsync_priv<FPubnubFetchHistoryResult>(EPubnubOperationClass::History, [WeakThis, Channel, FetchHistorySettings](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return WeakThis.Get()->FetchHistory_priv(Channel, FetchHistorySettings, RetriesDone, OutRetryDelaySeconds);
+	},
+	[NativeCallback](const FPubnubFetchHistoryResult& Result)
 	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubFetchHistoryResult Result = WeakThis.Get()->FetchHistory_priv(Channel, FetchHistorySettings);
-		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result.Result, Result.Messages);
 	});
@@ -884,7 +1219,7 @@ void UPubnubClient::DeleteMessagesAsync(FString Channel, FOnPubnubDeleteMessages
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 void UPubnubClient::DeleteMessagesAsync(FString Channel, FPubnubDeleteMessagesSettings DeleteMessagesSettings)
@@ -899,7 +1234,7 @@ void UPubnubClient::DeleteMessagesAsync(FString Channel, FPubnubDeleteMessagesSe
 		{return;}
 		
 		WeakThis.Get()->DeleteMessages_priv(Channel, DeleteMessagesSettings);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 FPubnubMessageCountsResult UPubnubClient::MessageCounts(FString Channel, FString Timetoken)
@@ -908,7 +1243,10 @@ FPubnubMessageCountsResult UPubnubClient::MessageCounts(FString Channel, FString
 	PUBNUB_RETURN_WRAPPER_IF_NOT_INITIALIZED(FinalResult);
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	
-	return MessageCounts_priv(Channel, Timetoken);
+	return RunWithRetry_priv<FPubnubMessageCountsResult>([&](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return MessageCounts_priv(Channel, Timetoken, RetriesDone, OutRetryDelaySeconds);
+	});
 }
 
 void UPubnubClient::MessageCountsAsync(FString Channel, FString Timetoken, FOnPubnubMessageCountsResponse OnMessageCountsResponse)
@@ -928,13 +1266,12 @@ void UPubnubClient::MessageCountsAsync(FString Channel, FString Timetoken, FOnPu
 	
 	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
 
-	PubnubCallsThread->AddFunctionToQueue( [WeakThis, Channel, Timetoken, NativeCallback]
+	RunWithRetryAsync_priv<FPubnubMessageCountsResult>(EPubnubOperationClass::History, [WeakThis, Channel, Timetoken](int32 RetriesDone, float* OutRetryDelaySeconds)
+	{
+		return WeakThis.Get()->MessageCounts_priv(Channel, Timetoken, RetriesDone, OutRetryDelaySeconds);
+	},
+	[NativeCallback](const FPubnubMessageCountsResult& Result)
 	{
-		if(!WeakThis.IsValid())
-		{return;}
-		
-		FPubnubMessageCountsResult Result = WeakThis.Get()->MessageCounts_priv(Channel, Timetoken);
-		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result.Result, Result.MessageCounts);
 	});
@@ -998,7 +1335,7 @@ void UPubnubClient::MessageCountsMultipleAsync(TArray<FString> Channels, TArray<
 		
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, Result);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 FPubnubGetAllUserMetadataResult UPubnubClient::GetAllUserMetadataRaw(FString Include, int Limit, FString Filter, FString Sort, FPubnubPage Page, EPubnubTribool Count)
@@ -1035,7 +1372,7 @@ void UPubnubClient::GetAllUserMetadataRawAsync(FOnPubnubGetAllUserMetadataRespon
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetAllUserMetadataResult.Result, GetAllUserMetadataResult.UsersData, GetAllUserMetadataResult.Page, GetAllUserMetadataResult.TotalCount);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubGetAllUserMetadataResult UPubnubClient::GetAllUserMetadata(FPubnubGetAllInclude Include, int Limit, FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
@@ -1091,7 +1428,7 @@ void UPubnubClient::SetUserMetadataRawAsync(FString User, FString UserMetadataOb
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SetUserMetadataResult.Result, SetUserMetadataResult.UserData);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubUserMetadataResult UPubnubClient::SetUserMetadata(FString User, FPubnubUserInputData UserMetadata, FPubnubGetMetadataInclude Include)
@@ -1147,7 +1484,7 @@ void UPubnubClient::GetUserMetadataRawAsync(FString User, FOnPubnubGetUserMetada
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetUserMetadataResult.Result, GetUserMetadataResult.UserData);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubUserMetadataResult UPubnubClient::GetUserMetadata(FString User, FPubnubGetMetadataInclude Include)
@@ -1203,7 +1540,7 @@ void UPubnubClient::RemoveUserMetadataAsync(FString User, FOnPubnubRemoveUserMet
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, RemoveUserMetadataResult);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubGetAllChannelMetadataResult UPubnubClient::GetAllChannelMetadataRaw(FString Include, int Limit, FString Filter, FString Sort, FPubnubPage Page, EPubnubTribool Count)
@@ -1240,7 +1577,7 @@ void UPubnubClient::GetAllChannelMetadataRawAsync(FOnPubnubGetAllChannelMetadata
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetAllChannelMetadataResult.Result, GetAllChannelMetadataResult.ChannelsData, GetAllChannelMetadataResult.Page, GetAllChannelMetadataResult.TotalCount);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubGetAllChannelMetadataResult UPubnubClient::GetAllChannelMetadata(FPubnubGetAllInclude Include, int Limit, FString Filter, FPubnubGetAllSort Sort, FPubnubPage Page)
@@ -1296,7 +1633,7 @@ void UPubnubClient::SetChannelMetadataRawAsync(FString Channel, FString ChannelM
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SetChannelMetadataResult.Result, SetChannelMetadataResult.ChannelData);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubChannelMetadataResult UPubnubClient::SetChannelMetadata(FString Channel, FPubnubChannelInputData ChannelMetadata, FPubnubGetMetadataInclude Include)
@@ -1352,7 +1689,7 @@ void UPubnubClient::GetChannelMetadataRawAsync(FString Channel, FOnPubnubGetChan
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetChannelMetadataResult.Result, GetChannelMetadataResult.ChannelData);
-    });
+    }, EPubnubOperationClass::AppContext);
 }
 
 FPubnubChannelMetadataResult UPubnubClient::GetChannelMetadata(FString Channel, FPubnubGetMetadataInclude Include)
@@ -1407,7 +1744,7 @@ void UPubnubClient::RemoveChannelMetadataAsync(FString Channel, FOnPubnubRemoveC
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, RemoveChannelMetadataResult);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubMembershipsResult UPubnubClient::GetMembershipsRaw(FString User, FString Include, int Limit, FString Filter, FString Sort, FPubnubPage Page, EPubnubTribool Count)
@@ -1444,7 +1781,7 @@ void UPubnubClient::GetMembershipsRawAsync(FString User, FOnPubnubGetMemberships
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetMembershipsResult.Result, GetMembershipsResult.MembershipsData, GetMembershipsResult.Page, GetMembershipsResult.TotalCount);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubMembershipsResult UPubnubClient::GetMemberships(FString User, FPubnubMembershipInclude Include, int Limit, FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -1499,7 +1836,7 @@ void UPubnubClient::SetMembershipsRawAsync(FString User, FString SetObj, FOnPubn
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SetMembershipsResult.Result, SetMembershipsResult.MembershipsData, SetMembershipsResult.Page, SetMembershipsResult.TotalCount);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubMembershipsResult UPubnubClient::SetMemberships(FString User, TArray<FPubnubMembershipInputData> Channels, FPubnubMembershipInclude Include, int Limit, FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -1554,7 +1891,7 @@ void UPubnubClient::RemoveMembershipsRawAsync(FString User, FString RemoveObj, F
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, RemoveMembershipsResult.Result, RemoveMembershipsResult.MembershipsData, RemoveMembershipsResult.Page, RemoveMembershipsResult.TotalCount);
-	});
+	}, EPubnubOperationClass::AppContext);
 }
 
 FPubnubMembershipsResult UPubnubClient::RemoveMemberships(FString User, TArray<FString> Channels, FPubnubMembershipInclude Include, int Limit, FString Filter, FPubnubMembershipSort Sort, FPubnubPage Page)
@@ -1610,7 +1947,7 @@ void UPubnubClient::GetChannelMembersRawAsync(FString Channel, FOnPubnubGetChann
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetChannelMembersResult.Result, GetChannelMembersResult.MembersData, GetChannelMembersResult.Page, GetChannelMembersResult.TotalCount);
-    });
+    }, EPubnubOperationClass::AppContext);
 }
 
 FPubnubChannelMembersResult UPubnubClient::GetChannelMembers(FString Channel, FPubnubMemberInclude Include, int Limit, FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -1666,7 +2003,7 @@ void UPubnubClient::SetChannelMembersRawAsync(FString Channel, FString SetObj, F
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, SetChannelMembersResult.Result, SetChannelMembersResult.MembersData, SetChannelMembersResult.Page, SetChannelMembersResult.TotalCount);
-    });
+    }, EPubnubOperationClass::AppContext);
 }
 
 FPubnubChannelMembersResult UPubnubClient::SetChannelMembers(FString Channel, TArray<FPubnubChannelMemberInputData> Users, FPubnubMemberInclude Include, int Limit, FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -1722,7 +2059,7 @@ void UPubnubClient::RemoveChannelMembersRawAsync(FString Channel, FString Remove
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, RemoveChannelMembersResult.Result, RemoveChannelMembersResult.MembersData, RemoveChannelMembersResult.Page, RemoveChannelMembersResult.TotalCount);
-    });
+    }, EPubnubOperationClass::AppContext);
 }
 
 FPubnubChannelMembersResult UPubnubClient::RemoveChannelMembers(FString Channel, TArray<FString> Users, FPubnubMemberInclude Include, int Limit, FString Filter, FPubnubMemberSort Sort, FPubnubPage Page)
@@ -1777,7 +2114,7 @@ void UPubnubClient::AddMessageActionAsync(FString Channel, FString MessageTimeto
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, AddMessageActionResult.Result, AddMessageActionResult.MessageActionData);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 FPubnubGetMessageActionsResult UPubnubClient::GetMessageActions(FString Channel, FString Start, FString End, int Limit)
@@ -1813,7 +2150,7 @@ void UPubnubClient::GetMessageActionsAsync(FString Channel, FOnPubnubGetMessageA
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, GetMessageActionsResult.Result, GetMessageActionsResult.MessageActions);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 FPubnubOperationResult UPubnubClient::RemoveMessageAction(FString Channel, FString MessageTimetoken, FString ActionTimetoken)
@@ -1848,13 +2185,15 @@ void UPubnubClient::RemoveMessageActionAsync(FString Channel, FString MessageTim
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(NativeCallback, RemoveMessageActionResult);
-	});
+	}, EPubnubOperationClass::History);
 }
 
 FPubnubOperationResult UPubnubClient::ReconnectSubscriptions(FString Timetoken)
 {
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("reconnect subscriptions called. TimetokenLength=%d"), Timetoken.Len()));
+	//Manual reconnection starts the retry policy over
+	CancelSubscribeRetry();
 	enum pubnub_res ReconnectResult;
 	if (Timetoken.IsEmpty())
 	{
@@ -1888,6 +2227,7 @@ FPubnubOperationResult UPubnubClient::ReconnectSubscriptions(FString Timetoken)
 FPubnubOperationResult UPubnubClient::DisconnectSubscriptions()
 {
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	CancelSubscribeRetry();
 	enum pubnub_res DisconnectResult = pubnub_disconnect(ctx_ee);
 	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("disconnect call finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(DisconnectResult))));
 	
@@ -1910,6 +2250,7 @@ FPubnubOperationResult UPubnubClient::DisconnectSubscriptions()
 
 void UPubnubClient::SetCryptoModule(TScriptInterface<IPubnubCryptoProviderInterface> CryptoModule)
 {
+	PUBNUB_RETURN_IF_CLIENT_NOT_INITIALIZED();
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	// Clean up previous crypto bridge if it was already set.
 	if(CryptoBridge)
@@ -1922,7 +2263,7 @@ void UPubnubClient::SetCryptoModule(TScriptInterface<IPubnubCryptoProviderInterf
 	UObject* CryptorObject = CryptoModule.GetObject();
 	if(!CryptorObject)
 	{
-		pubnub_set_crypto_module(ctx_pub, nullptr);
+		ContextPool->ForEachContext([](pubnub_t* Context){ pubnub_set_crypto_module(Context, nullptr); });
 		pubnub_set_crypto_module(ctx_ee, nullptr);
 		CryptoBridge = nullptr;
 		PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("crypto module cleared from contexts."));
@@ -1932,8 +2273,9 @@ void UPubnubClient::SetCryptoModule(TScriptInterface<IPubnubCryptoProviderInterf
 		CryptoBridge = UPubnubInternalUtilities::SafeNewObject<UPubnubCryptoBridge>(this);
 		CryptoBridge->InitCryptoBridge(CryptoModule);
 
-		pubnub_set_crypto_module(ctx_pub, CryptoBridge->GetProvider());
-		pubnub_set_crypto_module(ctx_ee, CryptoBridge->GetProvider());
+		pubnub_crypto_provider_t* Provider = CryptoBridge->GetProvider();
+		ContextPool->ForEachContext([Provider](pubnub_t* Context){ pubnub_set_crypto_module(Context, Provider); });
+		pubnub_set_crypto_module(ctx_ee, Provider);
 		PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("crypto module applied to pub and ee contexts."));
 	}
 }
@@ -1958,6 +2300,7 @@ void UPubnubClient::AddLogger(TScriptInterface<IPubnubLoggerInterface> Logger)
 		return;
 	}
 	LoggerManager->AddLogger(Logger);
+	SyncCCoreLogLevel();
 }
 
 void UPubnubClient::RemoveLogger(TScriptInterface<IPubnubLoggerInterface> Logger)
@@ -1967,6 +2310,7 @@ void UPubnubClient::RemoveLogger(TScriptInterface<IPubnubLoggerInterface> Logger
 		return;
 	}
 	LoggerManager->RemoveLogger(Logger);
+	SyncCCoreLogLevel();
 }
 
 void UPubnubClient::ClearLoggers()
@@ -1976,6 +2320,7 @@ void UPubnubClient::ClearLoggers()
 		return;
 	}
 	LoggerManager->ClearLoggers();
+	SyncCCoreLogLevel();
 }
 
 TArray<TScriptInterface<IPubnubLoggerInterface>> UPubnubClient::GetLoggers()
@@ -1987,10 +2332,19 @@ TArray<TScriptInterface<IPubnubLoggerInterface>> UPubnubClient::GetLoggers()
 	return LoggerManager->GetLoggers();
 }
 
+FPubnubAsyncLogStats UPubnubClient::GetAsyncLogStats()
+{
+	if (!LoggerManager)
+	{
+		return {};
+	}
+	return LoggerManager->GetAsyncLogStats();
+}
+
 void UPubnubClient::AttachCCoreLogger()
 {
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
-	if (!ctx_pub || !ctx_ee || CCoreLogger || !LoggerManager)
+	if (!ContextPool || !ctx_ee || CCoreLogger || !LoggerManager)
 	{
 		PUBNUB_LOG_FUNCTION_TRACE(TEXT("skipping C-Core logger attach due to missing context/manager or already attached logger."));
 		return;
@@ -2003,17 +2357,85 @@ void UPubnubClient::AttachCCoreLogger()
 		return;
 	}
 
-	const int AddResultPub = pubnub_logger_add(ctx_pub, CCoreLogger);
-	const int AddResultEe = pubnub_logger_add(ctx_ee, CCoreLogger);
-	if (AddResultPub != 0 || AddResultEe != 0)
+	bool AllAttached = pubnub_logger_add(ctx_ee, CCoreLogger) == 0;
+	ContextPool->ForEachContext([this, &AllAttached](pubnub_t* Context)
+	{
+		AllAttached &= pubnub_logger_add(Context, CCoreLogger) == 0;
+	});
+	if (!AllAttached)
 	{
 		PUBNUB_LOG_FUNCTION_WARNING(TEXT("failed to attach C-Core logger to one or more contexts."));
 	}
 
-	// Capture full C-Core logs and apply per-logger C-Core filtering in LoggerManager.
-	pubnub_logger_set_log_level(ctx_pub, PUBNUB_LOG_LEVEL_TRACE);
-	pubnub_logger_set_log_level(ctx_ee, PUBNUB_LOG_LEVEL_TRACE);
-	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("C-Core logger attached and set to TRACE level."));
+	//C-Core doesn't even build messages that no logger would accept. Per-logger filtering is still done in LoggerManager
+	SyncCCoreLogLevel(true);
+	PUBNUB_LOG_FUNCTION_DEBUG(TEXT("C-Core logger attached."), PUBNUB_LOG_VALUE(AppliedCCoreLogLevel));
+}
+
+void UPubnubClient::SyncCCoreLogLevel(bool bForce)
+{
+	if (!LoggerManager || !CCoreLogger || !ContextPool || !ctx_ee)
+	{
+		return;
+	}
+
+	const EPubnubLogLevel Level = LoggerManager->GetMostVerboseEnabledLevel(EPubnubLogSource::PLS_CCore);
+	if (Level == AppliedCCoreLogLevel && !bForce)
+	{
+		return;
+	}
+
+	enum pubnub_log_level CCoreLevel = PUBNUB_LOG_LEVEL_NONE;
+	switch (Level)
+	{
+	case EPubnubLogLevel::PLL_Trace:	CCoreLevel = PUBNUB_LOG_LEVEL_TRACE; break;
+	case EPubnubLogLevel::PLL_Debug:	CCoreLevel = PUBNUB_LOG_LEVEL_DEBUG; break;
+	case EPubnubLogLevel::PLL_Info:		CCoreLevel = PUBNUB_LOG_LEVEL_INFO; break;
+	case EPubnubLogLevel::PLL_Warning:	CCoreLevel = PUBNUB_LOG_LEVEL_WARNING; break;
+	case EPubnubLogLevel::PLL_Error:	CCoreLevel = PUBNUB_LOG_LEVEL_ERROR; break;
+	default: break;
+	}
+
+	ContextPool->ForEachContext([CCoreLevel](pubnub_t* Context){ pubnub_logger_set_log_level(Context, CCoreLevel); });
+	pubnub_logger_set_log_level(ctx_ee, CCoreLevel);
+	AppliedCCoreLogLevel = Level;
+}
+
+template<typename EntityClass>
+EntityClass* UPubnubClient::GetOrCreateEntity_priv(const FString& EntityID, EPubnubEntityType EntityType)
+{
+	const FEntityObjectKey Key(EntityType, EntityID);
+
+	FScopeLock EntityObjectsLock(&EntityObjectsMutex);
+	if(const TWeakObjectPtr<UPubnubBaseEntity>* Existing = EntityObjects.Find(Key))
+	{
+		//EntityID is public, so make sure nobody changed it since the entity was created
+		EntityClass* ExistingEntity = Cast<EntityClass>(Existing->Get());
+		if(IsValid(ExistingEntity) && ExistingEntity->EntityID.Equals(EntityID, ESearchCase::CaseSensitive))
+		{
+			PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("reusing existing entity for '%s'."), *EntityID));
+			return ExistingEntity;
+		}
+	}
+
+	if(EntityObjects.Num() >= EntityObjectsPruneThreshold)
+	{
+		for(auto It = EntityObjects.CreateIterator(); It; ++It)
+		{
+			if(!It.Value().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		EntityObjectsPruneThreshold = FMath::Max(64, EntityObjects.Num() * 2);
+	}
+
+	EntityClass* Entity = UPubnubInternalUtilities::SafeNewObject<EntityClass>(this);
+	Entity->InitEntity(this);
+	Entity->EntityID = EntityID;
+	EntityObjects.Add(Key, Entity);
+	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("entity created for '%s'."), *EntityID));
+	return Entity;
 }
 
 UPubnubChannelEntity* UPubnubClient::CreateChannelEntity(FString Channel)
@@ -2021,11 +2443,7 @@ UPubnubChannelEntity* UPubnubClient::CreateChannelEntity(FString Channel)
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	PUBNUB_RETURN_IF_FIELD_EMPTY(Channel, nullptr);
 	
-	UPubnubChannelEntity* ChannelEntity = UPubnubInternalUtilities::SafeNewObject<UPubnubChannelEntity>(this);
-	ChannelEntity->InitEntity(this);
-	ChannelEntity->EntityID = Channel;
-	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("channel entity created for '%s'."), *Channel));
-	return ChannelEntity;
+	return GetOrCreateEntity_priv<UPubnubChannelEntity>(Channel, EPubnubEntityType::PEnT_Channel);
 }
 
 UPubnubChannelGroupEntity* UPubnubClient::CreateChannelGroupEntity(FString ChannelGroup)
@@ -2033,11 +2451,7 @@ UPubnubChannelGroupEntity* UPubnubClient::CreateChannelGroupEntity(FString Chann
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	PUBNUB_RETURN_IF_FIELD_EMPTY(ChannelGroup, nullptr);
 	
-	UPubnubChannelGroupEntity* ChannelGroupEntity = UPubnubInternalUtilities::SafeNewObject<UPubnubChannelGroupEntity>(this);
-	ChannelGroupEntity->InitEntity(this);
-	ChannelGroupEntity->EntityID = ChannelGroup;
-	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("channel group entity created for '%s'."), *ChannelGroup));
-	return ChannelGroupEntity;
+	return GetOrCreateEntity_priv<UPubnubChannelGroupEntity>(ChannelGroup, EPubnubEntityType::PEnT_ChannelGroup);
 }
 
 UPubnubChannelMetadataEntity* UPubnubClient::CreateChannelMetadataEntity(FString Channel)
@@ -2045,11 +2459,7 @@ UPubnubChannelMetadataEntity* UPubnubClient::CreateChannelMetadataEntity(FString
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	PUBNUB_RETURN_IF_FIELD_EMPTY(Channel, nullptr);
 	
-	UPubnubChannelMetadataEntity* ChannelMetadataEntity = UPubnubInternalUtilities::SafeNewObject<UPubnubChannelMetadataEntity>(this);
-	ChannelMetadataEntity->InitEntity(this);
-	ChannelMetadataEntity->EntityID = Channel;
-	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("channel metadata entity created for '%s'."), *Channel));
-	return ChannelMetadataEntity;
+	return GetOrCreateEntity_priv<UPubnubChannelMetadataEntity>(Channel, EPubnubEntityType::PEnT_ChannelMetadata);
 }
 
 UPubnubUserMetadataEntity* UPubnubClient::CreateUserMetadataEntity(FString User)
@@ -2057,11 +2467,7 @@ UPubnubUserMetadataEntity* UPubnubClient::CreateUserMetadataEntity(FString User)
 	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
 	PUBNUB_RETURN_IF_FIELD_EMPTY(User, nullptr);
 	
-	UPubnubUserMetadataEntity* UserMetadataEntity = UPubnubInternalUtilities::SafeNewObject<UPubnubUserMetadataEntity>(this);
-	UserMetadataEntity->InitEntity(this);
-	UserMetadataEntity->EntityID = User;
-	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("user metadata entity created for '%s'."), *User));
-	return UserMetadataEntity;
+	return GetOrCreateEntity_priv<UPubnubUserMetadataEntity>(User, EPubnubEntityType::PEnT_UserMetadata);
 }
 
 UPubnubSubscriptionSet* UPubnubClient::CreateSubscriptionSet(TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings SubscriptionSettings)
@@ -2172,6 +2578,48 @@ TArray<UPubnubSubscriptionSet*> UPubnubClient::GetActiveSubscriptionSets()
 	return SubscriptionSets;
 }
 
+bool UPubnubClient::AddSubscriptionToPool(UPubnubSubscription* Subscription)
+{
+	if(!IsInitialized || !IsValid(Subscription) || !Subscription->bCanBePooled || Subscription->bIsSubscribed || !Subscription->CCoreSubscription)
+	{return false;}
+
+	FScopeLock SubscriptionPoolLock(&SubscriptionPoolMutex);
+	if(PooledSubscriptions.Num() >= SubscriptionPoolCapacity)
+	{return false;}
+
+	//Messages queued by the previous owner's listeners must not reach whoever takes this subscription next
+	Subscription->ListenerGeneration++;
+	if(FPubnubInternalSubscriptionListenerUserData* UserData = static_cast<FPubnubInternalSubscriptionListenerUserData*>(Subscription->ListenerUserData))
+	{
+		UserData->Generation.store(Subscription->ListenerGeneration, std::memory_order_release);
+	}
+
+	PooledSubscriptions.Add(Subscription);
+	return true;
+}
+
+UPubnubSubscription* UPubnubClient::TakePooledSubscription(const FString& EntityID, EPubnubEntityType EntityType, bool bReceivePresenceEvents)
+{
+	FScopeLock SubscriptionPoolLock(&SubscriptionPoolMutex);
+	for(int32 Index = PooledSubscriptions.Num() - 1; Index >= 0; Index--)
+	{
+		UPubnubSubscription* Subscription = PooledSubscriptions[Index];
+		if(!IsValid(Subscription) || !Subscription->IsInitialized)
+		{
+			PooledSubscriptions.RemoveAtSwap(Index);
+			continue;
+		}
+		if(Subscription->PoolEntityType == EntityType && Subscription->bPoolReceivePresenceEvents == bReceivePresenceEvents
+			&& Subscription->PoolEntityID.Equals(EntityID, ESearchCase::CaseSensitive))
+		{
+			PooledSubscriptions.RemoveAtSwap(Index);
+			Subscription->bIsReleased = false;
+			return Subscription;
+		}
+	}
+	return nullptr;
+}
+
 #pragma region UE WRAPPER CACHE (INTERNAL)
 
 void UPubnubClient::RegisterManagedSubscription(pubnub_subscription_t* CCorePtr, UPubnubSubscription* Wrapper)
@@ -2334,6 +2782,11 @@ void UPubnubClient::InitWithConfig(UPubnubSubsystem* InPubnubSubsystem, FPubnubC
 			LoggerInterface.SetInterface(Cast<IPubnubLoggerInterface>(LoggerObject));
 			LoggerManager->AddLogger(LoggerInterface);
 		}
+
+		if (InConfig.LoggerConfig.bEnableAsyncLogging)
+		{
+			LoggerManager->EnableAsyncDispatch(InConfig.LoggerConfig.AsyncLogQueueCapacity);
+		}
 	}
 	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("initializing pubnub client. ClientID=%d, DebugName=%s, Config=%s"), ClientID, *DebugName, *UPubnubLogUtilities::LogConfigToString(InConfig)));
 
@@ -2344,9 +2797,23 @@ void UPubnubClient::InitWithConfig(UPubnubSubsystem* InPubnubSubsystem, FPubnubC
 	//If initialized correctly, create required thread.
 	if(IsInitialized.load(std::memory_order_acquire))
 	{
-		//Create new thread to queue all pubnub operations
-		PubnubCallsThread = new FPubnubFunctionThread;
-		PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("pubnub calls thread created."));
+		//Create worker threads to execute all async pubnub operations. Each of them uses its own reserved context from the pool
+		PubnubCallsThread = new FPubnubFunctionThread(InConfig.AsyncWorkerCount, ContextPool);
+		for(int32 ClassIndex = 0; ClassIndex < static_cast<int32>(EPubnubOperationClass::StateChange); ClassIndex++)
+		{
+			PubnubCallsThread->SetMaxConcurrency(static_cast<EPubnubOperationClass>(ClassIndex), InConfig.MaxConcurrentOperationsPerKind);
+		}
+		PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("pubnub calls thread created. WorkerCount=%d"), PubnubCallsThread->GetWorkerCount()));
+
+		//Received messages are queued by C-Core listeners and broadcast in batches once per frame
+		ReceivedMessageQueue = MakeShared<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe>(FMath::Max(InConfig.ReceivedMessageQueueCapacity, 64));
+		ClientListenerUserData = new FPubnubInternalClientListenerUserData{ReceivedMessageQueue};
+		MessageDeliveryBudgetPerFrame = FMath::Max(InConfig.MessageDeliveryBudgetPerFrame, 0);
+		SubscriptionCoalescingWindowMs = FMath::Max(InConfig.SubscriptionCoalescingWindowMs, 0);
+		TokenCache = MakeShared<FPubnubTokenCache, ESPMode::ThreadSafe>(FMath::Max(InConfig.TokenCacheCapacity, 1));
+		SubscriptionPoolCapacity = FMath::Max(InConfig.SubscriptionPoolCapacity, 0);
+		PublishCompressionThresholdBytes = InConfig.CompressLargePublishes ? FMath::Max(InConfig.PublishCompressionThresholdBytes, 0) : -1;
+		ReceivedMessagesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UPubnubClient::DeliverReceivedMessages));
 		PUBNUB_LOG_FUNCTION_INFO(FString::Printf(TEXT("client ready. ClientID=%d, DebugName=%s"), ClientID, *DebugName));
 	}
 }
@@ -2373,11 +2840,13 @@ void UPubnubClient::DeinitializeClient()
 	//Mark deinitializing FIRST so new public API calls short-circuit via PUBNUB_RETURN_*_IF_NOT_INITIALIZED before reaching the C-Core contexts.
 	IsInitialized.store(false, std::memory_order_release);
 
-	//Cancel both contexts BEFORE taking the operation mutexes - wakes up any worker thread blocked in pubnub_await so it can release the lock promptly.
-	if(ctx_pub) { pubnub_cancel(ctx_pub); }
-	if(ctx_ee)  { pubnub_cancel(ctx_ee);  }
+	//Cancel all contexts BEFORE taking the operation locks - wakes up any thread blocked in pubnub_await so it can release its context promptly.
+	if(ContextPool) { ContextPool->CancelAll(); }
+	if(ctx_ee)      { pubnub_cancel(ctx_ee);    }
 
 	CancelPendingSubscriptionOperation(TEXT("Subscription operation cancelled because PubnubClient is being deinitialized."));
+	CancelQueuedSubscriptionChanges(TEXT("Subscription operation cancelled because PubnubClient is being deinitialized."));
+	CancelSubscribeRetry();
 
 	if(PubnubCallsThread)
 	{
@@ -2387,20 +2856,25 @@ void UPubnubClient::DeinitializeClient()
 
 	PubnubSubsystem = nullptr;
 
-	//Hold BOTH context mutexes during teardown: ctx_pub is guarded by PubnubOperationMutex, ctx_ee by SubscriptionOperationExecutionMutex.
-	//Lock order Subscription -> Operation matches every other path in this class (sync *_priv take only Operation; subscribe *_priv take only Subscription), so nesting cannot deadlock.
+	//Stays false only if ctx_ee couldn't be freed in time, C-Core can then still call client listeners
+	bool bSubscribeContextFreed = true;
+
+	//Hold ALL context locks during teardown: pooled contexts are guarded by ContextPool checkouts, ctx_ee by SubscriptionOperationExecutionMutex.
+	//Lock order Subscription -> Pool matches every other path in this class (sync *_priv only try to check out a single pooled context; subscribe *_priv take only Subscription), so nesting cannot deadlock.
 	{
 		FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
 
 		//Unsubscribes and cleans up subscription maps; touches ctx_ee.
 		UnsubscribeAllForDeinit();
 
-		FScopeLock OperationLock(&PubnubOperationMutex);
+		//Auth token swap doesn't take the locks above, it only needs the contexts to stay alive while it publishes the token.
+		FScopeLock AuthTokenLock(&AuthTokenMutex);
+		FPubnubContextPoolExclusiveLock PoolLock(ContextPool);
 
-		if(ctx_pub && ctx_ee)
+		if(ContextPool && ctx_ee)
 		{
 			//We set this to prevent crash from C-Core when it's trying to clean up provider made in UE
-			pubnub_set_crypto_module(ctx_pub, nullptr);
+			ContextPool->ForEachContext([](pubnub_t* Context){ pubnub_set_crypto_module(Context, nullptr); });
 			pubnub_set_crypto_module(ctx_ee, nullptr);
 
 			//Clean up Crypto bridge if it was created
@@ -2411,66 +2885,197 @@ void UPubnubClient::DeinitializeClient()
 
 			PUBNUB_LOG_FUNCTION_TRACE(TEXT("Start freeing C-Core contexts."));
 
-			//Drain any residual cancelled operation on the SYNC context. No-op if ctx is idle.
-			pubnub_await(ctx_pub);
-
-			pubnub_logger_remove_all(ctx_pub);
+			ContextPool->ForEachContext([](pubnub_t* Context){ pubnub_logger_remove_all(Context); });
 			pubnub_logger_remove_all(ctx_ee);
 			pubnub_logger_free(&CCoreLogger);
 
-			pubnub_free(ctx_pub);
-			pubnub_free_with_timeout(ctx_ee, 2000);
+			//Subscriptions were freed by UnsubscribeAllForDeinit, cached entities are the last thing using ctx_ee
+			if(CCoreEntityCache)
+			{
+				CCoreEntityCache->FreeEntities();
+			}
+
+			//Drains any residual cancelled operation on the SYNC contexts before freeing them.
+			ContextPool->FreeContexts();
+			bSubscribeContextFreed = pubnub_free_with_timeout(ctx_ee, 2000) == 0;
 
-			ctx_pub = nullptr;
 			ctx_ee = nullptr;
 			PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("C-Core contexts freed."));
 		}
 	}
 
+	//Messages that were not delivered yet are dropped. Listener still running on a context that wasn't freed keeps the queue alive through its user data
+	FTSTicker::GetCoreTicker().RemoveTicker(ReceivedMessagesTickerHandle);
+	ReceivedMessagesTickerHandle.Reset();
+	ReceivedMessageQueue.Reset();
+	if(bSubscribeContextFreed)
+	{
+		delete ClientListenerUserData;
+	}
+	else
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(TEXT("subscribe context was not freed in time, its listener data is kept alive."));
+	}
+	ClientListenerUserData = nullptr;
+	ReceivedNativeMessagesBatch.Empty();
+	ReceivedMessagesBatch.Empty();
+	UnbindAllChannelHandlers();
+	TokenCache.Reset();
+	delete CCoreEntityCache;
+	CCoreEntityCache = nullptr;
+	{
+		FScopeLock SubscriptionPoolLock(&SubscriptionPoolMutex);
+		PooledSubscriptions.Empty();
+	}
+	{
+		FScopeLock EntityObjectsLock(&EntityObjectsMutex);
+		EntityObjects.Empty();
+	}
+
 	IsUserIDSet = false;
 	delete[] AuthTokenBuffer;
 	AuthTokenBuffer = nullptr;
 	AuthTokenLength = 0;
-	for (char* RetiredBuffer : RetiredAuthTokenBuffers)
+	AuthTokenGeneration = 0;
+	for (const FRetiredAuthToken& RetiredToken : RetiredAuthTokenBuffers)
 	{
-		delete[] RetiredBuffer;
+		delete[] RetiredToken.Buffer;
 	}
 	RetiredAuthTokenBuffers.Empty();
 	delete[] OriginBuffer;
 	OriginBuffer = nullptr;
 	OriginLength = 0;
+	delete[] FilterExpressionBuffer;
+	FilterExpressionBuffer = nullptr;
+	{
+		FScopeLock FilterExpressionLock(&SubscribeFilterExpressionMutex);
+		SubscribeFilterExpression.Empty();
+	}
 	delete[] RuntimeSdkVersionSuffixBuffer;
 	RuntimeSdkVersionSuffixBuffer = nullptr;
 	RuntimeSdkVersionSuffixLength = 0;
 	delete PubnubCallsThread;
 	PubnubCallsThread = nullptr;
+	delete ContextPool;
+	ContextPool = nullptr;
 
 	//Notify that Deinitialization is finished
 	OnClientDeinitialized.Broadcast();
 	PUBNUB_LOG_FUNCTION_INFO(TEXT("client deinitialization finished."));
 
+	//Make sure all queued messages reach loggers before the client lets them go
+	if (LoggerManager)
+	{
+		LoggerManager->DisableAsyncDispatch();
+	}
 	DefaultLogger = nullptr;
 	LoggerManager = nullptr;
 }
 
+bool UPubnubClient::DeliverReceivedMessages(float DeltaTime)
+{
+	//Logger levels can be changed at any moment, C-Core gets the new minimum level on the next frame
+	SyncCCoreLogLevel();
+
+	//Keep the queue alive even if one of the delegates deinitializes the client
+	TSharedPtr<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe> Queue = ReceivedMessageQueue;
+	if(!Queue)
+	{
+		return true;
+	}
+
+	if(const uint64 DroppedCount = Queue->TakeDroppedCount())
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("received message queue was full, %llu messages were dropped. Increase ReceivedMessageQueueCapacity in FPubnubConfig."), DroppedCount));
+	}
+
+	const int32 Budget = MessageDeliveryBudgetPerFrame > 0 ? MessageDeliveryBudgetPerFrame : MAX_int32;
+	int32 DeliveredCount = 0;
+	ReceivedNativeMessagesBatch.Reset();
+
+	FPubnubReceivedMessage Received;
+	while(DeliveredCount < Budget && Queue->TryPop(Received))
+	{
+		DeliveredCount++;
+		if(Received.bForClient)
+		{
+			ReceivedNativeMessagesBatch.Add(MoveTemp(Received.Message));
+		}
+		else if(UPubnubSubscriptionBase* Subscription = Received.Subscription.Get())
+		{
+			if(Received.ListenerGeneration == Subscription->ListenerGeneration)
+			{
+				Subscription->BroadcastReceivedMessage(Received.Message, Received.ListenerType);
+			}
+		}
+	}
+
+	if(ReceivedNativeMessagesBatch.IsEmpty())
+	{
+		return true;
+	}
+
+	//Move the batch out, delegates below can deinitialize the client or even trigger another delivery
+	TArray<FPubnubNativeMessage> NativeBatch = MoveTemp(ReceivedNativeMessagesBatch);
+	TArray<FPubnubMessageData> Batch = MoveTemp(ReceivedMessagesBatch);
+	Batch.Reset();
+	if(OnMessagesReceivedBatch.IsBound())
+	{
+		for(const FPubnubNativeMessage& NativeMessage : NativeBatch)
+		{
+			Batch.Add(NativeMessage.ToMessageData());
+		}
+		OnMessagesReceivedBatch.Broadcast(Batch);
+	}
+
+	for(int32 Index = 0; Index < NativeBatch.Num(); Index++)
+	{
+		if(!IsInitialized)
+		{
+			break;
+		}
+		const FPubnubNativeMessage& NativeMessage = NativeBatch[Index];
+		OnNativeMessageReceived.Broadcast(NativeMessage);
+
+		//Blueprint struct is built at most once per message, and only if a delegate or channel handler takes it
+		const FPubnubMessageData* MessageData = Batch.IsValidIndex(Index) ? &Batch[Index] : nullptr;
+		TOptional<FPubnubMessageData> BuiltMessageData;
+		auto GetMessageData = [&NativeMessage, &MessageData, &BuiltMessageData]() -> const FPubnubMessageData&
+		{
+			if(!MessageData)
+			{
+				BuiltMessageData = NativeMessage.ToMessageData();
+				MessageData = &BuiltMessageData.GetValue();
+			}
+			return *MessageData;
+		};
+
+		if(OnMessageReceived.IsBound() || OnMessageReceivedNative.IsBound())
+		{
+			OnMessageReceived.Broadcast(GetMessageData());
+			OnMessageReceivedNative.Broadcast(GetMessageData());
+		}
+		if(IsInitialized)
+		{
+			RouteMessageToChannelHandlers(NativeMessage, GetMessageData);
+		}
+	}
+
+	//Give the allocations back, so the next frame doesn't need new ones. Resetting the native batch returns its blocks to the arena
+	NativeBatch.Reset();
+	Batch.Reset();
+	ReceivedNativeMessagesBatch = MoveTemp(NativeBatch);
+	ReceivedMessagesBatch = MoveTemp(Batch);
+	return true;
+}
+
 void UPubnubClient::DecryptHistoryMessages(TArray<FPubnubHistoryMessageData>& Messages)
 {
 	//If crypto module is not set, we can't encrypt anything
 	if(!CryptoBridge || !CryptoBridge->GetUECryptoModule() || !CryptoBridge->GetUECryptoModule().GetObject())
 	{ return; }
 
-	for(auto& Message : Messages)
-	{
-		FString ReworkedMessage = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(CryptoBridge->GetUECryptoModule().GetObject(), Message.Message);
-	
-		// If encryption failed - for example when history message was not encrypted, but crypto module is set, just leave the message as it is
-		if(ReworkedMessage.IsEmpty())
-		{ continue; }
-
-		//Not encrypted messages are deserialized automatically, but in case of encrypted once we need to Deserialize them ourselves
-		ReworkedMessage = UPubnubJsonUtilities::DeserializeString(ReworkedMessage);
-		Message.Message = ReworkedMessage;
-	}
+	UPubnubCryptoUtilities::DecryptHistoryMessages(CryptoBridge->GetUECryptoModule().GetObject(), Messages);
 }
 
 void UPubnubClient::SavePubnubConfig(const FPubnubConfig& InConfig)
@@ -2579,6 +3184,7 @@ void UPubnubClient::OnCCoreSubscriptionStatusReceived(int StatusEnum, const void
 	Result.Status = Result.Error ? 503 : 200;
 	Result.ErrorMessage = status_data ? FString(pubnub_res_2_string(status_data->reason)) : TEXT("No status data.");
 	CompletePendingSubscriptionOperation(Result);
+	const int32 RetryCount = HandleSubscribeRetry(StatusEnum);
 	if (Result.Error)
 	{
 		PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("subscription status processed. Status=%d, Reason=%s"), StatusEnum, *Result.ErrorMessage));
@@ -2594,6 +3200,7 @@ void UPubnubClient::OnCCoreSubscriptionStatusReceived(int StatusEnum, const void
 
 	FPubnubSubscriptionStatusData SubscriptionStatusData;
 	SubscriptionStatusData.Reason = status_data ? FString(pubnub_res_2_string(status_data->reason)) : TEXT("No status data.");
+	SubscriptionStatusData.RetryCount = RetryCount;
 
 	//If status is disconnected we don't need to give subscribed channels
 	if(status_data && status != PNSS_SUBSCRIPTION_STATUS_DISCONNECTED)
@@ -2628,71 +3235,177 @@ void UPubnubClient::OnCCoreSubscriptionStatusReceived(int StatusEnum, const void
 	});
 }
 
+int32 UPubnubClient::HandleSubscribeRetry(int StatusEnum)
+{
+	const pubnub_subscription_status Status = static_cast<pubnub_subscription_status>(StatusEnum);
+	const FPubnubRetryConfig& RetryConfig = PubnubConfig.RetryConfig;
+
+	FScopeLock RetryLock(&SubscribeRetryMutex);
+	const int32 RetriesDone = SubscribeRetryCount;
+	if(Status == PNSS_SUBSCRIPTION_STATUS_CONNECTED)
+	{
+		SubscribeRetryCount = 0;
+		return RetriesDone;
+	}
+	if(Status != PNSS_SUBSCRIPTION_STATUS_CONNECTION_ERROR && Status != PNSS_SUBSCRIPTION_STATUS_DISCONNECTED_UNEXPECTEDLY)
+	{
+		return RetriesDone;
+	}
+	//Reconnection is already waiting for its delay
+	if(SubscribeRetryTickerHandle.IsValid() || !IsInitialized.load(std::memory_order_acquire))
+	{
+		return RetriesDone;
+	}
+	if(!UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_Subscribe, RetriesDone))
+	{
+		if(RetriesDone > 0)
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("subscribe loop didn't reconnect after %d retries. Call ReconnectSubscriptions to try again."), RetriesDone));
+		}
+		return RetriesDone;
+	}
+
+	const float DelaySeconds = UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, RetriesDone, FMath::FRand());
+	SubscribeRetryCount++;
+	PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("reconnecting subscribe loop, retry %d of %d in %.2f s."), SubscribeRetryCount, RetryConfig.MaxRetries, DelaySeconds));
+
+	//One-shot ticker, the reconnection itself runs on the calls thread like every other subscription change
+	SubscribeRetryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		FScopeLock RetryLock(&SubscribeRetryMutex);
+		if(SubscribeRetryTickerHandle.IsValid() && IsInitialized.load(std::memory_order_acquire))
+		{
+			SubscribeRetryTickerHandle.Reset();
+
+			TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
+			PubnubCallsThread->AddFunctionToQueue([WeakThis]
+			{
+				if(!WeakThis.IsValid())
+				{return;}
+
+				WeakThis.Get()->ReconnectSubscriptionsForRetry_priv();
+			}, EPubnubOperationClass::StateChange);
+		}
+		return false;
+	}), DelaySeconds);
+	return RetriesDone;
+}
+
+void UPubnubClient::ReconnectSubscriptionsForRetry_priv()
+{
+	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+	if(!IsInitialized.load(std::memory_order_acquire) || !ctx_ee)
+	{return;}
+
+	//Result of the reconnection comes as a new subscription status, which schedules the next retry if it fails again
+	const pubnub_res ReconnectResult = pubnub_reconnect(ctx_ee, nullptr);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("reconnect call finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(ReconnectResult))));
+}
+
+void UPubnubClient::CancelSubscribeRetry()
+{
+	FTSTicker::FDelegateHandle TickerHandle;
+	{
+		FScopeLock RetryLock(&SubscribeRetryMutex);
+		TickerHandle = SubscribeRetryTickerHandle;
+		SubscribeRetryTickerHandle.Reset();
+		SubscribeRetryCount = 0;
+	}
+
+	if(TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
 FString UPubnubClient::GetLastResponse(pubnub_t* context)
 {
-	FString Response;
-	
+	return UPubnubUtilities::Utf8ViewToString(GetLastResponseView(context));
+}
+
+int UPubnubClient::AwaitAttempt_priv(pubnub_t* Context, EPubnubRetryEndpoint Endpoint, TFunctionRef<int()> StartTransaction, int32 RetriesDone, float* OutRetryDelaySeconds)
+{
+	if(OutRetryDelaySeconds)
+	{
+		*OutRetryDelaySeconds = -1.0f;
+	}
+
+	pubnub_res Result = static_cast<pubnub_res>(StartTransaction());
+	const bool bStarted = Result == PNR_STARTED;
+	if(bStarted)
+	{
+		Result = pubnub_await(Context);
+	}
+
+	//HTTP code is left from the previous transaction if this one didn't start
+	const int32 HttpStatus = bStarted ? pubnub_last_http_code(Context) : 0;
+	const FPubnubRetryConfig& RetryConfig = PubnubConfig.RetryConfig;
+	if(OutRetryDelaySeconds && IsInitialized.load(std::memory_order_acquire)
+		&& UPubnubInternalUtilities::IsRetryableResult(Endpoint, Result, HttpStatus) && UPubnubInternalUtilities::CanRetry(RetryConfig, Endpoint, RetriesDone))
+	{
+		*OutRetryDelaySeconds = UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, RetriesDone, FMath::FRand());
+		PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("request failed with %s (HTTP %d), retry %d of %d in %.2f s."),
+			UTF8_TO_TCHAR(pubnub_res_2_string(Result)), HttpStatus, RetriesDone + 1, RetryConfig.MaxRetries, *OutRetryDelaySeconds));
+	}
+	return Result;
+}
+
+FAnsiStringView UPubnubClient::GetLastResponseView(pubnub_t* context)
+{
 	if(!context)
-	{return Response;}
+	{return FAnsiStringView();}
 	
 	pubnub_res PubnubResponse = pubnub_await(context);
 	if (PNR_OK == PubnubResponse)
 	{
-
-		//Convert it keeping UTF8 characters valid
 		const char* CharResponse = pubnub_get(context);
-		FUTF8ToTCHAR Converter(CharResponse);
-		Response = FString(Converter.Length(), Converter.Get());
-	}
-	else
-	{
-		PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to get last response. Error: %s."), UTF8_TO_TCHAR(pubnub_res_2_string(static_cast<pubnub_res>(PubnubResponse)))));
+		return CharResponse ? FAnsiStringView(CharResponse) : FAnsiStringView();
 	}
-	return Response;
+
+	PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to get last response. Error: %s."), UTF8_TO_TCHAR(pubnub_res_2_string(static_cast<pubnub_res>(PubnubResponse)))));
+	return FAnsiStringView();
 }
 
-FString UPubnubClient::GetResponseForGetObject(pubnub_t* context)
+FAnsiStringView UPubnubClient::GetResponseViewForGetObject(pubnub_t* context)
 {
-	FString Response;
-
 	if (!context)
-	{ return Response; }
+	{ return FAnsiStringView(); }
 
 	const pubnub_res AwaitResult = pubnub_await(context);
 	const bool bAwaitOk = (PNR_OK == AwaitResult);
 
+	FAnsiStringView Response;
 	if (bAwaitOk)
 	{
 		const char* CharResponse = pubnub_get(context);
-		FUTF8ToTCHAR Converter(CharResponse);
-		Response = FString(Converter.Length(), Converter.Get());
+		Response = CharResponse ? FAnsiStringView(CharResponse) : FAnsiStringView();
 	}
 
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *Response));
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(Response)));
 
 	if (Response.IsEmpty())
 	{
-		Response = UPubnubUtilities::PubnubGetLastServerHttpResponse(context);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *Response));
+		Response = UPubnubUtilities::PubnubGetLastServerHttpResponseView(context);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(Response)));
 	}
 
-	const FPubnubOperationResult HttpResult = UPubnubJsonUtilities::GetOperationResultFromJson_AppContext(Response);
+	const FPubnubOperationResult HttpResult = UPubnubJsonUtilities::GetOperationResultFromJson_AppContext(Response.GetData(), Response.Len());
 
 	if (HttpResult.Error)
 	{
 		if (HttpResult.Status == 404)
 		{
-			PUBNUB_LOG_FUNCTION(EPubnubLogLevel::PLL_Debug, FString::Printf(TEXT("Objects get returned HTTP 404 (not found). Server response: %s"), *Response));
+			PUBNUB_LOG_FUNCTION(EPubnubLogLevel::PLL_Debug, FString::Printf(TEXT("Objects get returned HTTP 404 (not found). Server response: %s"), *UPubnubUtilities::Utf8ViewToString(Response)));
 		}
 		else
 		{
-			PUBNUB_LOG_FUNCTION(EPubnubLogLevel::PLL_Error, FString::Printf(TEXT("Objects get failed (HTTP %d). Server response: %s"), HttpResult.Status, *Response));
+			PUBNUB_LOG_FUNCTION(EPubnubLogLevel::PLL_Error, FString::Printf(TEXT("Objects get failed (HTTP %d). Server response: %s"), HttpResult.Status, *UPubnubUtilities::Utf8ViewToString(Response)));
 		}
 	}
 	else if (!bAwaitOk)
 	{
 		PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to get last response. Error: %s. Server response: %s"),
-			UTF8_TO_TCHAR(pubnub_res_2_string(static_cast<pubnub_res>(AwaitResult))), *Response));
+			UTF8_TO_TCHAR(pubnub_res_2_string(static_cast<pubnub_res>(AwaitResult))), *UPubnubUtilities::Utf8ViewToString(Response)));
 	}
 
 	return Response;
@@ -2740,18 +3453,23 @@ void UPubnubClient::InitPubnub_priv(const FPubnubConfig& Config)
 		return;
 	}
 	
-	FScopeLock OperationLock(&PubnubOperationMutex);
-
-	ctx_pub = pubnub_alloc();
+	//No other thread can reach the contexts before IsInitialized is set, so they can be set up without locking the pool
+	ContextPool = new FPubnubContextPool(Config.ContextPoolSize, Config.AsyncWorkerCount);
+	if(!ContextPool->AllocateContexts(PublishKey, SubscribeKey))
+	{
+		PUBNUB_LOG_FUNCTION_ERROR(TEXT("Failed to allocate C-Core contexts, can't initialize Pubnub"));
+		delete ContextPool;
+		ContextPool = nullptr;
+		return;
+	}
 	ctx_ee = pubnub_alloc();
-	PUBNUB_LOG_FUNCTION_TRACE(TEXT("C-Core contexts allocated."));
-	
-	pubnub_enforce_api(ctx_pub, PNA_SYNC);
 	pubnub_enforce_api(ctx_ee, PNA_CALLBACK);
-
-	pubnub_init(ctx_pub, PublishKey, SubscribeKey);
 	pubnub_init(ctx_ee, PublishKey, SubscribeKey);
-	PUBNUB_LOG_FUNCTION_TRACE(TEXT("C-Core contexts initialized."));
+	//Applied before the first transaction, so even the first connection of every context uses it
+	ContextPool->ForEachContext([this, &Config](pubnub_t* Context){ ApplyNetworkingConfig_priv(Context, Config.NetworkingConfig, false); });
+	ApplyNetworkingConfig_priv(ctx_ee, Config.NetworkingConfig, true);
+	CCoreEntityCache = new FPubnubCCoreEntityCache(Config.EntityCacheCapacity);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("C-Core contexts allocated and initialized. SharedContexts=%d, ReservedContexts=%d"), ContextPool->Num() - ContextPool->NumReserved(), ContextPool->NumReserved()));
 	AttachCCoreLogger();
 	
 	SetRuntimeSdkVersionSuffix_priv(UPubnubInternalUtilities::GetPubnubSdkVersionSuffix());
@@ -2783,26 +3501,87 @@ void UPubnubClient::InitPubnub_priv(const FPubnubConfig& Config)
 	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(TEXT("InitPubnub_priv finished successfully."));
 }
 
-void UPubnubClient::SetUserID_priv(FString UserID)
+void UPubnubClient::ApplyNetworkingConfig_priv(pubnub_t* Context, const FPubnubNetworkingConfig& NetworkingConfig, bool bIsSubscribeContext)
 {
-	PUBNUB_RETURN_IF_FIELD_EMPTY(UserID);
+	if(NetworkingConfig.bUseHttpKeepAlive)
+	{
+		pubnub_use_http_keep_alive(Context);
+	}
+	else
+	{
+		pubnub_dont_use_http_keep_alive(Context);
+	}
 
-	FUTF8StringHolder UserIDHolder(UserID);
-	pubnub_set_user_id(ctx_pub, UserIDHolder.Get());
-	pubnub_set_user_id(ctx_ee, UserIDHolder.Get());
+	if(NetworkingConfig.bUseTcpKeepAlive)
+	{
+		pubnub_use_tcp_keep_alive(Context,
+			static_cast<uint8>(FMath::Clamp(NetworkingConfig.TcpKeepAliveIdleSeconds, 1, 255)),
+			static_cast<uint8>(FMath::Clamp(NetworkingConfig.TcpKeepAliveIntervalSeconds, 1, 255)),
+			static_cast<uint8>(FMath::Clamp(NetworkingConfig.TcpKeepAliveProbes, 1, 255)));
+	}
+	else
+	{
+		pubnub_dont_use_tcp_keep_alive(Context);
+	}
 
-	IsUserIDSet = true;
-}
+	//Subscribe is a long-poll, shorter timeout would end every idle subscribe request with a timeout
+	if(!bIsSubscribeContext && NetworkingConfig.TransactionTimeoutMs > 0)
+	{
+		pubnub_set_transaction_timeout(Context, FMath::Max(NetworkingConfig.TransactionTimeoutMs, PUBNUB_MIN_TRANSACTION_TIMER));
+	}
 
-FString UPubnubClient::GetUserID_priv()
-{
-	if(const char* UserIDChar = pubnub_user_id_get(ctx_pub))
+	if(NetworkingConfig.WaitConnectTimeoutMs > 0)
 	{
-		FString UserIDString(UserIDChar);
-		return UserIDString;
+		pubnub_set_wait_connect_timeout(Context, FMath::Max(NetworkingConfig.WaitConnectTimeoutMs, PUBNUB_MIN_WAIT_CONNECT_TIMER));
 	}
 
-	return "";
+#if PUBNUB_SET_DNS_SERVERS
+	//C-Core parses the address, so the converted string doesn't have to outlive the call.
+	//Parsing gives the same result on every context, so failures are reported only once, for the subscribe context
+	if(!NetworkingConfig.PrimaryDnsServer.IsEmpty())
+	{
+		FUTF8StringHolder DnsServerHolder(NetworkingConfig.PrimaryDnsServer);
+		if(pubnub_dns_set_primary_server_ipv4_str(Context, DnsServerHolder.Get()) != 0 && bIsSubscribeContext)
+		{
+			PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("Failed to set primary DNS server %s. It has to be an IPv4 address."), *NetworkingConfig.PrimaryDnsServer));
+		}
+	}
+	if(!NetworkingConfig.SecondaryDnsServer.IsEmpty())
+	{
+		FUTF8StringHolder DnsServerHolder(NetworkingConfig.SecondaryDnsServer);
+		if(pubnub_dns_set_secondary_server_ipv4_str(Context, DnsServerHolder.Get()) != 0 && bIsSubscribeContext)
+		{
+			PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("Failed to set secondary DNS server %s. It has to be an IPv4 address."), *NetworkingConfig.SecondaryDnsServer));
+		}
+	}
+#else
+	if(bIsSubscribeContext && (!NetworkingConfig.PrimaryDnsServer.IsEmpty() || !NetworkingConfig.SecondaryDnsServer.IsEmpty()))
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(TEXT("DNS servers can't be set, C-Core is built without PUBNUB_SET_DNS_SERVERS."));
+	}
+#endif
+}
+
+void UPubnubClient::SetUserID_priv(FString UserID)
+{
+	PUBNUB_RETURN_IF_FIELD_EMPTY(UserID);
+
+	FUTF8StringHolder UserIDHolder(UserID);
+	ContextPool->ForEachContext([&UserIDHolder](pubnub_t* Context){ pubnub_set_user_id(Context, UserIDHolder.Get()); });
+	pubnub_set_user_id(ctx_ee, UserIDHolder.Get());
+
+	IsUserIDSet = true;
+}
+
+FString UPubnubClient::GetUserID_priv()
+{
+	if(const char* UserIDChar = pubnub_user_id_get(ContextPool->GetPrimaryContext()))
+	{
+		FString UserIDString(UserIDChar);
+		return UserIDString;
+	}
+
+	return "";
 }
 
 void UPubnubClient::SetSecretKey_priv()
@@ -2813,12 +3592,12 @@ void UPubnubClient::SetSecretKey_priv()
 		return;
 	}
 	
-	pubnub_set_secret_key(ctx_pub, SecretKey);
+	ContextPool->ForEachContext([this](pubnub_t* Context){ pubnub_set_secret_key(Context, SecretKey); });
 	pubnub_set_secret_key(ctx_ee, SecretKey);
 }
 
 
-FPubnubPublishMessageResult UPubnubClient::PublishMessage_priv(FString Channel, FString Message, FPubnubPublishSettings PublishSettings)
+FPubnubPublishMessageResult UPubnubClient::PublishMessage_priv(FString Channel, FString Message, FPubnubPublishSettings PublishSettings, int32 RetriesDone, float* OutRetryDelaySeconds)
 {
 	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
 		PUBNUB_LOG_INPUT(Channel),
@@ -2831,43 +3610,194 @@ FPubnubPublishMessageResult UPubnubClient::PublishMessage_priv(FString Channel,
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Message, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
-	FString FinalMessage = Message;
+	const FPubnubPublishRequest Request({Channel, Message, PublishSettings});
+	TUniquePtr<FPubnubInternalPublishTransaction> Transaction;
+	bool bStarted = false;
+	const pubnub_res PublishResultStatus = static_cast<pubnub_res>(AwaitAttempt_priv(ctx_pub, EPubnubRetryEndpoint::PRE_MessageSend, [&]()
+	{
+		bStarted = StartPublish_priv(ctx_pub, Request, Transaction, FinalResult);
+		return bStarted ? PNR_STARTED : PNR_INVALID_PARAMETERS;
+	}, RetriesDone, OutRetryDelaySeconds));
+	FinalResult.Result.RetryCount = RetriesDone;
+	if(!bStarted)
+	{
+		return FinalResult;
+	}
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("publish await finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(PublishResultStatus))));
+	
+	FinalResult = FinishPublish_priv(ctx_pub, Request);
+	FinalResult.Result.RetryCount = RetriesDone;
+	return FinalResult;
+}
+
+TArray<FPubnubPublishMessageResult> UPubnubClient::PublishBatch_priv(const TArray<FPubnubPublishRequest>& Requests)
+{
+	const int32 RequestsCount = Requests.Num();
+	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
+		PUBNUB_LOG_INPUT(RequestsCount)
+	);
+
+	TArray<FPubnubPublishMessageResult> Results;
+	Results.SetNum(Requests.Num());
+	if(Requests.IsEmpty())
+	{
+		return Results;
+	}
+
+	//Validation that applies to the whole batch sets the same error on every result
+	auto FailWholeBatch = [&Results](const FString& ErrorMessage)
+	{
+		for(FPubnubPublishMessageResult& Result : Results)
+		{
+			Result.Result.Error = true;
+			Result.Result.ErrorMessage = ErrorMessage;
+		}
+	};
+
+	if(!IsUserIDSet)
+	{
+		PUBNUB_LOG_FUNCTION_ERROR(TEXT("Pubnub user ID is not set. Aborting operation."));
+		FailWholeBatch(TEXT("Pubnub user ID is not set. Operation aborted."));
+		return Results;
+	}
+
+	//Check out as many contexts as the batch can use. At least one is needed, so only the first one is waited for, the rest is a bonus
+	TArray<TUniquePtr<FPubnubContextLease>> Leases;
+	while(Leases.Num() < Requests.Num())
+	{
+		TUniquePtr<FPubnubContextLease> Lease = MakeUnique<FPubnubContextLease>(ContextPool);
+		const uint32 TimeoutMs = Leases.IsEmpty() ? static_cast<uint32>(FMath::Max(0, PubnubConfig.ContextAcquireTimeoutMs)) : 0;
+		if(!Lease->TryAcquire(TimeoutMs))
+		{
+			break;
+		}
+		Leases.Add(MoveTemp(Lease));
+	}
+
+	if(Leases.IsEmpty())
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(TEXT("No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently."));
+		FailWholeBatch(TEXT("No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently."));
+		return Results;
+	}
+
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("pipelining %d publishes over %d contexts"), Requests.Num(), Leases.Num()));
+
+	FCriticalSection NextRequestMutex;
+	int32 NextRequestIndex = 0;
+
+	//Publishes requests on one context until the batch runs out of them. Every leased context takes the next request as soon as its previous one finishes
+	auto DriveContext = [&](pubnub_t* Context)
+	{
+		while(true)
+		{
+			int32 RequestIndex = INDEX_NONE;
+			{
+				FScopeLock NextRequestLock(&NextRequestMutex);
+				if(NextRequestIndex >= Requests.Num())
+				{
+					return;
+				}
+				RequestIndex = NextRequestIndex++;
+			}
+
+			const FPubnubPublishRequest& Request = Requests[RequestIndex];
+			FPubnubPublishMessageResult& Result = Results[RequestIndex];
+			if(Request.Channel.IsEmpty() || Request.Message.IsEmpty())
+			{
+				Result.Result.Error = true;
+				Result.Result.ErrorMessage = FString::Printf(TEXT("Missing required input: '%s' (field is empty). Operation aborted."), Request.Channel.IsEmpty() ? TEXT("Channel") : TEXT("Message"));
+				continue;
+			}
+
+			//Leases of the batch are not taken through PUBNUB_ACQUIRE_CONTEXT_* macros, so every request is counted here
+			ContextPool->RecordRequest(Context);
+			TUniquePtr<FPubnubInternalPublishTransaction> Transaction;
+			if(!StartPublish_priv(Context, Request, Transaction, Result))
+			{
+				continue;
+			}
+
+			//Blocks only this context's driver, pubnub_await also enforces the transaction timeout
+			pubnub_await(Context);
+			Result = FinishPublish_priv(Context, Request);
+		}
+	};
+
+	//Every additional context is driven by a pool thread, the calling thread drives the first one.
+	//Waiting for a driver blocks on the event of its future, which is triggered when its last transaction completes
+	TArray<TFuture<void>> Drivers;
+	Drivers.Reserve(Leases.Num() - 1);
+	for(int32 i = 1; i < Leases.Num(); i++)
+	{
+		pubnub_t* Context = Leases[i]->Get();
+		Drivers.Add(Async(EAsyncExecution::ThreadPool, [&DriveContext, Context]
+		{
+			DriveContext(Context);
+		}));
+	}
+
+	DriveContext(Leases[0]->Get());
+	for(TFuture<void>& Driver : Drivers)
+	{
+		Driver.Wait();
+	}
+
+	return Results;
+}
+
+bool UPubnubClient::StartPublish_priv(pubnub_t* Context, const FPubnubPublishRequest& Request, TUniquePtr<FPubnubInternalPublishTransaction>& OutTransaction, FPubnubPublishMessageResult& OutErrorResult)
+{
+	FString FinalMessage = Request.Message;
 
 	//If provided string is not a valid Json object or array, we treat it as literal string and serialize it
-	if(!UPubnubJsonUtilities::IsCorrectJsonString(Message, false))
+	if(!UPubnubJsonUtilities::IsCorrectJsonString(Request.Message, false))
 	{
 		FinalMessage = UPubnubJsonUtilities::SerializeString(FinalMessage);
 		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("serialized non-JSON message payload. Final serialized message: %s"), *FinalMessage));
 	}
 
-	FUTF8StringHolder MessageHolder(FinalMessage);
-	FUTF8StringHolder ChannelHolder(Channel);
+	OutTransaction = MakeUnique<FPubnubInternalPublishTransaction>(Request.Channel, FinalMessage, Request.PublishSettings);
 	
 	//Convert all UE PublishSettings to Pubnub PublishOptions
-	
-	//Converted char needs to live in function scope, so we need to create it here
 	pubnub_publish_options PubnubOptions;
-	
-	FUTF8StringHolder MetaHolder(PublishSettings.MetaData);
-	FUTF8StringHolder CustomMessageTypeHolder(PublishSettings.CustomMessageType);
-	PubnubOptions.meta = MetaHolder.Get();
-	PubnubOptions.custom_message_type = CustomMessageTypeHolder.Get();
-	
-	UPubnubInternalUtilities::PublishUESettingsToPubnubPublishOptions(PublishSettings, PubnubOptions);
-	pubnub_publish_ex(ctx_pub, ChannelHolder.Get(), MessageHolder.Get(), PubnubOptions);
+	PubnubOptions.meta = OutTransaction->MetaHolder.Get();
+	PubnubOptions.custom_message_type = OutTransaction->CustomMessageTypeHolder.Get();
+	UPubnubInternalUtilities::PublishUESettingsToPubnubPublishOptions(Request.PublishSettings, PubnubOptions);
 
-	pubnub_res PublishResultStatus = pubnub_await(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("publish await finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(PublishResultStatus))));
+	//C-Core compresses the body itself with POST with GZIP, and falls back to plain POST if the message doesn't compress well
+	const EPubnubPublishMethod PublishMethod = UPubnubInternalUtilities::GetPublishMethodForMessageSize(Request.PublishSettings.PublishMethod, OutTransaction->MessageHolder.Length(), PublishCompressionThresholdBytes);
+	if(PublishMethod != Request.PublishSettings.PublishMethod)
+	{
+		PubnubOptions.method = (pubnub_method)(uint8)PublishMethod;
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("publishing large message with POST and GZIP. MessageSizeBytes=%d"), OutTransaction->MessageHolder.Length()));
+	}
+
+	pubnub_res StartResult = pubnub_publish_ex(Context, OutTransaction->ChannelHolder.Get(), OutTransaction->MessageHolder.Get(), PubnubOptions);
+	if(StartResult != PNR_STARTED)
+	{
+		OutTransaction.Reset();
+		OutErrorResult.Result.Error = true;
+		OutErrorResult.Result.ErrorMessage = pubnub_res_2_string(StartResult);
+		PUBNUB_LOG_OPERATION_RESULT(OutErrorResult.Result);
+		return false;
+	}
+	return true;
+}
+
+FPubnubPublishMessageResult UPubnubClient::FinishPublish_priv(pubnub_t* Context, const FPubnubPublishRequest& Request)
+{
+	pubnub_res PublishResultStatus = pubnub_last_result(Context);
 	
 	FPubnubMessageData PublishedMessage;
 	FPubnubOperationResult PublishResult;
 
 	//Fill data about Publish Result
-	PublishResult.Status = pubnub_last_http_code(ctx_pub);
-	PublishResult.ErrorMessage = pubnub_last_publish_result(ctx_pub);
+	PublishResult.Status = pubnub_last_http_code(Context);
+	PublishResult.ErrorMessage = pubnub_last_publish_result(Context);
 	PublishResult.Error = PublishResultStatus != PNR_OK;
 
 	PUBNUB_LOG_OPERATION_RESULT(PublishResult);
@@ -2882,13 +3812,13 @@ FPubnubPublishMessageResult UPubnubClient::PublishMessage_priv(FString Channel,
 	if(PublishResultStatus == PNR_OK)
 	{
 		//If result is ok, fill all data about published message
-		PublishedMessage.Message = Message;
-		PublishedMessage.Channel = Channel;
+		PublishedMessage.Message = Request.Message;
+		PublishedMessage.Channel = Request.Channel;
 		PublishedMessage.UserID = GetUserID_priv();
-		PublishedMessage.Timetoken = pubnub_last_publish_timetoken(ctx_pub);
-		PublishedMessage.Metadata = PublishSettings.MetaData;
+		PublishedMessage.Timetoken = pubnub_last_publish_timetoken(Context);
+		PublishedMessage.Metadata = Request.PublishSettings.MetaData;
 		PublishedMessage.MessageType = EPubnubMessageType::PMT_Published;
-		PublishedMessage.CustomMessageType = PublishSettings.CustomMessageType;
+		PublishedMessage.CustomMessageType = Request.PublishSettings.CustomMessageType;
 		PUBNUB_LOG_FUNCTION_DEBUG(
 			TEXT("published message: "),
 			PUBNUB_LOG_VALUE(PublishedMessage)
@@ -2897,7 +3827,7 @@ FPubnubPublishMessageResult UPubnubClient::PublishMessage_priv(FString Channel,
 	return FPubnubPublishMessageResult({PublishResult, PublishedMessage});
 }
 
-FPubnubSignalResult UPubnubClient::Signal_priv(FString Channel, FString Message, FPubnubSignalSettings SignalSettings)
+FPubnubSignalResult UPubnubClient::Signal_priv(FString Channel, FString Message, FPubnubSignalSettings SignalSettings, int32 RetriesDone, float* OutRetryDelaySeconds)
 {
 	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
 		PUBNUB_LOG_INPUT(Channel),
@@ -2910,8 +3840,8 @@ FPubnubSignalResult UPubnubClient::Signal_priv(FString Channel, FString Message,
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Message, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FString FinalMessage = Message;
 	//If provided string is not a valid Json object or array, we treat it as literal string and serialize it
@@ -2927,13 +3857,15 @@ FPubnubSignalResult UPubnubClient::Signal_priv(FString Channel, FString Message,
 	pubnub_signal_options PubnubOptions = pubnub_signal_defopts();
 	FUTF8StringHolder CustomMessageTypeHolder(SignalSettings.CustomMessageType);
 	PubnubOptions.custom_message_type = SignalSettings.CustomMessageType.IsEmpty() ? NULL : CustomMessageTypeHolder.Get();
-	pubnub_signal_ex(ctx_pub, ChannelHolder.Get(), MessageHolder.Get(), PubnubOptions);
-	
-	pubnub_res PublishResultStatus = pubnub_await(ctx_pub);
+	const pubnub_res PublishResultStatus = static_cast<pubnub_res>(AwaitAttempt_priv(ctx_pub, EPubnubRetryEndpoint::PRE_MessageSend, [&]()
+	{
+		return pubnub_signal_ex(ctx_pub, ChannelHolder.Get(), MessageHolder.Get(), PubnubOptions);
+	}, RetriesDone, OutRetryDelaySeconds));
 	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("signal await finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(PublishResultStatus))));
 
 	FPubnubMessageData SignalMessage;
 	FPubnubOperationResult PublishResult;
+	PublishResult.RetryCount = RetriesDone;
 
 	PublishResult.Status = pubnub_last_http_code(ctx_pub);
 	PublishResult.ErrorMessage = pubnub_last_publish_result(ctx_pub);
@@ -2975,244 +3907,793 @@ FPubnubOperationResult UPubnubClient::SubscribeToChannel_priv(FString Channel, F
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
 
-	//Create callback that will be triggered by the c-core event engine
-	pubnub_subscribe_message_callback_t Callback = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
+	pubnub_subscribe_message_callback_t Callback = &CCoreSubscriptionCallback::OnClientMessage;
+
+	FString StartFailureMessage = TEXT("Failed to subscribe to channel.");
+	//Allocation and ctx_ee access happen inside the lambda so they run under
+	//SubscriptionOperationExecutionMutex (taken by ExecuteSerializedSubscriptionOperation),
+	//preventing a race with DeinitializeClient freeing ctx_ee.
+	FPubnubOperationResult SubscribeResult = ExecuteSerializedSubscriptionOperation(
+		StartFailureMessage,
+		TEXT("Subscribe operation timed out"),
+		[&]()
+		{
+			//Guard against deinit having already freed ctx_ee while we were waiting for the lock.
+			if(!ctx_ee)
+			{
+				StartFailureMessage = TEXT("PubnubClient was deinitialized before the subscribe operation could run.");
+				return false;
+			}
+
+			//Dedup before allocating to avoid a wasted pubnub_subscription_alloc/free pair.
+			if(ChannelSubscriptions.Contains(Channel))
+			{
+				PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel '%s' already exists. Aborting operation."), *Channel));
+				StartFailureMessage = TEXT("Already subscribed to this channel. Aborting operation.");
+				return false;
+			}
+
+			pubnub_subscription_t* Subscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(ctx_ee, Channel, EPubnubEntityType::PEnT_Channel, SubscribeSettings, CCoreEntityCache);
+			if(!Subscription)
+			{
+				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to subscribe to channel '%s'. pubnub_subscription_alloc didn't create subscription."), *Channel));
+				StartFailureMessage = TEXT("Failed to subscribe to channel. pubnub_subscription_alloc didn't create subscription.");
+				return false;
+			}
+
+			ApplySubscribeFilterExpression_priv(SubscribeSettings.FilterExpression);
+			if(!UPubnubInternalUtilities::EEAddListenerAndSubscribe(Subscription, Callback, ClientListenerUserData))
+			{
+				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to add listener and subscribe for channel '%s'."), *Channel));
+				pubnub_subscription_free(&Subscription);
+				return false;
+			}
+
+			//Save callback and subscription so it can be unsubscribed later.
+			CCoreSubscriptionCallback* SubscriptionData = new CCoreSubscriptionCallback{Callback, Subscription, nullptr, SubscribeSettings.ReceivePresenceEvents};
+			ChannelSubscriptions.Add(Channel, SubscriptionData);
+			PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("channel subscription stored.\n\t-%s"), *PUBNUB_LOG_VALUE(Channel)));
+			return true;
+		});
+	PUBNUB_LOG_OPERATION_RESULT(SubscribeResult);
+	return SubscribeResult;
+}
+
+
+FPubnubOperationResult UPubnubClient::SubscribeToGroup_priv(FString ChannelGroup, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
+		PUBNUB_LOG_VALUE(ChannelGroup),
+		PUBNUB_LOG_VALUE(SubscribeSettings)
+	);
+	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
+
+	pubnub_subscribe_message_callback_t Callback = &CCoreSubscriptionCallback::OnClientMessage;
+
+	FString StartFailureMessage = TEXT("Failed to subscribe to channel group.");
+	//Allocation and ctx_ee access happen inside the lambda so they run under
+	//SubscriptionOperationExecutionMutex (taken by ExecuteSerializedSubscriptionOperation),
+	//preventing a race with DeinitializeClient freeing ctx_ee.
+	FPubnubOperationResult SubscribeResult = ExecuteSerializedSubscriptionOperation(
+		StartFailureMessage,
+		TEXT("Subscribe operation timed out"),
+		[&]()
+		{
+			//Guard against deinit having already freed ctx_ee while we were waiting for the lock.
+			if(!ctx_ee)
+			{
+				StartFailureMessage = TEXT("PubnubClient was deinitialized before the subscribe operation could run.");
+				return false;
+			}
+
+			//Dedup before allocating to avoid a wasted pubnub_subscription_alloc/free pair.
+			if(ChannelGroupSubscriptions.Contains(ChannelGroup))
+			{
+				PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel group '%s' already exists. Aborting operation."), *ChannelGroup));
+				StartFailureMessage = TEXT("Already subscribed to this channel group. Aborting operation.");
+				return false;
+			}
+
+			pubnub_subscription_t* Subscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(ctx_ee, ChannelGroup, EPubnubEntityType::PEnT_ChannelGroup, SubscribeSettings, CCoreEntityCache);
+			if(!Subscription)
+			{
+				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to subscribe to channel group '%s'. pubnub_subscription_alloc didn't create subscription."), *ChannelGroup));
+				StartFailureMessage = TEXT("Failed to subscribe to group. pubnub_subscription_alloc didn't create subscription.");
+				return false;
+			}
+
+			ApplySubscribeFilterExpression_priv(SubscribeSettings.FilterExpression);
+			if(!UPubnubInternalUtilities::EEAddListenerAndSubscribe(Subscription, Callback, ClientListenerUserData))
+			{
+				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to add listener and subscribe for channel group '%s'."), *ChannelGroup));
+				pubnub_subscription_free(&Subscription);
+				return false;
+			}
+
+			//Save callback and subscription so it can be unsubscribed later.
+			CCoreSubscriptionCallback* SubscriptionData = new CCoreSubscriptionCallback{Callback, Subscription, nullptr, SubscribeSettings.ReceivePresenceEvents};
+			ChannelGroupSubscriptions.Add(ChannelGroup, SubscriptionData);
+			PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("channel group subscription stored.\n\t-%s"), *PUBNUB_LOG_VALUE(ChannelGroup)));
+			return true;
+		});
+	PUBNUB_LOG_OPERATION_RESULT(SubscribeResult);
+	return SubscribeResult;
+}
+
+FPubnubOperationResult UPubnubClient::UnsubscribeFromChannel_priv(FString Channel)
+{
+	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
+		PUBNUB_LOG_VALUE(Channel)
+	);
+	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
+
+	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+
+	const bool bIsSubscribed = ChannelSubscriptions.Contains(Channel);
+	PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bIsSubscribed, TEXT("There is no such subscription. Aborting operation."));
+
+	//Subscription may be a part of a set made by UpdateSubscriptions, removal handles both cases
+	if(!RemoveClientSubscriptions({Channel}, {}))
+	{
+		FPubnubOperationResult Result({0, true, "Failed to unsubscribe."});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+	PUBNUB_LOG_FUNCTION_DEBUG(
+		TEXT("channel subscription removed."),
+		PUBNUB_LOG_VALUE(Channel)
+	);
+
+	FPubnubOperationResult Result({200, false, ""});
+	PUBNUB_LOG_OPERATION_RESULT(Result);
+	return Result;
+}
+
+FPubnubOperationResult UPubnubClient::UnsubscribeFromGroup_priv(FString ChannelGroup)
+{
+	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
+		PUBNUB_LOG_VALUE(ChannelGroup)
+	);
+	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
+
+	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+
+	const bool bIsSubscribed = ChannelGroupSubscriptions.Contains(ChannelGroup);
+	PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bIsSubscribed, TEXT("There is no such subscription. Aborting operation."));
+
+	//Subscription may be a part of a set made by UpdateSubscriptions, removal handles both cases
+	if(!RemoveClientSubscriptions({}, {ChannelGroup}))
+	{
+		FPubnubOperationResult Result({0, true, "Failed to unsubscribe."});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+	PUBNUB_LOG_FUNCTION_DEBUG(
+		TEXT("channel group subscription removed."),
+		PUBNUB_LOG_VALUE(ChannelGroup)
+	);
+
+	FPubnubOperationResult Result({200, false, ""});
+	PUBNUB_LOG_OPERATION_RESULT(Result);
+	return Result;
+}
+
+FPubnubOperationResult UPubnubClient::UnsubscribeFromAll_priv()
+{
+	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
+	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+
+	//If there are no subscriptions, return success immediately.
+	if(ChannelSubscriptions.IsEmpty() && ChannelGroupSubscriptions.IsEmpty())
+	{
+		PUBNUB_LOG_FUNCTION_WARNING(TEXT("unsubscribe all requested but there are no active subscriptions."));
+		FPubnubOperationResult Result({200, false, ""});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+
+	const enum pubnub_res UnsubscribeAllResult = pubnub_unsubscribe_all(ctx_ee);
+	if(UnsubscribeAllResult != PNR_OK)
+	{
+		FPubnubOperationResult Result({0, true, FString::Printf(TEXT("Failed to unsubscribe all. Error: %s"), UTF8_TO_TCHAR(pubnub_res_2_string(UnsubscribeAllResult)))});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+
+	CleanUpAllSubscriptions();
+	FPubnubOperationResult Result({200, false, ""});
+	PUBNUB_LOG_OPERATION_RESULT(Result);
+	return Result;
+}
+
+
+FPubnubOperationResult UPubnubClient::UpdateSubscriptions_priv(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FPubnubSubscribeSettings SubscribeSettings)
+{
+	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("UpdateSubscriptions inputs: ChannelsToAddCount=%d, ChannelGroupsToAddCount=%d, ChannelsToRemoveCount=%d, ChannelGroupsToRemoveCount=%d, %s"),
+		ChannelsToAdd.Num(), ChannelGroupsToAdd.Num(), ChannelsToRemove.Num(), ChannelGroupsToRemove.Num(), *PUBNUB_LOG_VALUE(SubscribeSettings)));
+
+	FSubscriptionChanges Changes;
+	for(const FString& Channel : ChannelsToAdd)
+	{
+		if(!Channel.IsEmpty()) { Changes.ChannelsToAdd.Add(Channel, SubscribeSettings); }
+	}
+	for(const FString& ChannelGroup : ChannelGroupsToAdd)
+	{
+		if(!ChannelGroup.IsEmpty()) { Changes.ChannelGroupsToAdd.Add(ChannelGroup, SubscribeSettings); }
+	}
+	for(const FString& Channel : ChannelsToRemove)
+	{
+		if(!Channel.IsEmpty()) { Changes.ChannelsToRemove.Add(Channel); }
+	}
+	for(const FString& ChannelGroup : ChannelGroupsToRemove)
+	{
+		if(!ChannelGroup.IsEmpty()) { Changes.ChannelGroupsToRemove.Add(ChannelGroup); }
+	}
+
+	return ApplySubscriptionChanges_priv(Changes);
+}
+
+FPubnubOperationResult UPubnubClient::ApplySubscriptionChanges_priv(const FSubscriptionChanges& Changes)
+{
+	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+
+	if(!ctx_ee)
+	{
+		FPubnubOperationResult Result({0, true, TEXT("PubnubClient was deinitialized before the subscribe operation could run.")});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+
+	//Removals go first, so channels that are both removed and added are subscribed again with the new settings
+	TSet<FString> ChannelsToRemove;
+	TSet<FString> ChannelGroupsToRemove;
+	for(const FString& Channel : Changes.ChannelsToRemove)
+	{
+		if(ChannelSubscriptions.Contains(Channel)) { ChannelsToRemove.Add(Channel); }
+		else { PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("there is no subscription for channel '%s'. Skipping it."), *Channel)); }
+	}
+	for(const FString& ChannelGroup : Changes.ChannelGroupsToRemove)
+	{
+		if(ChannelGroupSubscriptions.Contains(ChannelGroup)) { ChannelGroupsToRemove.Add(ChannelGroup); }
+		else { PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("there is no subscription for channel group '%s'. Skipping it."), *ChannelGroup)); }
+	}
+
+	if((!ChannelsToRemove.IsEmpty() || !ChannelGroupsToRemove.IsEmpty()) && !RemoveClientSubscriptions(ChannelsToRemove, ChannelGroupsToRemove))
+	{
+		FPubnubOperationResult Result({0, true, "Failed to unsubscribe."});
+		PUBNUB_LOG_OPERATION_RESULT(Result);
+		return Result;
+	}
+
+	//One subscription set per subscribe settings. All subscriptions of a set share its options
+	struct FSettingsGroup
+	{
+		FPubnubSubscribeSettings SubscribeSettings;
+		TArray<FString> Channels;
+		TArray<FString> ChannelGroups;
+	};
+	TArray<FSettingsGroup> SettingsGroups;
+	auto FindSettingsGroup = [&SettingsGroups](const FPubnubSubscribeSettings& SubscribeSettings) -> FSettingsGroup&
+	{
+		for(FSettingsGroup& SettingsGroup : SettingsGroups)
+		{
+			if(SettingsGroup.SubscribeSettings.ReceivePresenceEvents == SubscribeSettings.ReceivePresenceEvents)
+			{
+				//Filter expression is shared by the whole subscribe loop, so it doesn't need its own set. The last one wins
+				if(!SubscribeSettings.FilterExpression.IsEmpty())
+				{
+					SettingsGroup.SubscribeSettings.FilterExpression = SubscribeSettings.FilterExpression;
+				}
+				return SettingsGroup;
+			}
+		}
+		FSettingsGroup& NewGroup = SettingsGroups.AddDefaulted_GetRef();
+		NewGroup.SubscribeSettings = SubscribeSettings;
+		return NewGroup;
+	};
+
+	for(const TPair<FString, FPubnubSubscribeSettings>& Pair : Changes.ChannelsToAdd)
+	{
+		if(ChannelSubscriptions.Contains(Pair.Key)) { PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel '%s' already exists. Skipping it."), *Pair.Key)); }
+		else { FindSettingsGroup(Pair.Value).Channels.Add(Pair.Key); }
+	}
+	for(const TPair<FString, FPubnubSubscribeSettings>& Pair : Changes.ChannelGroupsToAdd)
+	{
+		if(ChannelGroupSubscriptions.Contains(Pair.Key)) { PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel group '%s' already exists. Skipping it."), *Pair.Key)); }
+		else { FindSettingsGroup(Pair.Value).ChannelGroups.Add(Pair.Key); }
+	}
+
+	for(const FSettingsGroup& SettingsGroup : SettingsGroups)
+	{
+		FString StartFailureMessage = TEXT("Failed to subscribe to channels.");
+		FPubnubOperationResult SubscribeResult = ExecuteSerializedSubscriptionOperation(
+			StartFailureMessage,
+			TEXT("Subscribe operation timed out"),
+			[&]()
+			{
+				return AddClientSubscriptions(SettingsGroup.Channels, SettingsGroup.ChannelGroups, SettingsGroup.SubscribeSettings, StartFailureMessage);
+			});
+		if(SubscribeResult.Error)
+		{
+			PUBNUB_LOG_OPERATION_RESULT(SubscribeResult);
+			return SubscribeResult;
+		}
+	}
+
+	FPubnubOperationResult Result({200, false, ""});
+	PUBNUB_LOG_OPERATION_RESULT(Result);
+	return Result;
+}
+
+bool UPubnubClient::AddClientSubscriptions(const TArray<FString>& Channels, const TArray<FString>& ChannelGroups, const FPubnubSubscribeSettings& SubscribeSettings, FString& OutErrorMessage)
+{
+	pubnub_subscribe_message_callback_t Callback = &CCoreSubscriptionCallback::OnClientMessage;
+	const int32 EntitiesNum = Channels.Num() + ChannelGroups.Num();
+
+	TArray<pubnub_subscription_t*> Subscriptions;
+	Subscriptions.Reserve(EntitiesNum);
+	auto FreeSubscriptions = [&Subscriptions]()
+	{
+		for(pubnub_subscription_t*& Subscription : Subscriptions)
+		{
+			pubnub_subscription_free(&Subscription);
+		}
+	};
+
+	for(int32 i = 0; i < EntitiesNum; ++i)
+	{
+		const bool bIsChannel = i < Channels.Num();
+		const FString& EntityID = bIsChannel ? Channels[i] : ChannelGroups[i - Channels.Num()];
+		pubnub_subscription_t* Subscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(ctx_ee, EntityID, bIsChannel ? EPubnubEntityType::PEnT_Channel : EPubnubEntityType::PEnT_ChannelGroup, SubscribeSettings, CCoreEntityCache);
+		if(!Subscription)
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("pubnub_subscription_alloc didn't create subscription for '%s'."), *EntityID));
+			OutErrorMessage = TEXT("Failed to subscribe to channels. pubnub_subscription_alloc didn't create subscription.");
+			FreeSubscriptions();
+			return false;
+		}
+		Subscriptions.Add(Subscription);
+	}
+
+	ApplySubscribeFilterExpression_priv(SubscribeSettings.FilterExpression);
+
+	//A single entity doesn't need a set
+	pubnub_subscription_set_t* SubscriptionSet = nullptr;
+	if(EntitiesNum == 1)
+	{
+		if(!UPubnubInternalUtilities::EEAddListenerAndSubscribe(Subscriptions[0], Callback, ClientListenerUserData))
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(TEXT("failed to add listener and subscribe."));
+			FreeSubscriptions();
+			return false;
+		}
+	}
+	else
+	{
+		SubscriptionSet = UPubnubInternalUtilities::EEGetSubscriptionSetForSubscriptions(Subscriptions, SubscribeSettings);
+		if(!SubscriptionSet)
+		{
+			OutErrorMessage = TEXT("Failed to subscribe to channels. Subscription set wasn't created.");
+			FreeSubscriptions();
+			return false;
+		}
+
+		//Listeners stay on the subscriptions, so any of them can be unsubscribed later without touching the others
+		for(pubnub_subscription_t* Subscription : Subscriptions)
+		{
+			UPubnubInternalUtilities::EEAddSubscriptionListenersOfAllTypes(Subscription, Callback, ClientListenerUserData);
+		}
+
+		if(!UPubnubInternalUtilities::EESubscribeWithSubscriptionSet(SubscriptionSet, FPubnubSubscriptionCursor()))
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(TEXT("failed to subscribe with subscription set."));
+			for(pubnub_subscription_t* Subscription : Subscriptions)
+			{
+				UPubnubInternalUtilities::EERemoveSubscriptionListenersOfAllTypes(&Subscription, Callback, ClientListenerUserData);
+			}
+			pubnub_subscription_set_free(&SubscriptionSet);
+			FreeSubscriptions();
+			return false;
+		}
+		ClientSubscriptionSets.Add(SubscriptionSet, EntitiesNum);
+	}
+
+	//Save callbacks and subscriptions so they can be unsubscribed later.
+	for(int32 i = 0; i < EntitiesNum; ++i)
+	{
+		CCoreSubscriptionCallback* SubscriptionData = new CCoreSubscriptionCallback{Callback, Subscriptions[i], SubscriptionSet, SubscribeSettings.ReceivePresenceEvents};
+		if(i < Channels.Num())
+		{
+			ChannelSubscriptions.Add(Channels[i], SubscriptionData);
+		}
+		else
+		{
+			ChannelGroupSubscriptions.Add(ChannelGroups[i - Channels.Num()], SubscriptionData);
+		}
+	}
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("subscriptions stored. Channels=%d, ChannelGroups=%d"), Channels.Num(), ChannelGroups.Num()));
+	return true;
+}
+
+void UPubnubClient::ApplySubscribeFilterExpression_priv(const FString& FilterExpression, bool bAllowEmpty)
+{
+	if(!ctx_ee || (FilterExpression.IsEmpty() && !bAllowEmpty))
+	{return;}
+
+	{
+		FScopeLock FilterExpressionLock(&SubscribeFilterExpressionMutex);
+		if(SubscribeFilterExpression.Equals(FilterExpression, ESearchCase::CaseSensitive))
+		{return;}
+		SubscribeFilterExpression = FilterExpression;
+	}
+	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("subscribe filter expression changed.\n\t-%s"), *PUBNUB_LOG_VALUE(FilterExpression)));
+
+	//Buffer is replaced only after ctx_ee points to the new one
+	char* PreviousBuffer = FilterExpressionBuffer;
+	FilterExpressionBuffer = nullptr;
+	if(!FilterExpression.IsEmpty())
+	{
+		FTCHARToUTF8 Converter(*FilterExpression);
+		FilterExpressionBuffer = new char[Converter.Length() + 1];
+		FMemory::Memcpy(FilterExpressionBuffer, Converter.Get(), Converter.Length());
+		FilterExpressionBuffer[Converter.Length()] = '\0';
+	}
+	pubnub_subscribe_set_filter_expression(ctx_ee, FilterExpressionBuffer);
+	delete[] PreviousBuffer;
+}
+
+bool UPubnubClient::RemoveClientSubscriptions(const TSet<FString>& Channels, const TSet<FString>& ChannelGroups)
+{
+	struct FRemovedSubscription
+	{
+		FString EntityID;
+		TMap<FString, CCoreSubscriptionCallback*>* Storage;
+		CCoreSubscriptionCallback* SubscriptionData;
+	};
+
+	TArray<FRemovedSubscription> RemovedSubscriptions;
+	TMap<pubnub_subscription_set_t*, int32> RemovedFromSets;
+	auto CollectRemoved = [&](const TSet<FString>& EntityIDs, TMap<FString, CCoreSubscriptionCallback*>& Storage)
+	{
+		for(const FString& EntityID : EntityIDs)
+		{
+			CCoreSubscriptionCallback* SubscriptionData = Storage.FindRef(EntityID);
+			if(!SubscriptionData)
+			{continue;}
+
+			RemovedSubscriptions.Add({EntityID, &Storage, SubscriptionData});
+			if(SubscriptionData->SubscriptionSet)
+			{
+				RemovedFromSets.FindOrAdd(SubscriptionData->SubscriptionSet)++;
+			}
+		}
+	};
+	CollectRemoved(Channels, ChannelSubscriptions);
+	CollectRemoved(ChannelGroups, ChannelGroupSubscriptions);
+
+	auto ReleaseSubscription = [](FRemovedSubscription& Removed)
+	{
+		if(Removed.SubscriptionData->Subscription)
+		{
+			pubnub_subscription_free(&Removed.SubscriptionData->Subscription);
+		}
+		Removed.Storage->Remove(Removed.EntityID);
+		delete Removed.SubscriptionData;
+		Removed.SubscriptionData = nullptr;
+	};
+
+	bool bAllRemoved = true;
+
+	//Sets that lose all of their subscriptions are unsubscribed as a whole, with a single change of the subscribe loop
+	for(const TPair<pubnub_subscription_set_t*, int32>& Pair : RemovedFromSets)
+	{
+		if(Pair.Value != ClientSubscriptionSets.FindRef(Pair.Key))
+		{continue;}
+
+		for(FRemovedSubscription& Removed : RemovedSubscriptions)
+		{
+			if(Removed.SubscriptionData && Removed.SubscriptionData->SubscriptionSet == Pair.Key)
+			{
+				UPubnubInternalUtilities::EERemoveSubscriptionListenersOfAllTypes(&Removed.SubscriptionData->Subscription, Removed.SubscriptionData->Callback, ClientListenerUserData);
+			}
+		}
+
+		//Unsubscribe may null the pointer, the original one is still needed as the map key
+		pubnub_subscription_set_t* SubscriptionSet = Pair.Key;
+		if(!UPubnubInternalUtilities::EEUnsubscribeWithSubscriptionSet(&SubscriptionSet))
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(TEXT("failed to unsubscribe with subscription set."));
+			bAllRemoved = false;
+			for(FRemovedSubscription& Removed : RemovedSubscriptions)
+			{
+				if(Removed.SubscriptionData && Removed.SubscriptionData->SubscriptionSet == Pair.Key)
+				{
+					UPubnubInternalUtilities::EEAddSubscriptionListenersOfAllTypes(Removed.SubscriptionData->Subscription, Removed.SubscriptionData->Callback, ClientListenerUserData);
+					Removed.SubscriptionData = nullptr;
+				}
+			}
+			continue;
+		}
+
+		if(SubscriptionSet)
+		{
+			pubnub_subscription_set_free(&SubscriptionSet);
+		}
+		ClientSubscriptionSets.Remove(Pair.Key);
+		for(FRemovedSubscription& Removed : RemovedSubscriptions)
+		{
+			if(Removed.SubscriptionData && Removed.SubscriptionData->SubscriptionSet == Pair.Key)
+			{
+				ReleaseSubscription(Removed);
+			}
+		}
+	}
+
+	//The rest is unsubscribed one by one: subscriptions made on their own and the ones leaving a set that stays subscribed
+	for(FRemovedSubscription& Removed : RemovedSubscriptions)
+	{
+		CCoreSubscriptionCallback* SubscriptionData = Removed.SubscriptionData;
+		if(!SubscriptionData)
+		{continue;}
+
+		bool bUnsubscribed = false;
+		if(SubscriptionData->SubscriptionSet)
+		{
+			UPubnubInternalUtilities::EERemoveSubscriptionListenersOfAllTypes(&SubscriptionData->Subscription, SubscriptionData->Callback, ClientListenerUserData);
+			const enum pubnub_res RemoveResult = pubnub_subscription_set_remove(SubscriptionData->SubscriptionSet, &SubscriptionData->Subscription);
+			bUnsubscribed = RemoveResult == PNR_OK;
+			if(bUnsubscribed)
+			{
+				ClientSubscriptionSets.FindChecked(SubscriptionData->SubscriptionSet)--;
+			}
+			else if(SubscriptionData->Subscription)
+			{
+				UPubnubInternalUtilities::EEAddSubscriptionListenersOfAllTypes(SubscriptionData->Subscription, SubscriptionData->Callback, ClientListenerUserData);
+			}
+		}
+		else
+		{
+			bUnsubscribed = UPubnubInternalUtilities::EERemoveListenerAndUnsubscribe(&SubscriptionData->Subscription, SubscriptionData->Callback, ClientListenerUserData);
+		}
+
+		if(!bUnsubscribed)
+		{
+			PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to unsubscribe '%s'."), *Removed.EntityID));
+			bAllRemoved = false;
+			continue;
+		}
+		ReleaseSubscription(Removed);
+	}
+
+	return bAllRemoved;
+}
+
+void UPubnubClient::QueueSubscriptionChange(FQueuedSubscriptionChange&& Change)
+{
+	FScopeLock QueueLock(&QueuedSubscriptionChangesMutex);
+	QueuedSubscriptionChanges.Add(MoveTemp(Change));
+	if(bSubscriptionChangesFlushScheduled)
+	{return;}
+
+	bSubscriptionChangesFlushScheduled = true;
+	if(SubscriptionCoalescingWindowMs <= 0)
+	{
+		ScheduleSubscriptionChangesFlush();
+		return;
+	}
+
+	//One-shot ticker, it only moves the flush to the calls thread once the window passes
+	SubscriptionChangesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float DeltaTime)
+	{
+		FScopeLock QueueLock(&QueuedSubscriptionChangesMutex);
+		if(SubscriptionChangesTickerHandle.IsValid() && IsInitialized.load(std::memory_order_acquire))
+		{
+			SubscriptionChangesTickerHandle.Reset();
+			ScheduleSubscriptionChangesFlush();
+		}
+		return false;
+	}), SubscriptionCoalescingWindowMs / 1000.0f);
+}
+
+void UPubnubClient::ScheduleSubscriptionChangesFlush()
+{
+	TWeakObjectPtr<UPubnubClient> WeakThis = MakeWeakObjectPtr<UPubnubClient>(this);
+
+	PubnubCallsThread->AddFunctionToQueue( [WeakThis]
+	{
+		if(!WeakThis.IsValid())
+		{return;}
+
+		WeakThis.Get()->FlushQueuedSubscriptionChanges();
+	}, EPubnubOperationClass::StateChange);
+}
+
+void UPubnubClient::ExpediteQueuedSubscriptionChanges()
+{
+	FTSTicker::FDelegateHandle TickerHandle;
+	{
+		FScopeLock QueueLock(&QueuedSubscriptionChangesMutex);
+		if(!SubscriptionChangesTickerHandle.IsValid())
+		{return;}
+
+		TickerHandle = SubscriptionChangesTickerHandle;
+		SubscriptionChangesTickerHandle.Reset();
+		ScheduleSubscriptionChangesFlush();
+	}
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+}
+
+void UPubnubClient::FlushQueuedSubscriptionChanges()
+{
+	TArray<FQueuedSubscriptionChange> Changes;
+	{
+		FScopeLock QueueLock(&QueuedSubscriptionChangesMutex);
+		Changes = MoveTemp(QueuedSubscriptionChanges);
+		QueuedSubscriptionChanges.Reset();
+		bSubscriptionChangesFlushScheduled = false;
+	}
+	if(Changes.IsEmpty())
+	{return;}
+
+	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("applying queued subscription changes. Count=%d"), Changes.Num()));
+
+	FPubnubOperationResult Result;
+	TArray<FOnPubnubSubscribeOperationResponseNative> AcceptedCallbacks;
 	{
-		TWeakObjectPtr<UPubnubClient> ThisClientWeak = MakeWeakObjectPtr<UPubnubClient>(static_cast<UPubnubClient*>(user_data));
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, ThisClientWeak]()
+		//Held until the changes are applied, so nothing changes the subscriptions the changes were merged against
+		FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+
+		//Subscriptions as they will be after the changes merged so far
+		TSet<FString> ProjectedChannels;
+		TSet<FString> ProjectedChannelGroups;
+		ChannelSubscriptions.GetKeys(ProjectedChannels);
+		ChannelGroupSubscriptions.GetKeys(ProjectedChannelGroups);
+
+		const FString CurrentFilterExpression = GetSubscribeFilterExpression();
+
+		FSubscriptionChanges Merged;
+		auto MergeAdd = [&CurrentFilterExpression](const FString& EntityID, const FPubnubSubscribeSettings& SubscribeSettings, const TMap<FString, CCoreSubscriptionCallback*>& Current,
+			TSet<FString>& Projected, TMap<FString, FPubnubSubscribeSettings>& ToAdd, TSet<FString>& ToRemove)
 		{
-			if(ThisClientWeak.IsValid())
+			bool bAlreadyInSet = false;
+			Projected.Add(EntityID, &bAlreadyInSet);
+			if(bAlreadyInSet)
+			{return;}
+
+			//Unsubscribed and subscribed again within the window with the same settings, so nothing changes.
+			//With different settings both stay, and ApplySubscriptionChanges_priv subscribes it again with the new ones
+			if(ToRemove.Contains(EntityID))
 			{
-				ThisClientWeak.Get()->OnMessageReceived.Broadcast(MessageData);
-				ThisClientWeak.Get()->OnMessageReceivedNative.Broadcast(MessageData);
+				CCoreSubscriptionCallback* const* CurrentSubscription = Current.Find(EntityID);
+				const bool bSameSettings = CurrentSubscription && (*CurrentSubscription)->bReceivePresenceEvents == SubscribeSettings.ReceivePresenceEvents
+					&& (SubscribeSettings.FilterExpression.IsEmpty() || SubscribeSettings.FilterExpression.Equals(CurrentFilterExpression, ESearchCase::CaseSensitive));
+				if(bSameSettings)
+				{
+					ToRemove.Remove(EntityID);
+					return;
+				}
 			}
-		});
-	};
-
-	FString StartFailureMessage = TEXT("Failed to subscribe to channel.");
-	//Allocation and ctx_ee access happen inside the lambda so they run under
-	//SubscriptionOperationExecutionMutex (taken by ExecuteSerializedSubscriptionOperation),
-	//preventing a race with DeinitializeClient freeing ctx_ee.
-	FPubnubOperationResult SubscribeResult = ExecuteSerializedSubscriptionOperation(
-		StartFailureMessage,
-		TEXT("Subscribe operation timed out"),
-		[&]()
+			ToAdd.Add(EntityID, SubscribeSettings);
+		};
+		auto MergeRemove = [](const FString& EntityID, TSet<FString>& Projected, TMap<FString, FPubnubSubscribeSettings>& ToAdd, TSet<FString>& ToRemove)
 		{
-			//Guard against deinit having already freed ctx_ee while we were waiting for the lock.
-			if(!ctx_ee)
+			if(Projected.Remove(EntityID) == 0)
+			{return;}
+
+			if(ToAdd.Remove(EntityID) == 0)
 			{
-				StartFailureMessage = TEXT("PubnubClient was deinitialized before the subscribe operation could run.");
-				return false;
+				ToRemove.Add(EntityID);
 			}
+		};
 
-			//Dedup before allocating to avoid a wasted pubnub_subscription_alloc/free pair.
-			if(ChannelSubscriptions.Contains(Channel))
+		//Single channel calls keep the errors of their Sync versions, checked against the state left by earlier calls
+		auto ValidateSingleEntityChange = [&](const FQueuedSubscriptionChange& Change) -> FPubnubOperationResult
+		{
+			PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
+			if(!Change.ChannelsToAdd.IsEmpty())
 			{
-				PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel '%s' already exists. Aborting operation."), *Channel));
-				StartFailureMessage = TEXT("Already subscribed to this channel. Aborting operation.");
-				return false;
+				const FString& Channel = Change.ChannelsToAdd[0];
+				PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
+				const bool bNotSubscribed = !ProjectedChannels.Contains(Channel);
+				PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bNotSubscribed, TEXT("Already subscribed to this channel. Aborting operation."));
 			}
-
-			pubnub_subscription_t* Subscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(ctx_ee, Channel, EPubnubEntityType::PEnT_Channel, SubscribeSettings);
-			if(!Subscription)
+			else if(!Change.ChannelGroupsToAdd.IsEmpty())
 			{
-				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to subscribe to channel '%s'. pubnub_subscription_alloc didn't create subscription."), *Channel));
-				StartFailureMessage = TEXT("Failed to subscribe to channel. pubnub_subscription_alloc didn't create subscription.");
-				return false;
+				const FString& ChannelGroup = Change.ChannelGroupsToAdd[0];
+				PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
+				const bool bNotSubscribed = !ProjectedChannelGroups.Contains(ChannelGroup);
+				PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bNotSubscribed, TEXT("Already subscribed to this channel group. Aborting operation."));
 			}
-
-			if(!UPubnubInternalUtilities::EEAddListenerAndSubscribe(Subscription, Callback, this))
+			else if(!Change.ChannelsToRemove.IsEmpty())
 			{
-				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to add listener and subscribe for channel '%s'."), *Channel));
-				pubnub_subscription_free(&Subscription);
-				return false;
+				const FString& Channel = Change.ChannelsToRemove[0];
+				PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
+				const bool bIsSubscribed = ProjectedChannels.Contains(Channel);
+				PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bIsSubscribed, TEXT("There is no such subscription. Aborting operation."));
 			}
-
-			//Save callback and subscription so it can be unsubscribed later.
-			CCoreSubscriptionCallback* SubscriptionData = new CCoreSubscriptionCallback{Callback, Subscription};
-			ChannelSubscriptions.Add(Channel, SubscriptionData);
-			PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("channel subscription stored.\n\t-%s"), *PUBNUB_LOG_VALUE(Channel)));
-			return true;
-		});
-	PUBNUB_LOG_OPERATION_RESULT(SubscribeResult);
-	return SubscribeResult;
-}
-
-
-FPubnubOperationResult UPubnubClient::SubscribeToGroup_priv(FString ChannelGroup, FPubnubSubscribeSettings SubscribeSettings)
-{
-	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
-		PUBNUB_LOG_VALUE(ChannelGroup),
-		PUBNUB_LOG_VALUE(SubscribeSettings)
-	);
-	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
-	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
-
-	//Create callback that will be triggered by the c-core event engine
-	pubnub_subscribe_message_callback_t Callback = +[](const pubnub_t* pb, struct pubnub_v2_message message, void* user_data)
-	{
-		TWeakObjectPtr<UPubnubClient> ThisClientWeak = MakeWeakObjectPtr<UPubnubClient>(static_cast<UPubnubClient*>(user_data));
-		FPubnubMessageData MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(message); 
-		AsyncTask(ENamedThreads::GameThread, [MessageData, ThisClientWeak]()
-		{
-			if(ThisClientWeak.IsValid())
+			else if(!Change.ChannelGroupsToRemove.IsEmpty())
 			{
-				ThisClientWeak.Get()->OnMessageReceived.Broadcast(MessageData);
-				ThisClientWeak.Get()->OnMessageReceivedNative.Broadcast(MessageData);
+				const FString& ChannelGroup = Change.ChannelGroupsToRemove[0];
+				PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
+				const bool bIsSubscribed = ProjectedChannelGroups.Contains(ChannelGroup);
+				PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(bIsSubscribed, TEXT("There is no such subscription. Aborting operation."));
 			}
-		});
-	};
+			return FPubnubOperationResult({200, false, ""});
+		};
 
-	FString StartFailureMessage = TEXT("Failed to subscribe to channel group.");
-	//Allocation and ctx_ee access happen inside the lambda so they run under
-	//SubscriptionOperationExecutionMutex (taken by ExecuteSerializedSubscriptionOperation),
-	//preventing a race with DeinitializeClient freeing ctx_ee.
-	FPubnubOperationResult SubscribeResult = ExecuteSerializedSubscriptionOperation(
-		StartFailureMessage,
-		TEXT("Subscribe operation timed out"),
-		[&]()
+		for(const FQueuedSubscriptionChange& Change : Changes)
 		{
-			//Guard against deinit having already freed ctx_ee while we were waiting for the lock.
-			if(!ctx_ee)
+			if(Change.bSingleEntity)
 			{
-				StartFailureMessage = TEXT("PubnubClient was deinitialized before the subscribe operation could run.");
-				return false;
+				FPubnubOperationResult ValidationResult = ValidateSingleEntityChange(Change);
+				if(ValidationResult.Error)
+				{
+					UPubnubUtilities::CallPubnubDelegate(Change.Callback, ValidationResult);
+					continue;
+				}
 			}
 
-			//Dedup before allocating to avoid a wasted pubnub_subscription_alloc/free pair.
-			if(ChannelGroupSubscriptions.Contains(ChannelGroup))
+			for(const FString& Channel : Change.ChannelsToRemove)
 			{
-				PUBNUB_LOG_FUNCTION_WARNING(FString::Printf(TEXT("subscription for channel group '%s' already exists. Aborting operation."), *ChannelGroup));
-				StartFailureMessage = TEXT("Already subscribed to this channel group. Aborting operation.");
-				return false;
+				if(!Channel.IsEmpty()) { MergeRemove(Channel, ProjectedChannels, Merged.ChannelsToAdd, Merged.ChannelsToRemove); }
 			}
-
-			pubnub_subscription_t* Subscription = UPubnubInternalUtilities::EEGetSubscriptionForEntity(ctx_ee, ChannelGroup, EPubnubEntityType::PEnT_ChannelGroup, SubscribeSettings);
-			if(!Subscription)
+			for(const FString& ChannelGroup : Change.ChannelGroupsToRemove)
 			{
-				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("Failed to subscribe to channel group '%s'. pubnub_subscription_alloc didn't create subscription."), *ChannelGroup));
-				StartFailureMessage = TEXT("Failed to subscribe to group. pubnub_subscription_alloc didn't create subscription.");
-				return false;
+				if(!ChannelGroup.IsEmpty()) { MergeRemove(ChannelGroup, ProjectedChannelGroups, Merged.ChannelGroupsToAdd, Merged.ChannelGroupsToRemove); }
 			}
-
-			if(!UPubnubInternalUtilities::EEAddListenerAndSubscribe(Subscription, Callback, this))
+			for(const FString& Channel : Change.ChannelsToAdd)
 			{
-				PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to add listener and subscribe for channel group '%s'."), *ChannelGroup));
-				pubnub_subscription_free(&Subscription);
-				return false;
+				if(!Channel.IsEmpty()) { MergeAdd(Channel, Change.SubscribeSettings, ChannelSubscriptions, ProjectedChannels, Merged.ChannelsToAdd, Merged.ChannelsToRemove); }
 			}
+			for(const FString& ChannelGroup : Change.ChannelGroupsToAdd)
+			{
+				if(!ChannelGroup.IsEmpty()) { MergeAdd(ChannelGroup, Change.SubscribeSettings, ChannelGroupSubscriptions, ProjectedChannelGroups, Merged.ChannelGroupsToAdd, Merged.ChannelGroupsToRemove); }
+			}
+			AcceptedCallbacks.Add(Change.Callback);
+		}
 
-			//Save callback and subscription so it can be unsubscribed later.
-			CCoreSubscriptionCallback* SubscriptionData = new CCoreSubscriptionCallback{Callback, Subscription};
-			ChannelGroupSubscriptions.Add(ChannelGroup, SubscriptionData);
-			PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("channel group subscription stored.\n\t-%s"), *PUBNUB_LOG_VALUE(ChannelGroup)));
-			return true;
-		});
-	PUBNUB_LOG_OPERATION_RESULT(SubscribeResult);
-	return SubscribeResult;
-}
-
-FPubnubOperationResult UPubnubClient::UnsubscribeFromChannel_priv(FString Channel)
-{
-	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
-		PUBNUB_LOG_VALUE(Channel)
-	);
-	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
-	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
-
-	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
+		if(AcceptedCallbacks.IsEmpty())
+		{return;}
 
-	CCoreSubscriptionCallback* SubscriptionData = ChannelSubscriptions.FindRef(Channel);
-	PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(SubscriptionData, TEXT("There is no such subscription. Aborting operation."));
+		Result = Merged.IsEmpty() ? FPubnubOperationResult({200, false, ""}) : ApplySubscriptionChanges_priv(Merged);
+	}
 
-	if(!UPubnubInternalUtilities::EERemoveListenerAndUnsubscribe(&SubscriptionData->Subscription, SubscriptionData->Callback, this))
+	//All merged calls share the result of the single change they were applied with
+	for(const FOnPubnubSubscribeOperationResponseNative& Callback : AcceptedCallbacks)
 	{
-		PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to unsubscribe channel '%s'."), *Channel));
-		FPubnubOperationResult Result({0, true, "Failed to unsubscribe."});
-		PUBNUB_LOG_OPERATION_RESULT(Result);
-		return Result;
+		UPubnubUtilities::CallPubnubDelegate(Callback, Result);
 	}
-
-	//Free subscription memory and remove local tracking.
-	pubnub_subscription_free(&SubscriptionData->Subscription);
-	ChannelSubscriptions.Remove(Channel);
-	delete SubscriptionData;
-	PUBNUB_LOG_FUNCTION_DEBUG(
-		TEXT("channel subscription removed."),
-		PUBNUB_LOG_VALUE(Channel)
-	);
-
-	FPubnubOperationResult Result({200, false, ""});
-	PUBNUB_LOG_OPERATION_RESULT(Result);
-	return Result;
 }
 
-FPubnubOperationResult UPubnubClient::UnsubscribeFromGroup_priv(FString ChannelGroup)
+void UPubnubClient::CancelQueuedSubscriptionChanges(const FString& CancelReason)
 {
-	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
-		PUBNUB_LOG_VALUE(ChannelGroup)
-	);
-	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
-	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
-
-	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
-
-	CCoreSubscriptionCallback* SubscriptionData = ChannelGroupSubscriptions.FindRef(ChannelGroup);
-	PUBNUB_RETURN_OPERATION_RESULT_IF_CONDITION_FAILS(SubscriptionData, TEXT("There is no such subscription. Aborting operation."));
-
-	if(!UPubnubInternalUtilities::EERemoveListenerAndUnsubscribe(&SubscriptionData->Subscription, SubscriptionData->Callback, this))
+	TArray<FQueuedSubscriptionChange> Changes;
+	FTSTicker::FDelegateHandle TickerHandle;
 	{
-		PUBNUB_LOG_FUNCTION_ERROR(FString::Printf(TEXT("failed to unsubscribe channel group '%s'."), *ChannelGroup));
-		FPubnubOperationResult Result({0, true, "Failed to unsubscribe."});
-		PUBNUB_LOG_OPERATION_RESULT(Result);
-		return Result;
+		FScopeLock QueueLock(&QueuedSubscriptionChangesMutex);
+		Changes = MoveTemp(QueuedSubscriptionChanges);
+		QueuedSubscriptionChanges.Reset();
+		TickerHandle = SubscriptionChangesTickerHandle;
+		SubscriptionChangesTickerHandle.Reset();
+		bSubscriptionChangesFlushScheduled = false;
 	}
 
-	//Free subscription memory and remove local tracking.
-	pubnub_subscription_free(&SubscriptionData->Subscription);
-	ChannelGroupSubscriptions.Remove(ChannelGroup);
-	delete SubscriptionData;
-	PUBNUB_LOG_FUNCTION_DEBUG(
-		TEXT("channel group subscription removed."),
-		PUBNUB_LOG_VALUE(ChannelGroup)
-	);
-
-	FPubnubOperationResult Result({200, false, ""});
-	PUBNUB_LOG_OPERATION_RESULT(Result);
-	return Result;
-}
-
-FPubnubOperationResult UPubnubClient::UnsubscribeFromAll_priv()
-{
-	PUBNUB_LOG_FUNCTION_CALLED_TRACE();
-	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
-	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
-
-	//If there are no subscriptions, return success immediately.
-	if(ChannelSubscriptions.IsEmpty() && ChannelGroupSubscriptions.IsEmpty())
+	if(TickerHandle.IsValid())
 	{
-		PUBNUB_LOG_FUNCTION_WARNING(TEXT("unsubscribe all requested but there are no active subscriptions."));
-		FPubnubOperationResult Result({200, false, ""});
-		PUBNUB_LOG_OPERATION_RESULT(Result);
-		return Result;
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
 	}
 
-	const enum pubnub_res UnsubscribeAllResult = pubnub_unsubscribe_all(ctx_ee);
-	if(UnsubscribeAllResult != PNR_OK)
+	for(const FQueuedSubscriptionChange& Change : Changes)
 	{
-		FPubnubOperationResult Result({0, true, FString::Printf(TEXT("Failed to unsubscribe all. Error: %s"), UTF8_TO_TCHAR(pubnub_res_2_string(UnsubscribeAllResult)))});
-		PUBNUB_LOG_OPERATION_RESULT(Result);
-		return Result;
+		UPubnubUtilities::CallPubnubDelegate(Change.Callback, FPubnubOperationResult({499, true, CancelReason}));
 	}
-
-	CleanUpAllSubscriptions();
-	FPubnubOperationResult Result({200, false, ""});
-	PUBNUB_LOG_OPERATION_RESULT(Result);
-	return Result;
 }
 
-
 FPubnubOperationResult UPubnubClient::AddChannelToGroup_priv(FString Channel, FString ChannelGroup)
 {
 	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
@@ -3222,8 +4703,8 @@ FPubnubOperationResult UPubnubClient::AddChannelToGroup_priv(FString Channel, FS
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -3250,8 +4731,8 @@ FPubnubOperationResult UPubnubClient::RemoveChannelFromGroup_priv(FString Channe
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -3278,8 +4759,8 @@ FPubnubListChannelsFromGroupResult UPubnubClient::ListChannelsFromGroup_priv(FSt
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(ChannelGroup, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 	
@@ -3308,8 +4789,8 @@ FPubnubOperationResult UPubnubClient::RemoveChannelGroup_priv(FString ChannelGro
 	);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ChannelGroup);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 
@@ -3339,8 +4820,8 @@ FPubnubListUsersFromChannelResult UPubnubClient::ListUsersFromChannel_priv(FStri
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS((ListUsersFromChannelSettings.Limit >= 0), TEXT("Limit can't be below 0."), FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS((ListUsersFromChannelSettings.Offset >= 0), TEXT("Offset can't be below 0."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	//Set all options from ListUsersFromChannelSettings
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -3392,8 +4873,8 @@ FPubnubListUsersSubscribedChannelsResult UPubnubClient::ListUserSubscribedChanne
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(UserID, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder UserIDHolder(UserID);
 	pubnub_where_now(ctx_pub, UserIDHolder.Get());
@@ -3424,8 +4905,8 @@ FPubnubOperationResult UPubnubClient::SetState_priv(FString Channel, FString Sta
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(StateJson);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	if(!UPubnubJsonUtilities::IsCorrectJsonString(StateJson, false))
 	{
@@ -3475,8 +4956,8 @@ FPubnubGetStateResult UPubnubClient::GetState_priv(FString Channel, FString Chan
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -3505,8 +4986,8 @@ FPubnubOperationResult UPubnubClient::Heartbeat_priv(FString Channel, FString Ch
 		PUBNUB_LOG_VALUE(ChannelGroup)
 	);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 	
 	FUTF8StringHolder ChannelGroupHolder(ChannelGroup);
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -3532,8 +5013,8 @@ FPubnubGrantTokenResult UPubnubClient::GrantToken_priv(FString PermissionObject)
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(PermissionObject, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder PermissionObjectHolder(PermissionObject);
 	
@@ -3565,8 +5046,8 @@ FPubnubOperationResult UPubnubClient::RevokeToken_priv(FString Token)
 	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("revoke token called. TokenLength=%d"), Token.Len()));
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Token);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder TokenHolder(Token);
 	
@@ -3597,7 +5078,7 @@ FString UPubnubClient::ParseToken_priv(FString Token)
 
 	FUTF8StringHolder TokenHolder(Token);
 	
-	char* TokenResponse = pubnub_parse_token(ctx_pub, TokenHolder.Get());
+	char* TokenResponse = pubnub_parse_token(ContextPool->GetPrimaryContext(), TokenHolder.Get());
 	if (TokenResponse == nullptr)
 	{
 		PUBNUB_LOG_FUNCTION_ERROR(TEXT("pubnub_parse_token returned NULL (invalid token or decode failure)."));
@@ -3616,15 +5097,52 @@ FString UPubnubClient::ParseToken_priv(FString Token)
 	return ReworkedToken;
 }
 
+bool UPubnubClient::HasPermission_priv(const FString& Token, EPubnubTokenResourceType ResourceType, const FString& ResourceID, EPubnubTokenPermission Permission)
+{
+	PUBNUB_RETURN_IF_FIELD_EMPTY(Token, false);
+	PUBNUB_RETURN_IF_FIELD_EMPTY(ResourceID, false);
+
+	TSharedPtr<FPubnubTokenCache, ESPMode::ThreadSafe> Cache = TokenCache;
+	if(!Cache)
+	{
+		return false;
+	}
+
+	TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken = Cache->Find(Token);
+	if(!ParsedToken)
+	{
+		FUTF8StringHolder TokenHolder(Token);
+		char* TokenResponse = pubnub_parse_token(ContextPool->GetPrimaryContext(), TokenHolder.Get());
+		if(TokenResponse == nullptr)
+		{
+			PUBNUB_LOG_FUNCTION_WARNING(TEXT("pubnub_parse_token returned NULL (invalid token or decode failure)."));
+			return false;
+		}
+
+		FUTF8ToTCHAR Converter(TokenResponse);
+		ParsedToken = FPubnubParsedToken::FromParsedTokenJson(FString(Converter.Length(), Converter.Get()));
+		free(TokenResponse);
+		if(!ParsedToken)
+		{
+			PUBNUB_LOG_FUNCTION_WARNING(TEXT("failed to read parsed token."));
+			return false;
+		}
+		ParsedToken = Cache->Add(Token, ParsedToken.ToSharedRef());
+		PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("token added to cache. CachedTokens=%d"), Cache->Num()));
+	}
+
+	if(ParsedToken->IsExpired(FDateTime::UtcNow().ToUnixTimestamp()))
+	{
+		return false;
+	}
+	return ParsedToken->HasPermission(ResourceType, ResourceID, Permission);
+}
+
 void UPubnubClient::SetAuthToken_priv(FString Token)
 {
 	PUBNUB_LOG_FUNCTION_DEBUG_TEXT(FString::Printf(TEXT("set auth token called. TokenLength=%d"), Token.Len()));
 	PUBNUB_RETURN_IF_USER_ID_NOT_SET();
 
-	//Lock order matches DeinitializeClient: Subscription -> Operation.
-	FScopeLock SubscriptionExecutionLock(&SubscriptionOperationExecutionMutex);
-	FScopeLock OperationLock(&PubnubOperationMutex);
-
 	//Auth token has to be kept alive for the lifetime of the sdk; C-Core stores the pointer, not a copy.
 	FTCHARToUTF8 Converter(*Token);
 	const size_t NewLength = Converter.Length();
@@ -3633,27 +5151,51 @@ void UPubnubClient::SetAuthToken_priv(FString Token)
 	FMemory::Memcpy(NewBuffer, Converter.Get(), NewLength);
 	NewBuffer[NewLength] = '\0';
 
+	//Neither subscribe operations nor pooled requests are waited for. Lock order matches DeinitializeClient: Auth -> Pool.
+	FScopeLock AuthTokenLock(&AuthTokenMutex);
+
 	char* const OldBuffer = AuthTokenBuffer;
+	const uint64 OldGeneration = AuthTokenGeneration;
 
 	AuthTokenBuffer = NewBuffer;
 	AuthTokenLength = NewLength;
+	AuthTokenGeneration++;
 
-	if (ctx_pub)
+	//Idle contexts switch right away, contexts in the middle of a request when they finish it
+	if (ContextPool)
 	{
-		pubnub_set_auth_token(ctx_pub, AuthTokenBuffer);
+		ContextPool->PublishAuthToken(AuthTokenBuffer, AuthTokenGeneration);
 	}
+	//C-Core swaps the pointer under the context's own lock, so the running subscribe loop picks it up with its next request
 	if (ctx_ee)
 	{
 		pubnub_set_auth_token(ctx_ee, AuthTokenBuffer);
 	}
 
-	//In-flight ctx_ee subscribe I/O may still dereference OldBuffer briefly after the swap.
 	if (OldBuffer)
 	{
-		RetiredAuthTokenBuffers.Add(OldBuffer);
+		RetiredAuthTokenBuffers.Add({OldBuffer, OldGeneration});
 	}
+	ReclaimRetiredAuthTokenBuffers();
+
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("auth token published to pub and ee contexts. Generation=%llu, RetiredBuffers=%d"), AuthTokenGeneration, RetiredAuthTokenBuffers.Num()));
+}
+
+void UPubnubClient::ReclaimRetiredAuthTokenBuffers()
+{
+	const uint64 OldestPooledGeneration = ContextPool ? ContextPool->GetOldestAuthTokenGeneration() : AuthTokenGeneration;
 
-	PUBNUB_LOG_FUNCTION_TRACE(TEXT("auth token applied to pub and ee contexts."));
+	//ctx_ee is switched right away, but its event engine may be formatting a request with the previous token on another thread.
+	//The newest retired token is kept until the next swap, which is far longer than that takes
+	RetiredAuthTokenBuffers.RemoveAll([this, OldestPooledGeneration](const FRetiredAuthToken& Retired)
+	{
+		const bool bSafeToFree = Retired.Generation < OldestPooledGeneration && Retired.Generation + 1 < AuthTokenGeneration;
+		if (bSafeToFree)
+		{
+			delete[] Retired.Buffer;
+		}
+		return bSafeToFree;
+	});
 }
 
 int UPubnubClient::SetOrigin_priv(FString Origin)
@@ -3669,7 +5211,7 @@ int UPubnubClient::SetOrigin_priv(FString Origin)
 		OriginBuffer = nullptr;
 		OriginLength = 0;
 		
-		Result = pubnub_origin_set(ctx_pub, nullptr);
+		ContextPool->ForEachContext([&Result](pubnub_t* Context){ Result |= pubnub_origin_set(Context, nullptr); });
 		return Result;
 	}
 
@@ -3682,7 +5224,7 @@ int UPubnubClient::SetOrigin_priv(FString Origin)
 	OriginBuffer[OriginLength] = '\0';
 	
 	//This is just a setter, so no need to call it on a separate thread
-	Result = pubnub_origin_set(ctx_pub, OriginBuffer);
+	ContextPool->ForEachContext([this, &Result](pubnub_t* Context){ Result |= pubnub_origin_set(Context, OriginBuffer); });
 	return Result;
 }
 
@@ -3696,7 +5238,7 @@ void UPubnubClient::SetRuntimeSdkVersionSuffix_priv(FString Suffix)
 
 	if (Suffix.IsEmpty())
 	{
-		pubnub_set_sdk_version_suffix(ctx_pub, nullptr);
+		ContextPool->ForEachContext([](pubnub_t* Context){ pubnub_set_sdk_version_suffix(Context, nullptr); });
 		pubnub_set_sdk_version_suffix(ctx_ee, nullptr);
 		PUBNUB_LOG_FUNCTION_TRACE(TEXT("runtime sdk version suffix reset to compile-time SDK identification."));
 		return;
@@ -3708,12 +5250,12 @@ void UPubnubClient::SetRuntimeSdkVersionSuffix_priv(FString Suffix)
 	FMemory::Memcpy(RuntimeSdkVersionSuffixBuffer, Converter.Get(), RuntimeSdkVersionSuffixLength);
 	RuntimeSdkVersionSuffixBuffer[RuntimeSdkVersionSuffixLength] = '\0';
 
-	pubnub_set_sdk_version_suffix(ctx_pub, RuntimeSdkVersionSuffixBuffer);
+	ContextPool->ForEachContext([this](pubnub_t* Context){ pubnub_set_sdk_version_suffix(Context, RuntimeSdkVersionSuffixBuffer); });
 	pubnub_set_sdk_version_suffix(ctx_ee, RuntimeSdkVersionSuffixBuffer);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("runtime sdk version suffix applied to pub and ee contexts."));
 }
 
-FPubnubFetchHistoryResult UPubnubClient::FetchHistory_priv(FString Channel, FPubnubFetchHistorySettings FetchHistorySettings)
+FPubnubFetchHistoryResult UPubnubClient::FetchHistory_priv(FString Channel, FPubnubFetchHistorySettings FetchHistorySettings, int32 RetriesDone, float* OutRetryDelaySeconds)
 {
 	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
 		PUBNUB_LOG_VALUE(Channel),
@@ -3723,8 +5265,8 @@ FPubnubFetchHistoryResult UPubnubClient::FetchHistory_priv(FString Channel, FPub
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	//Set all options from HistorySettings
 
@@ -3739,18 +5281,22 @@ FPubnubFetchHistoryResult UPubnubClient::FetchHistory_priv(FString Channel, FPub
 
 	FUTF8StringHolder ChannelHolder(Channel);
 	
-	pubnub_fetch_history(ctx_pub, ChannelHolder.Get(), FetchHistoryOptions);
-	PUBNUB_LOG_FUNCTION_TRACE(TEXT("fetch history request sent."));
-
-	FString HistoryResponse = "";
+	//History is parsed straight from the C-Core buffer, only fields that end up in the messages are converted
+	FAnsiStringView HistoryResponse;
 	
-	pubnub_res PubnubResponse = pubnub_await(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(TEXT("sending fetch history request."));
+	const pubnub_res PubnubResponse = static_cast<pubnub_res>(AwaitAttempt_priv(ctx_pub, EPubnubRetryEndpoint::PRE_MessageStorage, [&]()
+	{
+		return pubnub_fetch_history(ctx_pub, ChannelHolder.Get(), FetchHistoryOptions);
+	}, RetriesDone, OutRetryDelaySeconds));
 	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fetch history await finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(PubnubResponse))));
 	if (PNR_OK == PubnubResponse) {
 
-		//Convert it keeping UTF8 characters valid
 		pubnub_chamebl_t HistoryMemBlock = pubnub_get_fetch_history(ctx_pub);
-		HistoryResponse = UPubnubUtilities::PubnubCharMemBlockToString(HistoryMemBlock);
+		if (HistoryMemBlock.ptr && HistoryMemBlock.size > 0)
+		{
+			HistoryResponse = FAnsiStringView(HistoryMemBlock.ptr, static_cast<int32>(HistoryMemBlock.size));
+		}
 	}
 	else
 	{
@@ -3760,18 +5306,19 @@ FPubnubFetchHistoryResult UPubnubClient::FetchHistory_priv(FString Channel, FPub
 	//If response is empty, there was server error. 
 	if(HistoryResponse.IsEmpty())
 	{
-		HistoryResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *HistoryResponse));
+		HistoryResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(HistoryResponse)));
 	}
 	else
 	{
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *HistoryResponse));
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(HistoryResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubOperationResult Result;
 	TArray<FPubnubHistoryMessageData> Messages;
-	UPubnubJsonUtilities::FetchHistoryJsonToData(HistoryResponse, Result, Messages);
+	UPubnubJsonUtilities::FetchHistoryJsonToData(HistoryResponse.GetData(), HistoryResponse.Len(), Result, Messages);
+	Result.RetryCount = RetriesDone;
 	DecryptHistoryMessages(Messages);
 	PUBNUB_LOG_OPERATION_RESULT(Result);
 	if (!Result.Error)
@@ -3790,8 +5337,8 @@ FPubnubOperationResult UPubnubClient::DeleteMessages_priv(FString Channel, FPubn
 	);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	pubnub_delete_messages_options DeleteMessagesOptions = pubnub_delete_messages_defopts();
 	FUTF8StringHolder StartHolder(DeleteMessagesSettings.Start);
@@ -3819,7 +5366,7 @@ FPubnubOperationResult UPubnubClient::DeleteMessages_priv(FString Channel, FPubn
 	return Result;
 }
 
-FPubnubMessageCountsResult UPubnubClient::MessageCounts_priv(FString Channel, FString Timetoken)
+FPubnubMessageCountsResult UPubnubClient::MessageCounts_priv(FString Channel, FString Timetoken, int32 RetriesDone, float* OutRetryDelaySeconds)
 {
 	PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(
 		PUBNUB_LOG_VALUE(Channel),
@@ -3829,16 +5376,17 @@ FPubnubMessageCountsResult UPubnubClient::MessageCounts_priv(FString Channel, FS
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder TimetokenHolder(Timetoken);
 	FUTF8StringHolder ChannelHolder(Channel);
 	
-	pubnub_message_counts(ctx_pub, ChannelHolder.Get(), TimetokenHolder.Get());
-	PUBNUB_LOG_FUNCTION_TRACE(TEXT("message counts request sent."));
-
-	const pubnub_res AwaitResult = pubnub_await(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(TEXT("sending message counts request."));
+	const pubnub_res AwaitResult = static_cast<pubnub_res>(AwaitAttempt_priv(ctx_pub, EPubnubRetryEndpoint::PRE_MessageStorage, [&]()
+	{
+		return pubnub_message_counts(ctx_pub, ChannelHolder.Get(), TimetokenHolder.Get());
+	}, RetriesDone, OutRetryDelaySeconds));
 	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("message counts await finished. ResultCode=%s"), UTF8_TO_TCHAR(pubnub_res_2_string(AwaitResult))));
 
 	int MessageCountsNumber = 0;
@@ -3848,6 +5396,7 @@ FPubnubMessageCountsResult UPubnubClient::MessageCounts_priv(FString Channel, FS
 	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
 
 	FPubnubOperationResult Result = UPubnubJsonUtilities::GetOperationResultFromJson(JsonResponse);
+	Result.RetryCount = RetriesDone;
 	PUBNUB_LOG_OPERATION_RESULT(Result);
 	if (!Result.Error)
 	{
@@ -3864,8 +5413,8 @@ FPubnubMessageCountsMultipleResult UPubnubClient::MessageCountsMultiple_priv(TAr
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS((!Channels.IsEmpty()), TEXT("Channels array cannot be empty."), FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS((Channels.Num() == Timetokens.Num()), TEXT("Number of channels must match number of timetokens."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder TimetokensHolder(UPubnubUtilities::ArrayOfStringsToCommaSeparatedString(Timetokens));
 	FUTF8StringHolder ChannelHolder(UPubnubUtilities::ArrayOfStringsToCommaSeparatedString(Channels));
@@ -3915,8 +5464,8 @@ FPubnubGetAllUserMetadataResult UPubnubClient::GetAllUserMetadata_priv(FString I
 	FPubnubGetAllUserMetadataResult FinalResult;
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_getall_metadata_opts PubnubOptions = pubnub_getall_metadata_defopts();
 	FUTF8StringHolder IncludeHolder(Include);
@@ -3936,18 +5485,18 @@ FPubnubGetAllUserMetadataResult UPubnubClient::GetAllUserMetadata_priv(FString I
 	pubnub_getall_uuidmetadata_ex(ctx_pub, PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get all user metadata request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubGetAllUserMetadataResult GetAllUserMetadataResult;
-	UPubnubJsonUtilities::GetAllUserMetadataJsonToData(JsonResponse, GetAllUserMetadataResult.Result, GetAllUserMetadataResult.UsersData, GetAllUserMetadataResult.Page, GetAllUserMetadataResult.TotalCount);
+	UPubnubJsonUtilities::GetAllUserMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetAllUserMetadataResult.Result, GetAllUserMetadataResult.UsersData, GetAllUserMetadataResult.Page, GetAllUserMetadataResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(GetAllUserMetadataResult.Result);
 	if (!GetAllUserMetadataResult.Result.Error)
 	{
@@ -3971,8 +5520,8 @@ FPubnubUserMetadataResult UPubnubClient::SetUserMetadata_priv(FString User, FStr
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(UserMetadataObj, FinalResult);
 	//Make sure that provided UserMetadataObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(UserMetadataObj, false), TEXT("UserMetadataObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder UserHolder(User);
 	FUTF8StringHolder UserMetadataObjHolder(UserMetadataObj);
@@ -3981,18 +5530,18 @@ FPubnubUserMetadataResult UPubnubClient::SetUserMetadata_priv(FString User, FStr
 	pubnub_set_uuidmetadata(ctx_pub, UserHolder.Get(), IncludeHolder.Get(), UserMetadataObjHolder.Get());
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("set user metadata request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubUserMetadataResult SetUserMetadataResult;
-	UPubnubJsonUtilities::GetUserMetadataJsonToData(JsonResponse, SetUserMetadataResult.Result, SetUserMetadataResult.UserData);
+	UPubnubJsonUtilities::GetUserMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), SetUserMetadataResult.Result, SetUserMetadataResult.UserData);
 	PUBNUB_LOG_OPERATION_RESULT(SetUserMetadataResult.Result);
 	if (!SetUserMetadataResult.Result.Error)
 	{
@@ -4015,19 +5564,19 @@ FPubnubUserMetadataResult UPubnubClient::GetUserMetadata_priv(FString User, FStr
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(User, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder UserHolder(User);
 	FUTF8StringHolder IncludeHolder(Include);
 	pubnub_get_uuidmetadata(ctx_pub, IncludeHolder.Get(), UserHolder.Get());
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get user metadata request sent."));
 
-	const FString JsonResponse = GetResponseForGetObject(ctx_pub);
+	const FAnsiStringView JsonResponse = GetResponseViewForGetObject(ctx_pub);
 	
 	//Parse Json response into data
 	FPubnubUserMetadataResult GetUserMetadataResult;
-	UPubnubJsonUtilities::GetUserMetadataJsonToData(JsonResponse, GetUserMetadataResult.Result, GetUserMetadataResult.UserData);
+	UPubnubJsonUtilities::GetUserMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetUserMetadataResult.Result, GetUserMetadataResult.UserData);
 	if (!GetUserMetadataResult.Result.Error)
 	{
 		PUBNUB_LOG_FUNCTION_DEBUG(
@@ -4037,7 +5586,7 @@ FPubnubUserMetadataResult UPubnubClient::GetUserMetadata_priv(FString User, FStr
 	}
 	else if (GetUserMetadataResult.Result.Status == 0)
 	{
-		// Malformed JSON or non-App-Context body: not covered by GetResponseForGetObject HTTP logging
+		// Malformed JSON or non-App-Context body: not covered by GetResponseViewForGetObject HTTP logging
 		PUBNUB_LOG_OPERATION_RESULT(GetUserMetadataResult.Result);
 	}
 							
@@ -4051,8 +5600,8 @@ FPubnubOperationResult UPubnubClient::RemoveUserMetadata_priv(FString User)
 	);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(User);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder UserHolder(User);
 	
@@ -4086,8 +5635,8 @@ FPubnubGetAllChannelMetadataResult UPubnubClient::GetAllChannelMetadata_priv(FSt
 	FPubnubGetAllChannelMetadataResult FinalResult;
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_getall_metadata_opts PubnubOptions = pubnub_getall_metadata_defopts();
 	FUTF8StringHolder IncludeHolder(Include);
@@ -4107,18 +5656,18 @@ FPubnubGetAllChannelMetadataResult UPubnubClient::GetAllChannelMetadata_priv(FSt
 	pubnub_getall_channelmetadata_ex(ctx_pub, PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get all channel metadata request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data	
 	FPubnubGetAllChannelMetadataResult GetAllChannelMetadataResult;
-	UPubnubJsonUtilities::GetAllChannelMetadataJsonToData(JsonResponse, GetAllChannelMetadataResult.Result, GetAllChannelMetadataResult.ChannelsData, GetAllChannelMetadataResult.Page, GetAllChannelMetadataResult.TotalCount);
+	UPubnubJsonUtilities::GetAllChannelMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetAllChannelMetadataResult.Result, GetAllChannelMetadataResult.ChannelsData, GetAllChannelMetadataResult.Page, GetAllChannelMetadataResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(GetAllChannelMetadataResult.Result);
 	if (!GetAllChannelMetadataResult.Result.Error)
 	{
@@ -4142,8 +5691,8 @@ FPubnubChannelMetadataResult UPubnubClient::SetChannelMetadata_priv(FString Chan
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(ChannelMetadataObj, FinalResult);
 	//Make sure that provided ChannelMetadataObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(ChannelMetadataObj, false), TEXT("ChannelMetadataObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder ChannelMetadataObjHolder(ChannelMetadataObj);
 	FUTF8StringHolder ChannelHolder(Channel);
@@ -4152,18 +5701,18 @@ FPubnubChannelMetadataResult UPubnubClient::SetChannelMetadata_priv(FString Chan
 	pubnub_set_channelmetadata(ctx_pub, ChannelHolder.Get(), IncludeHolder.Get(), ChannelMetadataObjHolder.Get());
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("set channel metadata request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubChannelMetadataResult SetChannelMetadataResult;
-	UPubnubJsonUtilities::GetChannelMetadataJsonToData(JsonResponse, SetChannelMetadataResult.Result, SetChannelMetadataResult.ChannelData);
+	UPubnubJsonUtilities::GetChannelMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), SetChannelMetadataResult.Result, SetChannelMetadataResult.ChannelData);
 	PUBNUB_LOG_OPERATION_RESULT(SetChannelMetadataResult.Result);
 	if (!SetChannelMetadataResult.Result.Error)
 	{
@@ -4186,8 +5735,8 @@ FPubnubChannelMetadataResult UPubnubClient::GetChannelMetadata_priv(FString Chan
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder ChannelHolder(Channel);
 	FUTF8StringHolder IncludeHolder(Include);
@@ -4195,11 +5744,11 @@ FPubnubChannelMetadataResult UPubnubClient::GetChannelMetadata_priv(FString Chan
 	pubnub_get_channelmetadata(ctx_pub, IncludeHolder.Get(), ChannelHolder.Get());
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get channel metadata request sent."));
 
-	const FString JsonResponse = GetResponseForGetObject(ctx_pub);
+	const FAnsiStringView JsonResponse = GetResponseViewForGetObject(ctx_pub);
 	
 	//Parse Json response into data
 	FPubnubChannelMetadataResult GetChannelMetadataResult;
-	UPubnubJsonUtilities::GetChannelMetadataJsonToData(JsonResponse, GetChannelMetadataResult.Result, GetChannelMetadataResult.ChannelData);
+	UPubnubJsonUtilities::GetChannelMetadataJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetChannelMetadataResult.Result, GetChannelMetadataResult.ChannelData);
 	if (!GetChannelMetadataResult.Result.Error)
 	{
 		PUBNUB_LOG_FUNCTION_DEBUG(
@@ -4209,7 +5758,7 @@ FPubnubChannelMetadataResult UPubnubClient::GetChannelMetadata_priv(FString Chan
 	}
 	else if (GetChannelMetadataResult.Result.Status == 0)
 	{
-		// Malformed JSON or non-App-Context body: not covered by GetResponseForGetObject HTTP logging
+		// Malformed JSON or non-App-Context body: not covered by GetResponseViewForGetObject HTTP logging
 		PUBNUB_LOG_OPERATION_RESULT(GetChannelMetadataResult.Result);
 	}
 							
@@ -4223,8 +5772,8 @@ FPubnubOperationResult UPubnubClient::RemoveChannelMetadata_priv(FString Channel
 	);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_USER_ID_NOT_SET();
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 
 	FUTF8StringHolder ChannelHolder(Channel);
 
@@ -4260,8 +5809,8 @@ FPubnubMembershipsResult UPubnubClient::GetMemberships_priv(FString User, FStrin
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(User, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_membership_opts PubnubOptions = pubnub_membership_opts();
 	FUTF8StringHolder UserHolder(User);
@@ -4282,18 +5831,18 @@ FPubnubMembershipsResult UPubnubClient::GetMemberships_priv(FString User, FStrin
 	pubnub_get_memberships_ex(ctx_pub, PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get memberships request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubMembershipsResult GetMembershipsResult;
-	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse, GetMembershipsResult.Result, GetMembershipsResult.MembershipsData, GetMembershipsResult.Page, GetMembershipsResult.TotalCount);
+	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetMembershipsResult.Result, GetMembershipsResult.MembershipsData, GetMembershipsResult.Page, GetMembershipsResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(GetMembershipsResult.Result);
 	if (!GetMembershipsResult.Result.Error)
 	{
@@ -4322,8 +5871,8 @@ FPubnubMembershipsResult UPubnubClient::SetMemberships_priv(FString User, FStrin
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(SetObj, FinalResult);
 	//Make sure that provided SetObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(SetObj, false), TEXT("SetObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_membership_opts PubnubOptions = pubnub_membership_opts();
 	FUTF8StringHolder UserHolder(User);
@@ -4345,18 +5894,18 @@ FPubnubMembershipsResult UPubnubClient::SetMemberships_priv(FString User, FStrin
 	pubnub_set_memberships_ex(ctx_pub, SetObjHolder.Get(), PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("set memberships request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubMembershipsResult SetMembershipsResult;
-	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse, SetMembershipsResult.Result, SetMembershipsResult.MembershipsData, SetMembershipsResult.Page, SetMembershipsResult.TotalCount);
+	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse.GetData(), JsonResponse.Len(), SetMembershipsResult.Result, SetMembershipsResult.MembershipsData, SetMembershipsResult.Page, SetMembershipsResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(SetMembershipsResult.Result);
 	if (!SetMembershipsResult.Result.Error)
 	{
@@ -4385,8 +5934,8 @@ FPubnubMembershipsResult UPubnubClient::RemoveMemberships_priv(FString User, FSt
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(RemoveObj, FinalResult);
 	//Make sure that provided RemoveObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(RemoveObj, false), TEXT("RemoveObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_membership_opts PubnubOptions = pubnub_membership_opts();
 	FUTF8StringHolder UserHolder(User);
@@ -4408,18 +5957,18 @@ FPubnubMembershipsResult UPubnubClient::RemoveMemberships_priv(FString User, FSt
 	pubnub_remove_memberships_ex(ctx_pub, RemoveObjHolder.Get(), PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("remove memberships request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubMembershipsResult RemoveMembershipsResult;
-	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse, RemoveMembershipsResult.Result, RemoveMembershipsResult.MembershipsData, RemoveMembershipsResult.Page, RemoveMembershipsResult.TotalCount);
+	UPubnubJsonUtilities::GetMembershipsJsonToData(JsonResponse.GetData(), JsonResponse.Len(), RemoveMembershipsResult.Result, RemoveMembershipsResult.MembershipsData, RemoveMembershipsResult.Page, RemoveMembershipsResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(RemoveMembershipsResult.Result);
 	if (!RemoveMembershipsResult.Result.Error)
 	{
@@ -4445,8 +5994,8 @@ FPubnubChannelMembersResult UPubnubClient::GetChannelMembers_priv(FString Channe
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_members_opts PubnubOptions = pubnub_members_opts();
 	FUTF8StringHolder IncludeHolder(Include);
@@ -4466,18 +6015,18 @@ FPubnubChannelMembersResult UPubnubClient::GetChannelMembers_priv(FString Channe
 	pubnub_get_members_ex(ctx_pub, ChannelHolder.Get(), PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("get channel members request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubChannelMembersResult GetChannelMembersResult;
-	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse, GetChannelMembersResult.Result, GetChannelMembersResult.MembersData, GetChannelMembersResult.Page, GetChannelMembersResult.TotalCount);
+	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse.GetData(), JsonResponse.Len(), GetChannelMembersResult.Result, GetChannelMembersResult.MembersData, GetChannelMembersResult.Page, GetChannelMembersResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(GetChannelMembersResult.Result);
 	if (!GetChannelMembersResult.Result.Error)
 	{
@@ -4506,8 +6055,8 @@ FPubnubChannelMembersResult UPubnubClient::SetChannelMembers_priv(FString Channe
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(SetObj, FinalResult);
 	//Make sure that provided SetObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(SetObj, false), TEXT("SetObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_members_opts PubnubOptions = pubnub_members_opts();
 	FUTF8StringHolder IncludeHolder(Include);
@@ -4528,18 +6077,18 @@ FPubnubChannelMembersResult UPubnubClient::SetChannelMembers_priv(FString Channe
 	pubnub_set_members_ex(ctx_pub, ChannelHolder.Get(), SetObjHolder.Get(), PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("set channel members request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubChannelMembersResult SetChannelMembersResult;
-	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse, SetChannelMembersResult.Result, SetChannelMembersResult.MembersData, SetChannelMembersResult.Page, SetChannelMembersResult.TotalCount);
+	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse.GetData(), JsonResponse.Len(), SetChannelMembersResult.Result, SetChannelMembersResult.MembersData, SetChannelMembersResult.Page, SetChannelMembersResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(SetChannelMembersResult.Result);
 	if (!SetChannelMembersResult.Result.Error)
 	{
@@ -4568,8 +6117,8 @@ FPubnubChannelMembersResult UPubnubClient::RemoveChannelMembers_priv(FString Cha
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(RemoveObj, FinalResult);
 	//Make sure that provided RemoveObj is a correct Json string
 	PUBNUB_RETURN_WRAPPER_IF_CONDITION_FAILS(UPubnubJsonUtilities::IsCorrectJsonString(RemoveObj, false), TEXT("RemoveObj has to be a correct Json Object. Operation aborted."), FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	pubnub_members_opts PubnubOptions = pubnub_members_opts();
 	FUTF8StringHolder IncludeHolder(Include);
@@ -4590,18 +6139,18 @@ FPubnubChannelMembersResult UPubnubClient::RemoveChannelMembers_priv(FString Cha
 	pubnub_remove_members_ex(ctx_pub, ChannelHolder.Get(), RemoveObjHolder.Get(), PubnubOptions);
 	PUBNUB_LOG_FUNCTION_TRACE(TEXT("remove channel members request sent."));
 
-	FString JsonResponse = GetLastResponse(ctx_pub);
-	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *JsonResponse));
+	FAnsiStringView JsonResponse = GetLastResponseView(ctx_pub);
+	PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	//If last response is empty, it means that there was an error, so return server response instead
 	if(JsonResponse.IsEmpty())
 	{
-		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponse(ctx_pub);
-		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *JsonResponse));
+		JsonResponse = UPubnubUtilities::PubnubGetLastServerHttpResponseView(ctx_pub);
+		PUBNUB_LOG_FUNCTION_TRACE(FString::Printf(TEXT("fallback json response: %s"), *UPubnubUtilities::Utf8ViewToString(JsonResponse)));
 	}
 	
 	//Parse Json response into data
 	FPubnubChannelMembersResult RemoveChannelMembersResult;
-	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse, RemoveChannelMembersResult.Result, RemoveChannelMembersResult.MembersData, RemoveChannelMembersResult.Page, RemoveChannelMembersResult.TotalCount);
+	UPubnubJsonUtilities::GetChannelMembersJsonToData(JsonResponse.GetData(), JsonResponse.Len(), RemoveChannelMembersResult.Result, RemoveChannelMembersResult.MembersData, RemoveChannelMembersResult.Page, RemoveChannelMembersResult.TotalCount);
 	PUBNUB_LOG_OPERATION_RESULT(RemoveChannelMembersResult.Result);
 	if (!RemoveChannelMembersResult.Result.Error)
 	{
@@ -4626,8 +6175,8 @@ FPubnubAddMessageActionResult UPubnubClient::AddMessageAction_priv(FString Chann
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(MessageTimetoken, FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(ActionType, FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Value, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	//Add quotes to these fields as they are required by C-Core
 	FString FinalActionType = UPubnubUtilities::AddQuotesToString(ActionType);
@@ -4676,8 +6225,8 @@ FPubnubOperationResult UPubnubClient::RemoveMessageAction_priv(FString Channel,
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(Channel);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(MessageTimetoken);
 	PUBNUB_RETURN_OPERATION_RESULT_IF_FIELD_EMPTY(ActionTimetoken);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED();
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY();
 	
 	//Add quotes to these fields as they are required by C-Core
 	FString FinalMessageTimetoken = UPubnubUtilities::AddQuotesToString(MessageTimetoken);
@@ -4731,8 +6280,8 @@ FPubnubGetMessageActionsResult UPubnubClient::GetMessageActions_priv(FString Cha
 
 	PUBNUB_RETURN_WRAPPER_IF_USER_ID_NOT_SET(FinalResult);
 	PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY(Channel, FinalResult);
-	// Try to acquire lock - fail fast if another operation is in progress
-	PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(FinalResult);
+	// Check out a pooled context - waits up to ContextAcquireTimeoutMs if all of them are busy
+	PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(FinalResult);
 
 	FUTF8StringHolder ChannelHolder(Channel);
 	FUTF8StringHolder StartHolder(Start);
@@ -4777,7 +6326,7 @@ void UPubnubClient::SubscribeWithSubscriptionAsync(UPubnubSubscription* Subscrip
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnSubscribeResponse, SubscribeResult);
-	});
+	}, EPubnubOperationClass::StateChange);
 }
 
 FPubnubOperationResult UPubnubClient::SubscribeWithSubscription(UPubnubSubscription* Subscription, FPubnubSubscriptionCursor Cursor)
@@ -4797,6 +6346,7 @@ FPubnubOperationResult UPubnubClient::SubscribeWithSubscription(UPubnubSubscript
 		TEXT("Subscribe operation timed out"),
 		[&]()
 		{
+			ApplySubscribeFilterExpression_priv(Subscription->FilterExpression);
 			if(!UPubnubInternalUtilities::EESubscribeWithSubscription(Subscription->CCoreSubscription, Cursor))
 			{
 				PUBNUB_LOG_FUNCTION_ERROR(TEXT("failed to subscribe with subscription."));
@@ -4831,7 +6381,7 @@ void UPubnubClient::SubscribeWithSubscriptionSetAsync(UPubnubSubscriptionSet* Su
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnSubscribeResponse, SubscribeResult);
-	});
+	}, EPubnubOperationClass::StateChange);
 }
 
 FPubnubOperationResult UPubnubClient::SubscribeWithSubscriptionSet(UPubnubSubscriptionSet* SubscriptionSet, FPubnubSubscriptionCursor Cursor)
@@ -4851,6 +6401,7 @@ FPubnubOperationResult UPubnubClient::SubscribeWithSubscriptionSet(UPubnubSubscr
 		TEXT("Subscribe operation timed out"),
 		[&]()
 		{
+			ApplySubscribeFilterExpression_priv(SubscriptionSet->FilterExpression);
 			if(!UPubnubInternalUtilities::EESubscribeWithSubscriptionSet(SubscriptionSet->CCoreSubscriptionSet, Cursor))
 			{
 				PUBNUB_LOG_FUNCTION_ERROR(TEXT("failed to subscribe with subscription set."));
@@ -4885,7 +6436,7 @@ void UPubnubClient::UnsubscribeWithSubscriptionAsync(UPubnubSubscription* Subscr
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUnsubscribeResponse, UnsubscribeResult);
-	});
+	}, EPubnubOperationClass::StateChange);
 }
 
 FPubnubOperationResult UPubnubClient::UnsubscribeWithSubscription(UPubnubSubscription* Subscription)
@@ -4929,7 +6480,7 @@ void UPubnubClient::UnsubscribeWithSubscriptionSetAsync(UPubnubSubscriptionSet*
 
 		//Execute provided delegate with results
 		UPubnubUtilities::CallPubnubDelegate(OnUnsubscribeResponse, UnsubscribeResult);
-	});
+	}, EPubnubOperationClass::StateChange);
 }
 
 FPubnubOperationResult UPubnubClient::UnsubscribeWithSubscriptionSet(UPubnubSubscriptionSet* SubscriptionSet)
@@ -4960,6 +6511,17 @@ FPubnubOperationResult UPubnubClient::UnsubscribeWithSubscriptionSet(UPubnubSubs
 
 void UPubnubClient::CleanUpAllSubscriptions()
 {
+	//Sets don't own their subscriptions, those are freed below
+	for(auto& Pair : ClientSubscriptionSets)
+	{
+		pubnub_subscription_set_t* SubscriptionSet = Pair.Key;
+		if(SubscriptionSet)
+		{
+			pubnub_subscription_set_free(&SubscriptionSet);
+		}
+	}
+	ClientSubscriptionSets.Empty();
+
 	for(auto& Pair : ChannelSubscriptions)
 	{
 		if(Pair.Value)
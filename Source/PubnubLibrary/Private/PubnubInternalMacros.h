@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "FunctionLibraries/PubnubLogUtilities.h"
 #include "PubnubInternalStructLibrary.h"
+#include "Threads/PubnubContextPool.h"
 
 /**
  * Formats a single named value as "Name=Value" using PubnubLogUtilities::LogToString.
@@ -21,6 +22,13 @@
 #define PUBNUB_LOG_INPUT(Var) \
 	PUBNUB_LOG_VALUE(Var)
 
+/**
+ * True if LoggerManager exists and any of its loggers accepts UE SDK messages of the provided level.
+ * All logging macros check it first, so their arguments are not evaluated at all when the level is disabled.
+ */
+#define PUBNUB_LOG_LEVEL_ENABLED(Level) \
+	(LoggerManager && LoggerManager->IsLogEnabled(Level, EPubnubLogSource::PLS_UE))
+
 /**
  * Logs a message prefixed with current function name at the provided level.
  *
@@ -29,7 +37,7 @@
  */
 #define PUBNUB_LOG_FUNCTION(Level, MessageText) \
 	do { \
-		if (LoggerManager) \
+		if (PUBNUB_LOG_LEVEL_ENABLED(Level)) \
 		{ \
 			const FString FunctionName = UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__)); \
 			LoggerManager->Log( \
@@ -53,7 +61,7 @@
  */
 #define PUBNUB_LOG_FUNCTION_INPUTS_DEBUG(...) \
 	do { \
-		if (LoggerManager) \
+		if (PUBNUB_LOG_LEVEL_ENABLED(EPubnubLogLevel::PLL_Debug)) \
 		{ \
 			const TArray<FString> InputPairs = { __VA_ARGS__ }; \
 			const FString InputsText = FString::Join(InputPairs, TEXT("\n\t-")); \
@@ -78,7 +86,7 @@
  */
 #define PUBNUB_LOG_FUNCTION_DEBUG(Comment, ...) \
 	do { \
-		if (LoggerManager) \
+		if (PUBNUB_LOG_LEVEL_ENABLED(EPubnubLogLevel::PLL_Debug)) \
 		{ \
 			const TArray<FString> ValuePairs = { __VA_ARGS__ }; \
 			const FString ValuesText = FString::Join(ValuePairs, TEXT("\n\t-")); \
@@ -373,6 +381,42 @@
 		} \
 	} while (false)
 
+/**
+ * Ensures that the PubnubClient is properly initialized before proceeding.
+ *
+ * If the client is not initialized or the internal PubnubCallsThread is invalid,
+ * this macro will:
+ *   - Log an error message to the output log
+ *   - Return an array of Count wrapper structs, each with the same error information
+ *
+ * Usage: Use in batch functions that return one wrapper struct per request (e.g., PublishBatch).
+ *
+ * @param WrapperType The wrapper struct type stored in the returned array
+ * @param Count Number of wrapper structs to return
+ */
+#define PUBNUB_RETURN_WRAPPER_ARRAY_IF_NOT_INITIALIZED(WrapperType, Count) \
+	do { \
+		WrapperType ErrorWrapper; \
+		if (!IsInitialized) \
+		{ \
+			UE_LOG(PubnubLog, Error, TEXT("%s"), *FString::Printf(TEXT("[%s]: PubnubClient is not initialized. Aborting operation. This client was already destroyed or was not initialized correctly."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__)))); \
+			ErrorWrapper.Result.Error = true; \
+			ErrorWrapper.Result.ErrorMessage = TEXT("PubnubClient is not initialized. Aborting operation. This client was already destroyed or was not initialized correctly."); \
+			TArray<WrapperType> ErrorWrappers; \
+			ErrorWrappers.Init(ErrorWrapper, Count); \
+			return ErrorWrappers; \
+		} \
+		if (!PubnubCallsThread) \
+		{ \
+			UE_LOG(PubnubLog, Error, TEXT("%s"), *FString::Printf(TEXT("[%s]: PubnubCallsThread is invalid. Aborting operation. This client was already destroyed or was not initialized correctly."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__)))); \
+			ErrorWrapper.Result.Error = true; \
+			ErrorWrapper.Result.ErrorMessage = TEXT("PubnubCallsThread is invalid. Aborting operation. This client was already destroyed or was not initialized correctly."); \
+			TArray<WrapperType> ErrorWrappers; \
+			ErrorWrappers.Init(ErrorWrapper, Count); \
+			return ErrorWrappers; \
+		} \
+	} while (false)
+
 /**
  * Ensures that the PubnubClient is properly initialized before proceeding.
  *
@@ -511,76 +555,79 @@
 	} while (false)
 
 /**
- * Attempts to acquire the PubnubOperationMutex lock to prevent concurrent operations.
+ * Checks out a free C-Core context from the client's ContextPool for the current operation.
  *
- * On success, an RAII guard (FPubnubOperationLockGuard) is created in the caller's
- * scope; the lock is automatically released when the calling function returns -
- * including the post-pubnub_await result accessors. This is intentional and lets
- * DeinitializeClient safely synchronize with in-flight operations by acquiring
- * the same mutex before freeing C-Core contexts.
+ * On success, an RAII lease (FPubnubContextLease) is created in the caller's scope together
+ * with a local `ctx_pub` pointing at the checked-out context. The context is automatically
+ * returned to the pool when the calling function returns - including the post-pubnub_await
+ * result accessors. This is intentional and lets DeinitializeClient safely synchronize with
+ * in-flight operations by locking the whole pool before freeing C-Core contexts.
+ * The checkout is counted as one request in the pool's connection stats (FPubnubContextPool::RecordRequest).
  *
- * If the lock is already held (another operation is in progress), this macro will:
+ * If every pooled context is busy (ContextPoolSize operations already in progress), this macro waits up to
+ * FPubnubConfig::ContextAcquireTimeoutMs for one to be released. If none is released in that time, it will:
  *   - Log a warning message about concurrent usage
  *   - Set the error flag in the provided wrapper struct
  *   - Return the wrapper struct with error information
  *
  * IMPORTANT: This macro must be used as a complete statement at function scope
  * (not inside a single-statement if/else without braces). It declares a local
- * RAII guard whose lifetime must extend to the end of the calling function.
+ * RAII lease whose lifetime must extend to the end of the calling function.
  *
- * Usage: Use at the beginning of _priv functions that return wrapper structs to ensure
- *        operations are not called concurrently (mixing Sync and Async is not supported).
+ * Usage: Use at the beginning of _priv functions that return wrapper structs and run a C-Core transaction.
  *
  * @param ReturnWrapper The wrapper struct type to return on failure
  */
-#define PUBNUB_TRY_LOCK_MUTEX_RETURN_WRAPPER_IF_LOCKED(ReturnWrapper) \
-	FPubnubOperationLockGuard PubnubOperationLockGuard(PubnubOperationMutex); \
-	if (!PubnubOperationLockGuard.TryLock()) \
+#define PUBNUB_ACQUIRE_CONTEXT_RETURN_WRAPPER_IF_BUSY(ReturnWrapper) \
+	FPubnubContextLease PubnubContextLease(ContextPool); \
+	if (!PubnubContextLease.TryAcquire(static_cast<uint32>(FMath::Max(0, PubnubConfig.ContextAcquireTimeoutMs)))) \
 	{ \
 		if (LoggerManager) \
 		{ \
-			LoggerManager->Log(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE, FString::Printf(TEXT("[%s]: Another Pubnub operation is in progress. Do not call Sync and Async functions concurrently."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__))), ANSI_TO_TCHAR(__FUNCTION__)); \
+			LoggerManager->Log(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE, FString::Printf(TEXT("[%s]: No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__))), ANSI_TO_TCHAR(__FUNCTION__)); \
 		} \
 		FPubnubOperationResult Result; \
 		Result.Error = true; \
-		Result.ErrorMessage = FString::Printf(TEXT("Another Pubnub operation is in progress. Do not call Sync and Async functions concurrently.")); \
+		Result.ErrorMessage = FString::Printf(TEXT("No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently.")); \
 		ReturnWrapper.Result = Result; \
 		return ReturnWrapper; \
-	}
+	} \
+	pubnub_t* const ctx_pub = PubnubContextLease.Get(); \
+	ContextPool->RecordRequest(ctx_pub);
 
 /**
- * Attempts to acquire the PubnubOperationMutex lock to prevent concurrent operations.
+ * Checks out a free C-Core context from the client's ContextPool for the current operation.
  *
- * On success, an RAII guard (FPubnubOperationLockGuard) is created in the caller's
- * scope; the lock is automatically released when the calling function returns -
- * including the post-pubnub_await result accessors. This is intentional and lets
- * DeinitializeClient safely synchronize with in-flight operations by acquiring
- * the same mutex before freeing C-Core contexts.
+ * On success, an RAII lease (FPubnubContextLease) is created in the caller's scope together
+ * with a local `ctx_pub` pointing at the checked-out context. The context is automatically
+ * returned to the pool when the calling function returns.
  *
- * If the lock is already held (another operation is in progress), this macro will:
+ * If every pooled context is busy (ContextPoolSize operations already in progress), this macro waits up to
+ * FPubnubConfig::ContextAcquireTimeoutMs for one to be released. If none is released in that time, it will:
  *   - Log a warning message about concurrent usage
  *   - Return an FPubnubOperationResult with error information
  *
  * IMPORTANT: This macro must be used as a complete statement at function scope
  * (not inside a single-statement if/else without braces). It declares a local
- * RAII guard whose lifetime must extend to the end of the calling function.
+ * RAII lease whose lifetime must extend to the end of the calling function.
  *
- * Usage: Use at the beginning of _priv functions that return FPubnubOperationResult to ensure
- *        operations are not called concurrently (mixing Sync and Async is not supported).
+ * Usage: Use at the beginning of _priv functions that return FPubnubOperationResult and run a C-Core transaction.
  */
-#define PUBNUB_TRY_LOCK_MUTEX_RETURN_OPERATION_RESULT_IF_LOCKED() \
-	FPubnubOperationLockGuard PubnubOperationLockGuard(PubnubOperationMutex); \
-	if (!PubnubOperationLockGuard.TryLock()) \
+#define PUBNUB_ACQUIRE_CONTEXT_RETURN_OPERATION_RESULT_IF_BUSY() \
+	FPubnubContextLease PubnubContextLease(ContextPool); \
+	if (!PubnubContextLease.TryAcquire(static_cast<uint32>(FMath::Max(0, PubnubConfig.ContextAcquireTimeoutMs)))) \
 	{ \
 		if (LoggerManager) \
 		{ \
-			LoggerManager->Log(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE, FString::Printf(TEXT("[%s]: Another Pubnub operation is in progress. Do not call Sync and Async functions concurrently."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__))), ANSI_TO_TCHAR(__FUNCTION__)); \
+			LoggerManager->Log(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE, FString::Printf(TEXT("[%s]: No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently."), *UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__))), ANSI_TO_TCHAR(__FUNCTION__)); \
 		} \
 		FPubnubOperationResult Result; \
 		Result.Error = true; \
-		Result.ErrorMessage = FString::Printf(TEXT("Another Pubnub operation is in progress. Do not call Sync and Async functions concurrently.")); \
+		Result.ErrorMessage = FString::Printf(TEXT("No pooled context was released within ContextAcquireTimeoutMs. Increase ContextPoolSize in FPubnubConfig to run more operations concurrently.")); \
 		return Result; \
-	}
+	} \
+	pubnub_t* const ctx_pub = PubnubContextLease.Get(); \
+	ContextPool->RecordRequest(ctx_pub);
 
 
 /**
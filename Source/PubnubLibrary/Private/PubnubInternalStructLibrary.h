@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "HAL/CriticalSection.h"
+#include <atomic>
+#include "PubnubStructLibrary.h"
+#include "PubnubNativeMessage.h"
+#include "FunctionLibraries/PubnubUtilities.h"
+#include "Threads/PubnubMpscRingBuffer.h"
 
 THIRD_PARTY_INCLUDES_START
 #include "PubNub.h"
@@ -11,6 +16,60 @@ THIRD_PARTY_INCLUDES_END
 
 class UPubnubSubscription;
 class UPubnubSubscriptionSet;
+class UPubnubSubscriptionBase;
+
+/**
+ * Message received by a C-Core subscribe listener, waiting in the client's FPubnubReceivedMessageQueue
+ * to be broadcast on the game thread.
+ */
+struct FPubnubReceivedMessage
+{
+	FPubnubNativeMessage Message;
+	//Subscription (or subscription set) whose listener received the message. Not used for client-level subscriptions
+	TWeakObjectPtr<UPubnubSubscriptionBase> Subscription;
+	EPubnubListenerType ListenerType = EPubnubListenerType::PLT_Message;
+	//Generation of the subscription's listeners when the message was received. Messages received before a pooled subscription was reused are dropped
+	uint32 ListenerGeneration = 0;
+	//Message comes from SubscribeToChannel/SubscribeToGroup and goes to client's OnMessageReceived delegates
+	bool bForClient = false;
+};
+
+/**
+ * Queue between C-Core subscribe callbacks and UPubnubClient per-frame delivery on the game thread.
+ * Shared with all subscribe listeners, so it stays valid for callbacks that are still running while the client deinitializes.
+ */
+struct FPubnubReceivedMessageQueue : public TPubnubMpscRingBuffer<FPubnubReceivedMessage>
+{
+	explicit FPubnubReceivedMessageQueue(uint32 InCapacity)
+		: TPubnubMpscRingBuffer<FPubnubReceivedMessage>(InCapacity)
+		, MessageArena(MakeShared<FPubnubMessageArena, ESPMode::ThreadSafe>(FMath::Min<int32>(Capacity(), MaxPooledMessageBlocks)))
+	{
+	}
+
+	//Queues message received by a listener. C-Core thread never waits for the game thread, so if the queue is full the message is dropped and counted
+	void Enqueue(FPubnubReceivedMessage&& Received)
+	{
+		if(!TryPush(MoveTemp(Received)))
+		{
+			DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	//Returns number of messages dropped since the last call
+	uint64 TakeDroppedCount()
+	{
+		return DroppedCount.exchange(0, std::memory_order_relaxed);
+	}
+
+	//Payloads of queued messages. A block goes back to the arena when its message is delivered and dropped
+	TSharedRef<FPubnubMessageArena, ESPMode::ThreadSafe> MessageArena;
+
+private:
+
+	static constexpr int32 MaxPooledMessageBlocks = 1024;
+
+	std::atomic<uint64> DroppedCount{0};
+};
 
 /**
  * Internal structs for the Pubnub library.
@@ -23,9 +82,21 @@ class UPubnubSubscriptionSet;
  * Each callback pointer must match registration so we can unregister before ListenerUserData
  * is freed; otherwise PubNub can still invoke the listener during unsubscribe / subscription_free.
  */
+/**
+ * user_data of the client-level listeners (SubscribeToChannel/SubscribeToGroup). Used instead of the raw client pointer,
+ * so a callback that is still running while the client deinitializes keeps pushing into a live queue.
+ */
+struct FPubnubInternalClientListenerUserData
+{
+	TSharedPtr<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe> MessageQueue;
+};
+
 struct FPubnubInternalSubscriptionListenerUserData
 {
 	TWeakObjectPtr<UPubnubSubscription> WeakSubscription;
+	TSharedPtr<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe> MessageQueue;
+	//Incremented every time the subscription goes back to the client's pool
+	std::atomic<uint32> Generation{0};
 
 	pubnub_subscribe_message_callback_t MessageCb = nullptr;
 	pubnub_subscribe_message_callback_t SignalCb = nullptr;
@@ -36,6 +107,7 @@ struct FPubnubInternalSubscriptionListenerUserData
 struct FPubnubInternalSubscriptionSetListenerUserData
 {
 	TWeakObjectPtr<UPubnubSubscriptionSet> WeakSubscriptionSet;
+	TSharedPtr<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe> MessageQueue;
 
 	pubnub_subscribe_message_callback_t MessageCb = nullptr;
 	pubnub_subscribe_message_callback_t SignalCb = nullptr;
@@ -44,46 +116,22 @@ struct FPubnubInternalSubscriptionSetListenerUserData
 };
 
 /**
- * RAII guard around a non-blocking acquisition of an FCriticalSection.
- *
- * The guard is intentionally constructed in two phases (construct + TryLock) so it
- * can be declared at function scope by a macro, and only the TryLock() result needs
- * to drive control flow. If TryLock() succeeds the lock is automatically released
- * when the enclosing function returns; if it fails the destructor is a no-op.
- *
- * Used by PUBNUB_TRY_LOCK_MUTEX_* macros (PubnubInternalMacros.h) to guarantee that
- * the operation mutex is never leaked across early returns and is always released
- * after every code path that touches a Pubnub C-Core context (including the
- * post-pubnub_await result accessors such as pubnub_last_http_code /
- * pubnub_last_publish_result), so DeinitializeClient can safely free those
- * contexts under the same mutex.
+ * Publish transaction started on a C-Core context. C-Core keeps raw pointers to the message and options
+ * (POST publish sends the body only after pubnub_publish_ex returns), so the converted strings
+ * have to stay alive until the transaction finishes.
  */
-struct FPubnubOperationLockGuard
+struct FPubnubInternalPublishTransaction
 {
-	explicit FPubnubOperationLockGuard(FCriticalSection& InMutex)
-		: Mutex(InMutex)
-		, bLocked(false)
+	FPubnubInternalPublishTransaction(const FString& Channel, const FString& SerializedMessage, const FPubnubPublishSettings& PublishSettings)
+		: ChannelHolder(Channel)
+		, MessageHolder(SerializedMessage)
+		, MetaHolder(PublishSettings.MetaData)
+		, CustomMessageTypeHolder(PublishSettings.CustomMessageType)
 	{
 	}
 
-	~FPubnubOperationLockGuard()
-	{
-		if (bLocked)
-		{
-			Mutex.Unlock();
-		}
-	}
-
-	bool TryLock()
-	{
-		bLocked = Mutex.TryLock();
-		return bLocked;
-	}
-
-	FPubnubOperationLockGuard(const FPubnubOperationLockGuard&) = delete;
-	FPubnubOperationLockGuard& operator=(const FPubnubOperationLockGuard&) = delete;
-
-private:
-	FCriticalSection& Mutex;
-	bool bLocked;
+	FUTF8StringHolder ChannelHolder;
+	FUTF8StringHolder MessageHolder;
+	FUTF8StringHolder MetaHolder;
+	FUTF8StringHolder CustomMessageTypeHolder;
 };
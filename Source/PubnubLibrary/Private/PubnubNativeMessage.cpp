@@ -0,0 +1,219 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "PubnubNativeMessage.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "FunctionLibraries/PubnubUtilities.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeRWLock.h"
+
+
+const FString FPubnubInternedName::EmptyName;
+
+FPubnubNameTable& FPubnubNameTable::Get()
+{
+	static FPubnubNameTable NameTable;
+	return NameTable;
+}
+
+FPubnubNameTable::~FPubnubNameTable()
+{
+	for(const TPair<uint32, FEntry*>& Pair : EntriesByHash)
+	{
+		delete Pair.Value;
+	}
+}
+
+const FPubnubNameTable::FEntry* FPubnubNameTable::Find_priv(uint32 Hash, FAnsiStringView Utf8Name) const
+{
+	for(auto It = EntriesByHash.CreateConstKeyIterator(Hash); It; ++It)
+	{
+		const FEntry* Entry = It.Value();
+		if(Entry->Utf8Name.Num() == Utf8Name.Len() && FMemory::Memcmp(Entry->Utf8Name.GetData(), Utf8Name.GetData(), Utf8Name.Len()) == 0)
+		{
+			return Entry;
+		}
+	}
+	return nullptr;
+}
+
+FPubnubInternedName FPubnubNameTable::Intern(FAnsiStringView Utf8Name)
+{
+	FPubnubInternedName InternedName;
+	if(Utf8Name.IsEmpty())
+	{
+		return InternedName;
+	}
+
+	const uint32 Hash = FCrc::MemCrc32(Utf8Name.GetData(), Utf8Name.Len());
+	{
+		FReadScopeLock ReadLock(Lock);
+		if(const FEntry* Entry = Find_priv(Hash, Utf8Name))
+		{
+			InternedName.Name = &Entry->Name;
+			return InternedName;
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+	//Another thread could add the same name between the locks
+	if(const FEntry* Entry = Find_priv(Hash, Utf8Name))
+	{
+		InternedName.Name = &Entry->Name;
+		return InternedName;
+	}
+
+	FEntry* NewEntry = new FEntry();
+	NewEntry->Utf8Name.Append(Utf8Name.GetData(), Utf8Name.Len());
+	NewEntry->Name = UPubnubUtilities::Utf8ViewToString(Utf8Name);
+	EntriesByHash.Add(Hash, NewEntry);
+	InternedName.Name = &NewEntry->Name;
+	return InternedName;
+}
+
+FPubnubInternedName FPubnubNameTable::Intern(const FString& Name)
+{
+	FTCHARToUTF8 Converter(*Name, Name.Len());
+	return Intern(FAnsiStringView(Converter.Get(), Converter.Length()));
+}
+
+int32 FPubnubNameTable::Num() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return EntriesByHash.Num();
+}
+
+uint32 FPubnubMessageArenaBlock::AddRef() const
+{
+	return RefCount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+uint32 FPubnubMessageArenaBlock::Release() const
+{
+	const uint32 NewRefCount = RefCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+	if(NewRefCount == 0)
+	{
+		//Block can be deleted by ReturnBlock or by the arena destructor, so nothing touches it after this
+		TSharedPtr<FPubnubMessageArena, ESPMode::ThreadSafe> OwningArena = MoveTemp(Arena);
+		FPubnubMessageArenaBlock* MutableThis = const_cast<FPubnubMessageArenaBlock*>(this);
+		if(OwningArena)
+		{
+			OwningArena->ReturnBlock(MutableThis);
+		}
+		else
+		{
+			delete MutableThis;
+		}
+	}
+	return NewRefCount;
+}
+
+FAnsiStringView FPubnubMessageArenaBlock::Append(FAnsiStringView Bytes)
+{
+	//Growing the block would move bytes that other views already point at
+	if(Bytes.IsEmpty() || Data.Num() + Bytes.Len() > Data.Max())
+	{
+		return FAnsiStringView();
+	}
+	const int32 Offset = Data.Num();
+	Data.Append(Bytes.GetData(), Bytes.Len());
+	return FAnsiStringView(Data.GetData() + Offset, Bytes.Len());
+}
+
+FPubnubMessageArena::FPubnubMessageArena(int32 InMaxFreeBlocks)
+	: MaxFreeBlocks(FMath::Max(InMaxFreeBlocks, 0))
+{
+	//Fixed-size stack, so returning a block never allocates
+	FreeBlocks.SetNumZeroed(MaxFreeBlocks);
+}
+
+FPubnubMessageArena::~FPubnubMessageArena()
+{
+	for(int32 Index = 0; Index < NumFree; Index++)
+	{
+		delete FreeBlocks[Index];
+	}
+}
+
+TRefCountPtr<FPubnubMessageArenaBlock> FPubnubMessageArena::Acquire(int32 Capacity)
+{
+	FPubnubMessageArenaBlock* Block = nullptr;
+	{
+		FScopeLock FreeBlocksLock(&FreeBlocksMutex);
+		if(NumFree > 0)
+		{
+			Block = FreeBlocks[--NumFree];
+		}
+	}
+	if(!Block)
+	{
+		Block = new FPubnubMessageArenaBlock();
+	}
+
+	//Keeps the memory of the previous message if it's big enough
+	Block->Data.Reset(FMath::Max(Capacity, 0));
+	Block->Arena = AsShared();
+	return TRefCountPtr<FPubnubMessageArenaBlock>(Block);
+}
+
+void FPubnubMessageArena::ReturnBlock(FPubnubMessageArenaBlock* Block)
+{
+	if(Block->GetCapacity() <= MaxPooledBlockSize)
+	{
+		FScopeLock FreeBlocksLock(&FreeBlocksMutex);
+		if(NumFree < MaxFreeBlocks)
+		{
+			FreeBlocks[NumFree++] = Block;
+			return;
+		}
+	}
+	delete Block;
+}
+
+int32 FPubnubMessageArena::NumFreeBlocks() const
+{
+	FScopeLock FreeBlocksLock(&FreeBlocksMutex);
+	return NumFree;
+}
+
+FString FPubnubNativeMessage::GetMessageString() const
+{
+	return UPubnubJsonUtilities::JsonPayloadToMessageString(Payload.GetData(), Payload.Len());
+}
+
+FString FPubnubNativeMessage::GetTimetokenString() const
+{
+	return Timetoken != 0 ? FString::Printf(TEXT("%lld"), Timetoken) : FString();
+}
+
+FPubnubMessageData FPubnubNativeMessage::ToMessageData() const
+{
+	FPubnubMessageData MessageData;
+	MessageData.Message = GetMessageString();
+	MessageData.Channel = Channel.ToString();
+	MessageData.UserID = UserID.ToString();
+	MessageData.Timetoken = GetTimetokenString();
+	MessageData.Metadata = UPubnubUtilities::Utf8ViewToString(Metadata);
+	MessageData.MessageType = MessageType;
+	MessageData.CustomMessageType = CustomMessageType.ToString();
+	MessageData.MatchOrGroup = MatchOrGroup.ToString();
+	return MessageData;
+}
+
+int64 FPubnubNativeMessage::ParseTimetoken(FAnsiStringView Timetoken)
+{
+	int64 Value = 0;
+	for(const ANSICHAR Character : Timetoken)
+	{
+		if(Character < '0' || Character > '9')
+		{
+			return 0;
+		}
+		const int64 Digit = Character - '0';
+		if(Value > (MAX_int64 - Digit) / 10)
+		{
+			return 0;
+		}
+		Value = Value * 10 + Digit;
+	}
+	return Value;
+}
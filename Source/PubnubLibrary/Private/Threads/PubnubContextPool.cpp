@@ -0,0 +1,360 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+
+#include "Threads/PubnubContextPool.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "PubNub.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#endif
+extern "C" {
+#include "openssl/pubnub_get_native_socket.h"
+}
+#if PLATFORM_WINDOWS
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+
+
+namespace
+{
+	//Reserved context bound to the current thread. Pool is stored too, as every client has its own pool
+	thread_local const FPubnubContextPool* BoundPool = nullptr;
+	thread_local int32 BoundSlotIndex = INDEX_NONE;
+
+	//Idle context keeps its socket only while the keep-alive connection from the previous transaction is still open
+	bool HasOpenConnection(pubnub_t* Context)
+	{
+#if PLATFORM_WINDOWS
+		return pubnub_get_native_socket(Context) != INVALID_SOCKET;
+#else
+		return pubnub_get_native_socket(Context) >= 0;
+#endif
+	}
+}
+
+FPubnubContextPool::FPubnubContextPool(int32 InSharedPoolSize, int32 InReservedPoolSize)
+{
+	SharedPoolSize = FMath::Max(1, InSharedPoolSize);
+	Slots.SetNum(SharedPoolSize + FMath::Max(0, InReservedPoolSize));
+	ContextReleasedEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FPubnubContextPool::~FPubnubContextPool()
+{
+	//Contexts should be freed explicitly by the owner, but don't leak them if that didn't happen
+	LockAll();
+	FreeContexts();
+	UnlockAll();
+
+	FPlatformProcess::ReturnSynchEventToPool(ContextReleasedEvent);
+	ContextReleasedEvent = nullptr;
+}
+
+bool FPubnubContextPool::AllocateContexts(const char* PublishKey, const char* SubscribeKey)
+{
+	for(FContextSlot& Slot : Slots)
+	{
+		pubnub_t* Context = pubnub_alloc();
+		if(!Context)
+		{
+			return false;
+		}
+
+		pubnub_enforce_api(Context, PNA_SYNC);
+		pubnub_init(Context, PublishKey, SubscribeKey);
+		//Connections are reused between transactions, so back-to-back and batched publishes skip the TCP/TLS handshake. Can be turned off with FPubnubNetworkingConfig
+		pubnub_use_http_keep_alive(Context);
+		Slot.Context = Context;
+	}
+	return true;
+}
+
+void FPubnubContextPool::FreeContexts()
+{
+	for(FContextSlot& Slot : Slots)
+	{
+		if(!Slot.Context)
+		{
+			continue;
+		}
+
+		//Drain any residual cancelled operation. No-op if context is idle.
+		pubnub_await(Slot.Context);
+		pubnub_free(Slot.Context);
+		Slot.Context = nullptr;
+	}
+}
+
+void FPubnubContextPool::CancelAll()
+{
+	{
+		FScopeLock PoolLock(&PoolMutex);
+		CancelGeneration++;
+	}
+	//Wakes one waiter of Acquire, which passes it on to the next one
+	ContextReleasedEvent->Trigger();
+
+	for(FContextSlot& Slot : Slots)
+	{
+		if(Slot.Context)
+		{
+			pubnub_cancel(Slot.Context);
+		}
+	}
+}
+
+int32 FPubnubContextPool::TryAcquire()
+{
+	FScopeLock PoolLock(&PoolMutex);
+	if(LockCount > 0)
+	{
+		return INDEX_NONE;
+	}
+	return AcquireFreeSlot_priv();
+}
+
+int32 FPubnubContextPool::Acquire(uint32 TimeoutMs)
+{
+	uint32 StartCancelGeneration = 0;
+	{
+		FScopeLock PoolLock(&PoolMutex);
+		if(LockCount > 0)
+		{
+			return INDEX_NONE;
+		}
+		const int32 SlotIndex = AcquireFreeSlot_priv();
+		if(SlotIndex != INDEX_NONE || TimeoutMs == 0)
+		{
+			return SlotIndex;
+		}
+		StartCancelGeneration = CancelGeneration;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + TimeoutMs / 1000.0;
+	while(true)
+	{
+		const double RemainingMs = (EndTime - FPlatformTime::Seconds()) * 1000.0;
+		if(RemainingMs <= 0.0)
+		{
+			return INDEX_NONE;
+		}
+		const bool bWoken = ContextReleasedEvent->Wait(FMath::Max<uint32>(1, static_cast<uint32>(RemainingMs)));
+
+		FScopeLock PoolLock(&PoolMutex);
+		if(LockCount > 0 || CancelGeneration != StartCancelGeneration)
+		{
+			//The wake-up may be the one LockAll or another waiter is waiting for
+			if(bWoken)
+			{
+				ContextReleasedEvent->Trigger();
+			}
+			return INDEX_NONE;
+		}
+		const int32 SlotIndex = AcquireFreeSlot_priv();
+		if(SlotIndex != INDEX_NONE)
+		{
+			//Releases that happen before waiters run merge into one wake-up, so pass it on while there is a context for another waiter
+			if(HasFreeSharedSlot_priv())
+			{
+				ContextReleasedEvent->Trigger();
+			}
+			return SlotIndex;
+		}
+	}
+}
+
+int32 FPubnubContextPool::AcquireFreeSlot_priv()
+{
+	if(BoundPool == this && Slots.IsValidIndex(BoundSlotIndex))
+	{
+		FContextSlot& Slot = Slots[BoundSlotIndex];
+		if(!Slot.bInUse && Slot.Context)
+		{
+			ApplyAuthToken(Slot);
+			Slot.bInUse = true;
+			return BoundSlotIndex;
+		}
+	}
+
+	//Always start from the first slot, so the most recently used (warm) connections are reused first
+	for(int32 i = 0; i < SharedPoolSize; i++)
+	{
+		FContextSlot& Slot = Slots[i];
+		//Context is null when contexts were not allocated yet or were already freed
+		if(Slot.bInUse || !Slot.Context)
+		{
+			continue;
+		}
+		ApplyAuthToken(Slot);
+		Slot.bInUse = true;
+		return i;
+	}
+	return INDEX_NONE;
+}
+
+bool FPubnubContextPool::HasFreeSharedSlot_priv() const
+{
+	for(int32 i = 0; i < SharedPoolSize; i++)
+	{
+		if(!Slots[i].bInUse && Slots[i].Context)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FPubnubContextPool::Release(int32 SlotIndex)
+{
+	{
+		FScopeLock PoolLock(&PoolMutex);
+		if(!Slots.IsValidIndex(SlotIndex))
+		{
+			return;
+		}
+		//Token published while the operation was running. Switch now, so the old one can be freed before the next checkout
+		ApplyAuthToken(Slots[SlotIndex]);
+		Slots[SlotIndex].bInUse = false;
+	}
+	ContextReleasedEvent->Trigger();
+}
+
+void FPubnubContextPool::LockAll()
+{
+	ExclusiveMutex.Lock();
+	{
+		FScopeLock PoolLock(&PoolMutex);
+		LockCount++;
+	}
+
+	//New checkouts are blocked now, wait until all in-flight operations return their contexts
+	while(true)
+	{
+		{
+			FScopeLock PoolLock(&PoolMutex);
+			if(!Slots.ContainsByPredicate([](const FContextSlot& Slot){ return Slot.bInUse; }))
+			{
+				return;
+			}
+		}
+		ContextReleasedEvent->Wait();
+	}
+}
+
+void FPubnubContextPool::UnlockAll()
+{
+	{
+		FScopeLock PoolLock(&PoolMutex);
+		LockCount--;
+	}
+	ExclusiveMutex.Unlock();
+}
+
+void FPubnubContextPool::BindReservedContextToCurrentThread(int32 ReservedIndex)
+{
+	const int32 SlotIndex = SharedPoolSize + ReservedIndex;
+	if(ReservedIndex == INDEX_NONE || !Slots.IsValidIndex(SlotIndex))
+	{
+		BoundPool = nullptr;
+		BoundSlotIndex = INDEX_NONE;
+		return;
+	}
+
+	BoundPool = this;
+	BoundSlotIndex = SlotIndex;
+}
+
+void FPubnubContextPool::PublishAuthToken(const char* InAuthToken, uint64 Generation)
+{
+	FScopeLock PoolLock(&PoolMutex);
+	AuthToken = InAuthToken;
+	AuthTokenGeneration = Generation;
+
+	//Exclusive lock holder may be freeing the contexts. Slots that are skipped here get the token on their next checkout
+	if(LockCount > 0)
+	{
+		return;
+	}
+
+	for(FContextSlot& Slot : Slots)
+	{
+		if(!Slot.bInUse)
+		{
+			ApplyAuthToken(Slot);
+		}
+	}
+}
+
+uint64 FPubnubContextPool::GetOldestAuthTokenGeneration()
+{
+	FScopeLock PoolLock(&PoolMutex);
+	uint64 OldestGeneration = AuthTokenGeneration;
+	for(const FContextSlot& Slot : Slots)
+	{
+		if(Slot.Context)
+		{
+			OldestGeneration = FMath::Min(OldestGeneration, Slot.AuthTokenGeneration);
+		}
+	}
+	return OldestGeneration;
+}
+
+void FPubnubContextPool::ApplyAuthToken(FContextSlot& Slot)
+{
+	if(!Slot.Context || Slot.AuthTokenGeneration == AuthTokenGeneration)
+	{
+		return;
+	}
+
+	pubnub_set_auth_token(Slot.Context, AuthToken);
+	Slot.AuthTokenGeneration = AuthTokenGeneration;
+}
+
+void FPubnubContextPool::ForEachContext(TFunctionRef<void(pubnub_t*)> Function) const
+{
+	//Context pointers only change in AllocateContexts/FreeContexts, so they can be read without PoolMutex
+	for(const FContextSlot& Slot : Slots)
+	{
+		if(Slot.Context)
+		{
+			Function(Slot.Context);
+		}
+	}
+}
+
+void FPubnubContextPool::RecordRequest(pubnub_t* Context)
+{
+	if(!Context)
+	{
+		return;
+	}
+
+	RequestsSent.fetch_add(1, std::memory_order_relaxed);
+	//Connection closed by the server while idle keeps its socket until the next request, so such reconnect is counted as reuse
+	if(!HasOpenConnection(Context))
+	{
+		ConnectionsOpened.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+FPubnubConnectionStats FPubnubContextPool::GetConnectionStats() const
+{
+	FPubnubConnectionStats Stats;
+	Stats.RequestsSent = RequestsSent.load(std::memory_order_relaxed);
+	Stats.ConnectionsOpened = ConnectionsOpened.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FPubnubContextPool::ResetConnectionStats()
+{
+	RequestsSent.store(0, std::memory_order_relaxed);
+	ConnectionsOpened.store(0, std::memory_order_relaxed);
+}
+
+pubnub_t* FPubnubContextPool::GetContext(int32 SlotIndex) const
+{
+	return Slots.IsValidIndex(SlotIndex) ? Slots[SlotIndex].Context : nullptr;
+}
@@ -2,78 +2,235 @@
 
 
 #include "Threads/PubnubFunctionThread.h"
-#include "PubnubSubsystem.h"
-#if PLATFORM_WINDOWS
-#include "Windows/WindowsPlatformProcess.h"
-#elif PLATFORM_MAC
-#include "Mac/MacPlatformProcess.h"
-#elif PLATFORM_ANDROID
-#include "Android/AndroidPlatformProcess.h"
-#elif PLATFORM_IOS
-#include "Ios/IosPlatformProcess.h"
-#elif PLATFORM_LINUX
-#include "Linux/LinuxPlatformProcess.h"
-#else
-#error "Platform not supported"
-#endif
-
-
-bool FPubnubFunctionThread::Init()
+#include "Threads/PubnubContextPool.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+
+FPubnubFunctionThread::FWorker::FWorker(FPubnubFunctionThread* InDispatcher, int32 InWorkerIndex)
+	: Dispatcher(InDispatcher)
+	, WorkerIndex(InWorkerIndex)
 {
-	return true;
+	WakeUpEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FPubnubFunctionThread::FWorker::~FWorker()
+{
+	FPlatformProcess::ReturnSynchEventToPool(WakeUpEvent);
+	WakeUpEvent = nullptr;
+}
+
+uint32 FPubnubFunctionThread::FWorker::Run()
+{
+	Dispatcher->RunWorker(*this);
+	return 0;
+}
+
+void FPubnubFunctionThread::FWorker::Stop()
+{
+	WakeUpEvent->Trigger();
+}
+
+FPubnubFunctionThread::FPubnubFunctionThread(int32 InWorkerCount, FPubnubContextPool* InContextPool)
+	: ContextPool(InContextPool)
+{
+	const int32 WorkerCount = FMath::Max(1, InWorkerCount);
+	Workers.Reserve(WorkerCount);
+	for(int32 i = 0; i < WorkerCount; i++)
+	{
+		Workers.Add(MakeUnique<FWorker>(this, i));
+	}
+	for(int32& ClassMaxConcurrency : MaxConcurrency)
+	{
+		ClassMaxConcurrency = WorkerCount;
+	}
+
+	//Create threads only after all workers exist, so a running worker never sees partially filled Workers array
+	for(const TUniquePtr<FWorker>& Worker : Workers)
+	{
+		Worker->Thread = FRunnableThread::Create(Worker.Get(), *FString::Printf(TEXT("PubnubThread_%d"), Worker->WorkerIndex));
+	}
+}
+
+FPubnubFunctionThread::~FPubnubFunctionThread()
+{
+	Stop();
+
+	for(const TUniquePtr<FWorker>& Worker : Workers)
+	{
+		if(Worker->Thread)
+		{
+			//Waits until the worker finishes the function it's currently executing
+			Worker->Thread->Kill(true);
+			delete Worker->Thread;
+			Worker->Thread = nullptr;
+		}
+	}
+	Workers.Empty();
+}
+
+void FPubnubFunctionThread::Stop()
+{
+	FScopeLock QueueLock(&QueueMutex);
+	bShutdown = true;
+	IdleWorkers.Empty();
+	for(const TUniquePtr<FWorker>& Worker : Workers)
+	{
+		Worker->WakeUpEvent->Trigger();
+	}
+}
+
+void FPubnubFunctionThread::AddFunctionToQueue(TFunction<void()> InFunction, EPubnubOperationClass OperationClass)
+{
+	check(OperationClass < EPubnubOperationClass::Count);
+
+	FScopeLock QueueLock(&QueueMutex);
+	if(bShutdown)
+	{
+		return;
+	}
+
+	FQueuedFunction QueuedFunction;
+	QueuedFunction.Function = MoveTemp(InFunction);
+	QueuedFunction.Sequence = NextSequence++;
+	Queues[static_cast<int32>(OperationClass)].Enqueue(MoveTemp(QueuedFunction));
+	WakeUpIdleWorker_Locked();
+}
+
+void FPubnubFunctionThread::SetMaxConcurrency(EPubnubOperationClass OperationClass, int32 MaxConcurrent)
+{
+	check(OperationClass < EPubnubOperationClass::Count);
+
+	FScopeLock QueueLock(&QueueMutex);
+	MaxConcurrency[static_cast<int32>(OperationClass)] = MaxConcurrent > 0 ? FMath::Min(MaxConcurrent, Workers.Num()) : Workers.Num();
+
+	//Raised cap may let queued functions of this class start right away
+	WakeUpIdleWorker_Locked();
+}
+
+int32 FPubnubFunctionThread::GetMaxConcurrency(EPubnubOperationClass OperationClass)
+{
+	check(OperationClass < EPubnubOperationClass::Count);
+
+	FScopeLock QueueLock(&QueueMutex);
+	return MaxConcurrency[static_cast<int32>(OperationClass)];
 }
 
-uint32 FPubnubFunctionThread::Run()
+void FPubnubFunctionThread::RunWorker(FWorker& Worker)
 {
-	while(!bShutdown)
+	//Operations executed by this worker use its own context, so they never compete with Sync calls for the shared ones
+	if(ContextPool)
 	{
-		TArray<TFunction<void()>> FunctionsToExecute;
+		ContextPool->BindReservedContextToCurrentThread(Worker.WorkerIndex);
+	}
+
+	while(true)
+	{
+		FQueuedFunction QueuedFunction;
+		EPubnubOperationClass OperationClass = EPubnubOperationClass::General;
 		{
 			FScopeLock QueueLock(&QueueMutex);
-			if(PubnubAsyncFunctionsQueue.IsEmpty() && !PubnubAsyncFunctionsBuffer.IsEmpty())
+			if(bShutdown)
 			{
-				PubnubAsyncFunctionsQueue = MoveTemp(PubnubAsyncFunctionsBuffer);
+				break;
 			}
 
-			if(!PubnubAsyncFunctionsQueue.IsEmpty())
+			if(!TryDequeue_Locked(QueuedFunction, OperationClass))
 			{
-				FunctionsToExecute = MoveTemp(PubnubAsyncFunctionsQueue);
+				//Nothing this worker can run right now - sleep until new function is queued or another one finishes
+				IdleWorkers.Add(&Worker);
+				QueueLock.Unlock();
+				Worker.WakeUpEvent->Wait();
+				continue;
 			}
+
+			RunningCount[static_cast<int32>(OperationClass)]++;
+			TotalRunningCount++;
+
+			//There may be more work that can run in parallel, pass it to another worker
+			WakeUpIdleWorker_Locked();
 		}
 
-		if(!FunctionsToExecute.IsEmpty())
+		QueuedFunction.Function();
+
 		{
-			//Run all functions from the queue
-			for(int i = 0; i < FunctionsToExecute.Num(); i++)
-			{
-				FunctionsToExecute[i]();
+			FScopeLock QueueLock(&QueueMutex);
+			RunningCount[static_cast<int32>(OperationClass)]--;
+			TotalRunningCount--;
 
-				//Stop executing functions if thread was set to Shutdown
-				if(bShutdown)
-				{
-					break;
-				}
-			}
+			//Finished function might have been blocking the rest of its class or StateChange barrier
+			WakeUpIdleWorker_Locked();
 		}
-		
-		FPlatformProcess::Sleep(QueueLoopDelay);
 	}
-	return 0;
-}
 
-void FPubnubFunctionThread::Exit()
-{
+	if(ContextPool)
+	{
+		ContextPool->BindReservedContextToCurrentThread(INDEX_NONE);
+	}
 }
 
-void FPubnubFunctionThread::Stop()
+bool FPubnubFunctionThread::TryDequeue_Locked(FQueuedFunction& OutFunction, EPubnubOperationClass& OutClass)
 {
-	bShutdown = true;
+	const int32 StateChangeIndex = static_cast<int32>(EPubnubOperationClass::StateChange);
+
+	//Nothing else can run while StateChange function is executing
+	if(RunningCount[StateChangeIndex] > 0)
+	{
+		return false;
+	}
+
+	//Functions queued after the oldest StateChange have to wait until it's done
+	uint64 BarrierSequence = MAX_uint64;
+	if(const FQueuedFunction* Barrier = Queues[StateChangeIndex].Peek())
+	{
+		BarrierSequence = Barrier->Sequence;
+	}
+
+	//Pick the oldest function of a class that didn't reach its concurrency cap - keeps global FIFO order as much as possible
+	int32 BestClass = INDEX_NONE;
+	uint64 BestSequence = MAX_uint64;
+	bool bOlderFunctionQueued = false;
+	for(int32 ClassIndex = 0; ClassIndex < StateChangeIndex; ClassIndex++)
+	{
+		const FQueuedFunction* Head = Queues[ClassIndex].Peek();
+		if(!Head || Head->Sequence > BarrierSequence)
+		{
+			continue;
+		}
+
+		bOlderFunctionQueued = true;
+		if(RunningCount[ClassIndex] >= MaxConcurrency[ClassIndex])
+		{
+			continue;
+		}
+
+		if(Head->Sequence < BestSequence)
+		{
+			BestSequence = Head->Sequence;
+			BestClass = ClassIndex;
+		}
+	}
+
+	//StateChange runs alone, once everything queued before it has finished
+	if(BestClass == INDEX_NONE && BarrierSequence != MAX_uint64 && !bOlderFunctionQueued && TotalRunningCount == 0)
+	{
+		BestClass = StateChangeIndex;
+	}
+
+	if(BestClass == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Queues[BestClass].Dequeue(OutFunction);
+	OutClass = static_cast<EPubnubOperationClass>(BestClass);
+	return true;
 }
 
-void FPubnubFunctionThread::AddFunctionToQueue(TFunction<void()> InFunction)
+void FPubnubFunctionThread::WakeUpIdleWorker_Locked()
 {
-	//Add function to buffer firstly, it will be added to queue after current queue is done
-	//Lock this array for other threads, so it can be added safely
-	FScopeLock QueueLock(&QueueMutex);
-	PubnubAsyncFunctionsBuffer.Add(InFunction);
+	if(!IdleWorkers.IsEmpty())
+	{
+		IdleWorkers.Pop()->WakeUpEvent->Trigger();
+	}
 }
@@ -0,0 +1,114 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PubnubEnumLibrary.h"
+#include "PubnubKeyFuncs.h"
+
+class FRegexPattern;
+
+/**
+ * Compact form of a parsed PAM v3 token: expiration data, authorized user and permission bitmasks
+ * of every resource and pattern, grouped by resource type.
+ *
+ * Created once from pubnub_parse_token output (FromParsedTokenJson). Permission checks only look up
+ * maps and match precompiled patterns, they don't touch JSON. Immutable after creation, so it can be shared between threads.
+ */
+struct PUBNUBLIBRARY_API FPubnubParsedToken
+{
+	//Number of EPubnubTokenResourceType values
+	static constexpr int32 ResourceTypeCount = 3;
+
+	/**
+	 * Resource pattern of the token. PAM patterns are regular expressions, but most of them are
+	 * a literal prefix ("^name-.*"), so these are compared as strings and only the rest goes through the regex engine.
+	 */
+	struct FPattern
+	{
+		enum class EMatchType : uint8
+		{
+			Exact,
+			Prefix,
+			Contains,
+			Regex
+		};
+
+		FString Pattern;
+		//Pattern without anchors and wildcard, for all match types but Regex
+		FString Literal;
+		TSharedPtr<FRegexPattern, ESPMode::ThreadSafe> Regex;
+		EMatchType MatchType = EMatchType::Regex;
+		uint8 Bitmask = 0;
+
+		bool Matches(const FString& ResourceID) const;
+	};
+
+	int32 Version = 0;
+	//Unix time (seconds) when the token was issued
+	int64 Timestamp = 0;
+	//Token lifetime in minutes
+	int32 TTL = 0;
+	FString AuthorizedUser;
+
+	//Resource names are case-sensitive
+	using FResourcesMap = TMap<FString, uint8, FDefaultSetAllocator, TPubnubCaseSensitiveKeyFuncs<FString, uint8>>;
+
+	FResourcesMap Resources[ResourceTypeCount];
+	TArray<FPattern> Patterns[ResourceTypeCount];
+
+	//Parses JSON returned by pubnub_parse_token. Returns nullptr if it's not a valid parsed token
+	static TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> FromParsedTokenJson(const FString& ParsedTokenJson);
+
+	//Permissions granted to given resource - its own bitmask combined with bitmasks of all matching patterns
+	uint8 GetPermissionsBitmask(EPubnubTokenResourceType ResourceType, const FString& ResourceID) const;
+
+	bool HasPermission(EPubnubTokenResourceType ResourceType, const FString& ResourceID, EPubnubTokenPermission Permission) const;
+
+	//Unix time (seconds) after which the token is not valid anymore
+	int64 GetExpirationTime() const { return Timestamp + static_cast<int64>(TTL) * 60; }
+	bool IsExpired(int64 UnixTimeNow) const { return UnixTimeNow >= GetExpirationTime(); }
+};
+
+/**
+ * Thread-safe cache of parsed PAM tokens, keyed by 64-bit hash of the token.
+ *
+ * Lookups only take a read lock, so many threads can check permissions at once. Full token is kept next to
+ * the parsed one, so a hash collision is a cache miss and never returns permissions of another token.
+ * When the cache is full, expired tokens are dropped first and then any other token to make room.
+ */
+class PUBNUBLIBRARY_API FPubnubTokenCache
+{
+public:
+
+	explicit FPubnubTokenCache(int32 InCapacity);
+
+	FPubnubTokenCache(const FPubnubTokenCache&) = delete;
+	FPubnubTokenCache& operator=(const FPubnubTokenCache&) = delete;
+
+	//Returns parsed token if it's in the cache, nullptr otherwise
+	TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> Find(const FString& Token) const;
+
+	//Adds parsed token to the cache. If the same token was added by another thread in the meantime, that one is kept and returned
+	TSharedRef<const FPubnubParsedToken, ESPMode::ThreadSafe> Add(const FString& Token, TSharedRef<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken);
+
+	void Empty();
+	int32 Num() const;
+
+	static uint64 HashToken(const FString& Token);
+
+private:
+
+	struct FEntry
+	{
+		FString Token;
+		TSharedRef<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken;
+	};
+
+	//Makes room for a new entry. Caller has to hold the write lock
+	void EvictEntries_priv();
+
+	mutable FRWLock Lock;
+	TMap<uint64, FEntry> Entries;
+	int32 Capacity = 0;
+};
@@ -26,7 +26,7 @@ struct FPubnubEncryptedDataInternal
  * Features:
  * - AES encryption with 256-bit keys
  * - Random IV generation for each encryption operation
- * - SHA-256 key hashing for enhanced security
+ * - SHA-256 key hashing for enhanced security (hash is computed once per key, not per message)
  * - Blueprint-compatible interface for Unreal Engine projects
  * 
  * Usage:
@@ -46,7 +46,7 @@ public:
 
 	/** Sets the cipher key. It's required to SetCipherKey before any encryption/decryption operations. */
 	UFUNCTION(BlueprintCallable, Category = "PubNub|Crypto")
-	void SetCipherKey(const FString& NewCipherKey) { CipherKey = NewCipherKey; }
+	void SetCipherKey(const FString& NewCipherKey);
 
 	/** Returns the current cipher key. */
 	UFUNCTION(BlueprintCallable, Category = "PubNub|Crypto")
@@ -62,17 +62,29 @@ private:
 	virtual TArray<uint8> GetIdentifier_Implementation() override;
 	virtual FPubnubEncryptedData Encrypt_Implementation(const FString& Data) override;
 	virtual FString Decrypt_Implementation(const FPubnubEncryptedData& Data) override;
+	virtual bool EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata) override;
+	virtual bool DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData) override;
+	virtual bool IsThreadSafe() const override { return true; }
 
 	//Constants
 	static constexpr int32 AesBlockSize = 16;
 	static constexpr int32 AesIvSize    = 16;
 	static constexpr int32 Sha256Len    = 32;
 
-	static bool EncryptData(const FString& CipherKey, const TArray<uint8>& DataToEncrypt, FPubnubEncryptedDataInternal& OutResult);
-	static bool DecryptData(const FString& CipherKey, const FPubnubEncryptedDataInternal& EncryptedData, TArray<uint8>& OutResult);
+	static bool EncryptData(const uint8* InKeyHash, uint64 InKeyGeneration, TConstArrayView<uint8> DataToEncrypt, TArray<uint8>& OutData, TArray<uint8>& OutMetadata);
+	static bool DecryptData(const uint8* InKeyHash, uint64 InKeyGeneration, TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutResult);
 	
 	static void GenerateRandomIV(uint8* IV, int32 Size);
 	static bool HashKeySHA256(const FString& Key, uint8* OutHash);
+
+	//Copies hashed CipherKey and its generation. Hashes CipherKey first if SetCipherKey wasn't used to set it
+	bool GetKeyHash(uint8* OutKeyHash, uint64& OutKeyGeneration);
+
+	//SHA-256 of CipherKey, computed in SetCipherKey so encryption/decryption doesn't hash the key for every message
+	uint8 KeyHash[Sha256Len] = {};
+	//Identifies KeyHash in the per-thread cipher contexts, 0 if KeyHash wasn't computed yet
+	uint64 KeyGeneration = 0;
+	FRWLock KeyHashLock;
     
 	// Data conversion helpers
 	FPubnubEncryptedData ConvertToInterface(const FPubnubEncryptedDataInternal& InternalData);
@@ -78,12 +78,38 @@ private:
 	//IPubnubCryptoProviderInterface
 	virtual FString ProviderEncrypt_Implementation(const FString& Data) override;
 	virtual FString ProviderDecrypt_Implementation(const FString& Data) override;
+	virtual bool ProviderEncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData) override;
+	virtual bool ProviderDecryptBytes(TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData) override;
+	//Thread safe when all of the cryptors are native and thread safe
+	virtual bool IsThreadSafe() const override;
 
 	//Cryptors provided during Init
     UPROPERTY()
     TScriptInterface<IPubnubCryptorInterface> DefaultCryptor;
     UPROPERTY()
     TArray<TScriptInterface<IPubnubCryptorInterface>> AdditionalCryptors;
+
+	//Cryptor with its identifier resolved in InitCryptoModule, so routing a message is an integer compare instead of GetIdentifier calls
+	struct FResolvedCryptor
+	{
+		uint32 Id = 0;
+		//Kept alive by DefaultCryptor/AdditionalCryptors
+		UObject* Object = nullptr;
+		//Set only for native classes, Blueprint cryptors are called through their events
+		IPubnubCryptorInterface* NativeInterface = nullptr;
+
+		bool EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata) const;
+		bool DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData) const;
+	};
+
+	//Default cryptor used for encryption. Its Id is all zeros (legacy) if the cryptor returned less than 4 bytes
+	FResolvedCryptor ResolvedDefaultCryptor;
+	//Cryptors available for decryption, in lookup priority order (default first). Identifiers are unique
+	TArray<FResolvedCryptor> CryptorsById;
+
+	void ResolveCryptors();
+	static uint32 PackIdentifier(const uint8 Ident[4]);
+	static FResolvedCryptor ResolveCryptor(const TScriptInterface<IPubnubCryptorInterface>& Cryptor, bool& bOutHasValidId);
 	
 	
     // Utilities for header format compatible with C-Core provider
@@ -92,9 +118,9 @@ private:
     size_t WriteHeader(uint8* dst, size_t headerSize, const uint8 ident[4], size_t metadataSize);
     bool ParseHeader(const uint8* buf, size_t bufSize, uint8 outIdent[4], size_t& outHeaderSize, size_t& outMetaSize, size_t& outMetaOffset);
 	
-	bool ProviderEncrypt_Internal(UPubnubCryptoModule* Self, const TArray<uint8>& PlainUTF8, TArray<uint8>& OutHeaderPlusCipher);
-	bool ProviderDecrypt_Internal(UPubnubCryptoModule* Self, const TArray<uint8>& InHeaderPlusCipher, TArray<uint8>& OutPlainUTF8);
+	bool ProviderEncrypt_Internal(UPubnubCryptoModule* Self, TConstArrayView<uint8> PlainUTF8, TArray<uint8>& OutHeaderPlusCipher);
+	bool ProviderDecrypt_Internal(UPubnubCryptoModule* Self, TConstArrayView<uint8> InHeaderPlusCipher, TArray<uint8>& OutPlainUTF8);
 	
-    // Select Unreal cryptor by 4-byte identifier. Returns null interface if not found
-    TScriptInterface<IPubnubCryptorInterface> FindUECryptorById(const uint8 ident[4]) const;
+    // Select Unreal cryptor by 4-byte identifier. Returns nullptr if not found
+    const FResolvedCryptor* FindUECryptorById(const uint8 ident[4]) const;
 };
@@ -76,6 +76,34 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category="Pubnub|Crypto")
 	FString Decrypt(const FPubnubEncryptedData& Data);
+
+	/** Native byte API used by the crypto module, so C-Core data doesn't have to go through Base64 and FString.
+	 *
+	 * - Data: plaintext bytes (UTF-8)
+	 * - OutEncryptedData/OutMetadata: caller owned buffers, overwritten with raw (not Base64) ciphertext and metadata.
+	 *   Callers can reuse them between calls to avoid allocations.
+	 * - Returns false on failure.
+	 *
+	 * Default implementation is a wrapper around Encrypt, so C++ cryptors only have to override it for performance.
+	 * Blueprint cryptors are always called through Encrypt/Decrypt.
+	 */
+	virtual bool EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata);
+
+	/** Reverses EncryptBytes. EncryptedData and Metadata are raw bytes, OutData is overwritten with decrypted plaintext bytes.
+	 * Returns false on failure. Default implementation is a wrapper around Decrypt.
+	 */
+	virtual bool DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData);
+
+	/** Returns true if EncryptBytes/DecryptBytes can be called from many threads at once.
+	 * Only then the SDK decrypts in parallel (e.g. FetchHistory pages). Blueprint cryptors are never called concurrently.
+	 */
+	virtual bool IsThreadSafe() const { return false; }
+
+	/** Calls EncryptBytes on native cryptors and the Blueprint Encrypt event on the others. */
+	static bool EncryptBytes(UObject* Cryptor, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata);
+
+	/** Calls DecryptBytes on native cryptors and the Blueprint Decrypt event on the others. */
+	static bool DecryptBytes(UObject* Cryptor, TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData);
 };
 
 
@@ -145,4 +173,29 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category="Pubnub|Crypto")
 	FString ProviderDecrypt(const FString& Data);
+
+	/**
+	 * Native byte API used by the C-Core bridge. Data is plaintext bytes (UTF-8), OutEncryptedData is a caller owned buffer
+	 * that is overwritten with the complete encrypted payload (raw bytes, not Base64). Returns false on failure.
+	 * Default implementation is a wrapper around ProviderEncrypt.
+	 */
+	virtual bool ProviderEncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData);
+
+	/**
+	 * Reverses ProviderEncryptBytes. OutData is a caller owned buffer that is overwritten with decrypted plaintext bytes.
+	 * Returns false on failure. Default implementation is a wrapper around ProviderDecrypt.
+	 */
+	virtual bool ProviderDecryptBytes(TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData);
+
+	/** Returns true if ProviderEncryptBytes/ProviderDecryptBytes can be called from many threads at once. */
+	virtual bool IsThreadSafe() const { return false; }
+
+	/** Returns true only for native providers that report IsThreadSafe. */
+	static bool IsThreadSafe(UObject* Provider);
+
+	/** Calls ProviderEncryptBytes on native providers and the Blueprint ProviderEncrypt event on the others. */
+	static bool ProviderEncryptBytes(UObject* Provider, TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData);
+
+	/** Calls ProviderDecryptBytes on native providers and the Blueprint ProviderDecrypt event on the others. */
+	static bool ProviderDecryptBytes(UObject* Provider, TConstArrayView<uint8> EncryptedData, TArray<uint8>& OutData);
 };
\ No newline at end of file
@@ -56,7 +56,7 @@ public:
 
 	/** Sets the cipher key. It's required to SetCipherKey before any encryption/decryption operations. */
 	UFUNCTION(BlueprintCallable, Category = "PubNub|Crypto")
-	void SetCipherKey(const FString& NewCipherKey) { CipherKey = NewCipherKey; }
+	void SetCipherKey(const FString& NewCipherKey);
 
 	/** Returns the current cipher key. */
 	UFUNCTION(BlueprintCallable, Category = "PubNub|Crypto")
@@ -72,13 +72,24 @@ private:
 	virtual TArray<uint8> GetIdentifier_Implementation() override;
 	virtual FPubnubEncryptedData Encrypt_Implementation(const FString& Data) override;
 	virtual FString Decrypt_Implementation(const FPubnubEncryptedData& Data) override;
+	virtual bool EncryptBytes(TConstArrayView<uint8> Data, TArray<uint8>& OutEncryptedData, TArray<uint8>& OutMetadata) override;
+	virtual bool DecryptBytes(TConstArrayView<uint8> EncryptedData, TConstArrayView<uint8> Metadata, TArray<uint8>& OutData) override;
+	virtual bool IsThreadSafe() const override { return true; }
 
 	
-	bool EncryptDataLegacy(const TArray<uint8>& Plain, TArray<uint8>& OutCipher);
-	bool DecryptDataLegacy(const TArray<uint8>& Cipher, TArray<uint8>& OutPlain);
+	bool EncryptDataLegacy(TConstArrayView<uint8> Plain, TArray<uint8>& OutCipher);
+	bool DecryptDataLegacy(TConstArrayView<uint8> Cipher, TArray<uint8>& OutPlain);
 	
-	void MakeLegacyKeyAsciiHex32(TArray<uint8_t>& OutKeyAsciiHex32) const;
+	static void MakeLegacyKeyAsciiHex32(const FString& Key, uint8 OutKeyAsciiHex32[32]);
+	//Copies legacy key derived from CipherKey and its generation. Derives it first if SetCipherKey wasn't used to set CipherKey
+	void GetLegacyKey(uint8 OutKey[32], uint64& OutKeyGeneration);
 	static void GetFixedIV16(uint8 OutIV[16]);
-	static bool Aes256CbcEncrypt(const TArray<uint8>& Key, const uint8* IV, const TArray<uint8>& In, TArray<uint8>& Out);
-	static bool Aes256CbcDecrypt(const TArray<uint8>& Key, const uint8* IV, const uint8* Data, int32 Len, TArray<uint8>& Out);
+	static bool Aes256CbcEncrypt(const uint8* Key, uint64 InKeyGeneration, const uint8* IV, TConstArrayView<uint8> In, TArray<uint8>& Out);
+	static bool Aes256CbcDecrypt(const uint8* Key, uint64 InKeyGeneration, const uint8* IV, const uint8* Data, int32 Len, TArray<uint8>& Out);
+
+	//ASCII-hex key derived from CipherKey in SetCipherKey, so it's not hashed again for every message
+	uint8 LegacyKey[32] = {};
+	//Identifies LegacyKey in the per-thread cipher contexts, 0 if LegacyKey wasn't derived yet
+	uint64 KeyGeneration = 0;
+	FRWLock LegacyKeyLock;
 };
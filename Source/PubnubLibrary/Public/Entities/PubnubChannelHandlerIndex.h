@@ -0,0 +1,51 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PubnubKeyFuncs.h"
+
+/**
+ * Index of channel handlers bound with UPubnubClient::BindChannelHandler, keyed by channel name.
+ *
+ * Handler is bound either to an exact channel name or to a wildcard prefix ("game.*" matches every channel starting with "game.").
+ * Finding handlers of a channel is one hash lookup for exact names and one per distinct prefix length for wildcards,
+ * so it doesn't depend on how many handlers are bound to other channels. Not thread-safe, the client uses it on the game thread.
+ */
+class PUBNUBLIBRARY_API FPubnubChannelHandlerIndex
+{
+public:
+
+	using FHandlerIDArray = TArray<int32, TInlineAllocator<8>>;
+
+	//Adds handler for given channel. Channel ending with '*' is a wildcard prefix. Returns false if the channel is empty
+	bool Add(int32 HandlerID, const FString& Channel);
+
+	//Removes handler added with Add. Returns false if there is no such handler
+	bool Remove(int32 HandlerID);
+
+	//Appends IDs of all handlers matching given channel: exact ones first, then wildcards from the longest prefix
+	void FindHandlers(FStringView Channel, FHandlerIDArray& OutHandlerIDs) const;
+
+	void Empty();
+	int32 Num() const { return HandlerChannels.Num(); }
+
+	//Returns true if the channel is a wildcard and gives its prefix ("game.*" -> "game.")
+	static bool GetWildcardPrefix(const FString& Channel, FString& OutPrefix);
+
+private:
+
+	using FHandlersMap = TMap<FString, FHandlerIDArray, FDefaultSetAllocator, TPubnubCaseSensitiveKeyFuncs<FString, FHandlerIDArray>>;
+
+	struct FHandlerChannel
+	{
+		FString Key;
+		bool bIsWildcard = false;
+	};
+
+	FHandlersMap ExactHandlers;
+	FHandlersMap PrefixHandlers;
+	//Number of wildcard prefixes of every length, kept sorted from the longest
+	TArray<TPair<int32, int32>> PrefixLengths;
+	TMap<int32, FHandlerChannel> HandlerChannels;
+};
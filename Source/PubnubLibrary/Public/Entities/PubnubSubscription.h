@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "PubnubClient.h"
 #include "PubnubStructLibrary.h"
+#include "PubnubNativeMessage.h"
 #include "PubnubSubscription.generated.h"
 
 
@@ -39,6 +40,8 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubMessageActionNative, const FPubnubM
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubAnyMessageType, FPubnubMessageData, Message);
 // Native C++ delegate that fires for any type of PubNub message/event (can accept lambdas)
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubAnyMessageTypeNative, const FPubnubMessageData& Message);
+// Native C++ delegate that fires for any type of PubNub message/event with its compact form, ListenerType tells which type it is
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubNativeMessage, const FPubnubNativeMessage& Message, EPubnubListenerType ListenerType);
 
 
 /**
@@ -55,6 +58,7 @@ class PUBNUBLIBRARY_API UPubnubSubscriptionBase : public UObject
 	GENERATED_BODY()
 	
 	friend class UPubnubBaseEntity;
+	friend class UPubnubClient;
 	
 public:
 
@@ -94,6 +98,13 @@ public:
 	/** Native C++ version of FOnPubnubAnyMessageType that can accept lambda functions. */
 	FOnPubnubAnyMessageTypeNative FOnPubnubAnyMessageTypeNative;
 
+	/**
+	 * Fires first for any type of message or event received, with the compact native message.
+	 * The other delegates get FPubnubMessageData, which is built only when at least one of them is bound,
+	 * so binding only this one keeps message delivery free of string allocations.
+	 */
+	FOnPubnubNativeMessage OnPubnubNativeMessage;
+
 	/**
 	 * Called when this subscription object is being destroyed.
 	 * 
@@ -102,6 +113,27 @@ public:
 	 */
 	virtual void BeginDestroy() override;
 
+	/**
+	 * Sets server-side filter expression used when this object is subscribed, e.g. "region == 'eu'".
+	 * Only messages whose meta matches the expression are sent to the client. Empty keeps the client's current filter expression.
+	 * 
+	 * @Note There is one filter expression per client subscribe loop - subscribing with this object changes it
+	 * for all subscriptions of the client. Change made while subscribed applies the next time this object is subscribed.
+	 * To change it right away use UPubnubClient::SetSubscribeFilterExpression.
+	 * 
+	 * @param InFilterExpression Filter expression to use.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub|Subscription")
+	void SetFilterExpression(FString InFilterExpression) { FilterExpression = InFilterExpression; }
+
+	/**
+	 * Gets server-side filter expression used when this object is subscribed.
+	 * 
+	 * @return Filter expression, empty if this object doesn't set any.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub|Subscription")
+	FString GetFilterExpression() const { return FilterExpression; }
+
 protected:
 
 	/** Opaque heap block passed to C-Core as listener user_data; holds internal routing state for native callbacks. Freed when the subscription is cleaned up. */
@@ -111,7 +143,23 @@ protected:
 	TObjectPtr<UPubnubClient> PubnubClient = nullptr;
 
 	bool IsInitialized = false;
+	//Filter expression applied to the client subscribe loop when this object is subscribed. Empty keeps the current one
+	FString FilterExpression = "";
+	//Matches generation of messages queued by this object's listeners. Changes when the object is reused from the client's pool
+	uint32 ListenerGeneration = 0;
 	virtual void CleanUpSubscription(){};
+
+	void ClearDelegates();
+
+	/**
+	 * Broadcasts a message received by the C-Core listener of given type to the matching delegates.
+	 * Called on the game thread by the client when it delivers queued messages.
+	 * Presence events come through the message listener, bIsPresenceEvent of the message tells them apart.
+	 */
+	void BroadcastReceivedMessage(const FPubnubNativeMessage& NativeMessage, EPubnubListenerType ListenerType);
+
+	//True if any delegate that takes FPubnubMessageData would get a message of given type
+	bool IsMessageDataDelegateBound(EPubnubListenerType ListenerType, bool bIsPresenceEvent) const;
 	
 };
 
@@ -212,11 +260,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Pubnub|Subscription")
 	UPubnubSubscriptionSet* AddSubscription(UPubnubSubscription* Subscription);
 
+	/**
+	 * Releases this subscription when it's not needed anymore, e.g. when a player leaves a proximity channel.
+	 * 
+	 * Removes all bound delegates and unsubscribes if needed. Then the subscription goes back to the client's pool,
+	 * so the next CreateSubscription for the same entity reuses it instead of creating new objects.
+	 * If the pool is full or disabled (FPubnubConfig::SubscriptionPoolCapacity), its C-Core resources are freed right away.
+	 * 
+	 * @note Don't use this object after releasing it, it can be handed out by another CreateSubscription call.
+	 * Subscriptions that were added to a subscription set shouldn't be released.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Pubnub|Subscription")
+	void Release();
+
 private:
 
 	pubnub_subscription_t* CCoreSubscription = nullptr;
 	bool bIsSubscribed = false;
 
+	//Entity and settings this subscription was created for, used to match it when it's reused from the pool
+	FString PoolEntityID;
+	EPubnubEntityType PoolEntityType = EPubnubEntityType::PEnT_Channel;
+	bool bPoolReceivePresenceEvents = false;
+	//Only subscriptions created for an entity can be pooled
+	bool bCanBePooled = false;
+	bool bIsReleased = false;
+
+	//Gives released subscription to the client's pool, or cleans it up if the pool doesn't take it
+	void ReturnToPool();
+
 	void InitSubscription(UPubnubClient* InPubnubClient, UPubnubBaseEntity* Entity, FPubnubSubscribeSettings InSubscribeSettings);
 	void InitWithCCoreSubscription(UPubnubClient* InPubnubClient, pubnub_subscription_t* InCCoreSubscription);
 	void InternalInit();
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "PubnubStructLibrary.h"
 #include "PubnubCryptoUtilities.generated.h"
 
 
@@ -24,5 +25,14 @@ public:
 	static FString ConvertBytesToBase64(const uint8* Data, size_t Size);
 	static bool ConvertBase64ToBytes(const FString& Base64String, uint8*& OutData, size_t& OutSize);
 	static bool ConvertStringToBytes(const FString& String, uint8*& OutData, size_t& OutSize);
+	//Copies bytes into malloc'd, null terminated buffer that C-Core takes ownership of
+	static bool CopyBytesForCCore(TConstArrayView<uint8> Data, uint8*& OutData, size_t& OutSize);
+
+	/**
+	 * Decrypts history messages in place with given crypto provider. Messages that can't be decrypted are left as they are.
+	 * Thread safe native providers decrypt messages in parallel, each message is written only to its own slot,
+	 * so the result doesn't depend on scheduling.
+	 */
+	static void DecryptHistoryMessages(UObject* CryptoProvider, TArray<FPubnubHistoryMessageData>& Messages);
 
 };
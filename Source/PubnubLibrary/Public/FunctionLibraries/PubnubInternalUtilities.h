@@ -11,6 +11,7 @@
 
 
 class UPubnubClient;
+class FPubnubCCoreEntityCache;
 
 /**
  * 
@@ -28,13 +29,31 @@ public:
 	static void SetStateUESettingsToPubnubSetStateOptions(const FPubnubSetStateSettings &SetStateSettings, pubnub_set_state_options &PubnubSetStateOptions);
 	static void FetchHistoryUESettingsToPbFetchHistoryOptions(const FPubnubFetchHistorySettings &FetchHistorySettings, pubnub_fetch_history_options &PubnubFetchHistoryOptions);
 
+	//Method used to send a publish of given size. Default GET becomes POST with GZIP from CompressionThresholdBytes, negative threshold disables it
+	static EPubnubPublishMethod GetPublishMethodForMessageSize(EPubnubPublishMethod RequestedMethod, int32 MessageSizeBytes, int32 CompressionThresholdBytes);
+
+	/* RETRY POLICY */
+
+	//True for failures that may pass when tried again: network errors, timeouts and HTTP 429 or 5xx.
+	//For PRE_MessageSend only failures before the request was sent (DNS, connect) and HTTP 429 are retried, so a message is never published twice
+	static bool IsRetryableResult(EPubnubRetryEndpoint Endpoint, pubnub_res Result, int32 HttpStatus);
+	//True if the policy allows one more retry of a request to given endpoint, after RetriesDone retries
+	static bool CanRetry(const FPubnubRetryConfig& RetryConfig, EPubnubRetryEndpoint Endpoint, int32 RetriesDone);
+	//Delay before retry number RetryIndex (0 is the first retry). JitterAlpha in [0, 1] picks the part of the jitter that is added
+	static float GetRetryDelaySeconds(const FPubnubRetryConfig& RetryConfig, int32 RetryIndex, float JitterAlpha);
+
 	/** e.g. "-Pubnub-C-core/7.1.3/Unreal/2.0.2" for runtime PNSDK suffix; uses PUBNUB_C_CORE_VERSION and PUBNUB_LIBRARY_VERSION_*. */
 	static FString GetPubnubSdkVersionSuffix();
 	
 	/* C-CORE EVENT ENGINE HELPERS */
 
-	static pubnub_subscription_t* EEGetSubscriptionForEntity(pubnub_t* Context, FString EntityID, EPubnubEntityType EntityType, FPubnubSubscribeSettings Options);
+	//Returned entity has to be freed with pubnub_entity_free
+	static pubnub_entity_t* EEAllocEntity(pubnub_t* Context, const FString& EntityID, EPubnubEntityType EntityType);
+	//Entity is taken from EntityCache if it's provided, otherwise it's allocated just for this subscription
+	static pubnub_subscription_t* EEGetSubscriptionForEntity(pubnub_t* Context, FString EntityID, EPubnubEntityType EntityType, FPubnubSubscribeSettings Options, FPubnubCCoreEntityCache* EntityCache = nullptr);
 	static pubnub_subscription_set_t* EEGetSubscriptionSetForEntities(pubnub_t* Context, TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings Options);
+	//Requires at least two subscriptions. They are not consumed, they still have to be freed separately from the returned set
+	static pubnub_subscription_set_t* EEGetSubscriptionSetForSubscriptions(const TArray<pubnub_subscription_t*>& Subscriptions, FPubnubSubscribeSettings Options);
 	static bool EEAddListenerAndSubscribe(pubnub_subscription_t* Subscription, pubnub_subscribe_message_callback_t Callback, UPubnubClient* PubnubClient);
 	static bool EERemoveListenerAndUnsubscribe(pubnub_subscription_t** SubscriptionPtr, pubnub_subscribe_message_callback_t Callback, UPubnubClient* PubnubClient);
 	static bool EESubscribeWithSubscription(pubnub_subscription_t* Subscription, FPubnubSubscriptionCursor Cursor);
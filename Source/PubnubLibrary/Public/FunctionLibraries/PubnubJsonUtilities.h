@@ -10,6 +10,21 @@
 class FJsonObject;
 class FJsonValue;
 
+/**
+ * Type of the root value of a JSON payload, as detected by UPubnubJsonUtilities::ClassifyJsonPayload
+ */
+enum class EPubnubJsonPayloadType : uint8
+{
+	//Payload is not a correct JSON
+	Invalid,
+	Object,
+	Array,
+	String,
+	Number,
+	Boolean,
+	Null
+};
+
 /**
  * 
  */
@@ -31,6 +46,15 @@ public:
 	static FString SerializeString(const FString& InString);
 	//Converts serialized string into it's normal, literal form
 	static FString DeserializeString(const FString InString);
+
+	//Validates UTF-8 JSON payload in a single pass, without any allocations. Returns type of its root value or Invalid if it's not a correct JSON
+	static EPubnubJsonPayloadType ClassifyJsonPayload(const char* Data, int32 Length);
+	/**
+	 * Converts UTF-8 message payload into the message string in a single pass: objects and arrays are kept as they are,
+	 * strings are unescaped straight from the payload bytes and other simple types are returned in their literal form.
+	 * Gives the same result as IsCorrectJsonString followed by DeserializeString, but without building any Json DOM.
+	 */
+	static FString JsonPayloadToMessageString(const char* Data, int32 Length);
 	
 	//Adds Provided string as ObjectField to JsonObject. If AddNullFieldIfEmpty is set to true, null field will be added in case if empty JsonObjectString
 	static void AddObjectFieldToJson(const FString& FieldName, const FString& JsonObjectString, TSharedPtr<FJsonObject> &JsonObject, bool AddNullFieldIfEmpty = false);
@@ -76,26 +100,36 @@ public:
 	 * Converter from FetchHistory_Json response to actual types
 	 */
 	static void FetchHistoryJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubHistoryMessageData> &Messages);
+	//Reads UTF-8 response straight from the C-Core buffer. Only fields that end up in the messages are converted to FString
+	static void FetchHistoryJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubHistoryMessageData> &Messages);
 	
 	/**
 	 * Converter from GetAllUserMetadata_Json response to actual types
 	 */
 	static void GetAllUserMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubUserData> &UsersData, FPubnubPage &Page, int &TotalCount);
+	//Reads UTF-8 response in a single pass, without building Json DOM. "custom" objects are kept as they are in the response
+	static void GetAllUserMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubUserData> &UsersData, FPubnubPage &Page, int &TotalCount);
 
 	/**
 	 * Converter from GetUserMetadata_Json response to actual types
 	 */
 	static void GetUserMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, FPubnubUserData &UserData);
+	//Single pass UTF-8 overload, see GetAllUserMetadataJsonToData
+	static void GetUserMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, FPubnubUserData &UserData);
 
 	/**
 	 * Converter from GetAllChannelMetadata_Json response to actual types
 	 */
 	static void GetAllChannelMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubChannelData> &ChannelsData, FPubnubPage &Page, int &TotalCount);
+	//Single pass UTF-8 overload, see GetAllUserMetadataJsonToData
+	static void GetAllChannelMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubChannelData> &ChannelsData, FPubnubPage &Page, int &TotalCount);
 
 	/**
 	 * Converter from GetChannelMetadata_Json response to actual types
 	 */
 	static void GetChannelMetadataJsonToData(FString ResponseJson, FPubnubOperationResult& Result, FPubnubChannelData &ChannelData);
+	//Single pass UTF-8 overload, see GetAllUserMetadataJsonToData
+	static void GetChannelMetadataJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, FPubnubChannelData &ChannelData);
 
 	/**
 	 * Converter from GetMessageActions_Json response to actual types
@@ -111,11 +145,15 @@ public:
 	 * Converter from GetMemberships_Json response to actual types
 	 */
 	static void GetMembershipsJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubMembershipData> &MembershipsData, FPubnubPage &Page, int &TotalCount);
+	//Single pass UTF-8 overload, see GetAllUserMetadataJsonToData
+	static void GetMembershipsJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubMembershipData> &MembershipsData, FPubnubPage &Page, int &TotalCount);
 
 	/**
 	 * Converter from GetChannelMembers_Json response to actual types
 	 */
 	static void GetChannelMembersJsonToData(FString ResponseJson, FPubnubOperationResult& Result, TArray<FPubnubChannelMemberData> &MembershipsData, FPubnubPage &Page, int &TotalCount);
+	//Single pass UTF-8 overload, see GetAllUserMetadataJsonToData
+	static void GetChannelMembersJsonToData(const char* ResponseJson, int32 Length, FPubnubOperationResult& Result, TArray<FPubnubChannelMemberData> &MembershipsData, FPubnubPage &Page, int &TotalCount);
 
 	/**
 	 * Converter from Json string containing User data to FPubnubUserData
@@ -211,6 +249,8 @@ public:
 	 */
 	static FPubnubOperationResult GetOperationResultFromJson_AppContext(TSharedPtr<FJsonObject> JsonObject);
 	static FPubnubOperationResult GetOperationResultFromJson_AppContext(FString ResponseJson);
+	//Reads only status and error fields of UTF-8 response, everything else is skipped without conversion
+	static FPubnubOperationResult GetOperationResultFromJson_AppContext(const char* ResponseJson, int32 Length);
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Pubnub|Json Utilities")
 	static FPubnubChannelUpdateData GetChannelUpdateDataFromMessageContent(const FString& MessageContent);
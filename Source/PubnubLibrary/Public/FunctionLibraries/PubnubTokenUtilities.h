@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "PubnubEnumLibrary.h"
 #include "PubnubTokenUtilities.generated.h"
 
 class FJsonObject;
@@ -43,6 +44,9 @@ public:
 	// Helper function to calculate expected bitmask for User permissions
 	UFUNCTION(BlueprintCallable, Category="Pubnub|Token Utilities")
 	static int CalculateUserPermissionsBitmask(const FPubnubUserPermissions& Perms);
+
+	//Bit used by PAM token bitmasks for given permission. All bitmask calculations and checks use it
+	static int GetPermissionBit(EPubnubTokenPermission Permission);
 	
 private:
 	static void AddChannelPermissionsToJson(TArray<FChannelGrant> Channels, TSharedPtr<FJsonObject> JsonObject);
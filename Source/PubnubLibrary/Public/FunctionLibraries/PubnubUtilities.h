@@ -13,6 +13,8 @@
 
 class UPubnubSettings;
 class UPubnubSubscription;
+class FPubnubMessageArena;
+struct FPubnubNativeMessage;
 
 /** This struct is an utility for more convenient converting FString into const char* while keeping char memory alive
  * Will not break UTF8 characters.
@@ -31,6 +33,12 @@ struct FUTF8StringHolder
 	{
 		return Converter.Get();
 	}
+
+	//Length in bytes, without the null terminator
+	int32 Length() const
+	{
+		return Converter.Length();
+	}
 };
 
 
@@ -45,6 +53,8 @@ public:
 
 	static FPubnubConfig PubnubConfigFromPluginSettings(UPubnubSettings* PubnubSettings);
 	static FString PubnubGetLastServerHttpResponse(pubnub_t* Context);
+	//Same as PubnubGetLastServerHttpResponse, but returns UTF-8 view of the context buffer. It's valid until the next transaction on the context
+	static FAnsiStringView PubnubGetLastServerHttpResponseView(pubnub_t* Context);
 
 	//Sets limit to be between 0 and PUBNUB_MAX_LIMIT. Prevents C-Core crash on providing incorrect limit.
 	static int RoundLimitForPubnubFunctions(int ProvidedLimit);
@@ -54,6 +64,7 @@ public:
 	static FString AddQuotesToString(const FString InString, bool SkipIfHasQuotes = true);
 	static FString RemoveOuterQuotesFromString(const FString InString);
 	static FString PubnubCharMemBlockToString(const pubnub_char_mem_block PnChar);
+	static FString Utf8ViewToString(FAnsiStringView Utf8View);
 	static FString ArrayOfStringsToCommaSeparatedString(const TArray<FString> ArrayOfStrings);
 
 	/**
@@ -70,6 +81,10 @@ public:
 	static FString GetNameFromFunctionMacro(FString FunctionName);
 
 	static FPubnubMessageData UEMessageFromPubnubMessage(pubnub_v2_message PubnubMessage);
+	//Copies payload and metadata into one block of the arena and interns the names. Used by C-Core subscribe listeners
+	static FPubnubNativeMessage NativeMessageFromPubnubMessage(const pubnub_v2_message& PubnubMessage, FPubnubMessageArena& Arena);
+	//C-Core delivers presence events as published messages on "<channel>-pnpres". Checks only the end of the channel, straight in C-Core memory
+	static bool IsPresenceEventMessage(const pubnub_v2_message& PubnubMessage);
 
 	/* CONVERTING INCLUDES */
 	
@@ -0,0 +1,124 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "PubnubStructLibrary.h"
+#include "Threads/PubnubMpscRingBuffer.h"
+#include <atomic>
+
+class FEvent;
+class FRunnableThread;
+
+/**
+ * Log message as it was submitted, before it's turned into FPubnubLogMessage for loggers.
+ * UE messages keep their text, C-Core messages keep copies of their raw UTF-8 fields,
+ * so converting and formatting happens on the sink thread instead of the thread that logs.
+ */
+struct PUBNUBLIBRARY_API FPubnubLogRecord
+{
+	//Raw C-Core fields kept by the record
+	enum class ECCoreField : uint8
+	{
+		//Text, error message or URL, depending on the message type
+		Text,
+		Details,
+		Location,
+		PubnubID,
+
+		Count
+	};
+
+	EPubnubLogLevel LogLevel = EPubnubLogLevel::PLL_Info;
+	EPubnubLogSource Source = EPubnubLogSource::PLS_UE;
+	FDateTime TimestampUtc;
+	//Text of UE messages and of C-Core messages that had to be formatted right away
+	FString Message;
+	FString Callsite;
+
+	//pubnub_log_message_type of C-Core message that is formatted from raw fields, INDEX_NONE if Message is already final
+	int32 CCoreMessageType = INDEX_NONE;
+	//Error code or HTTP status of C-Core message
+	int32 CCoreCode = 0;
+
+	//Copies given UTF-8 string into the record. nullptr is kept as a missing field
+	void SetCCoreField(ECCoreField Field, const char* Utf8Value);
+	//Returns UTF-8 field of the record, empty string if it was not set
+	const char* GetCCoreField(ECCoreField Field) const;
+
+private:
+
+	//All fields one after another, each with its terminating zero, so a record needs a single allocation
+	TArray<ANSICHAR> CCoreFields;
+	int32 CCoreFieldOffsets[static_cast<int32>(ECCoreField::Count)] = {INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE};
+};
+
+/**
+ * Background log pipeline used by UPubnubLogManager when asynchronous logging is enabled.
+ *
+ * Threads that log only move the raw record into a bounded lock-free queue, so a slow logger never stalls
+ * network or game threads. A dedicated thread takes records out in batches and passes each batch to the handler.
+ * When the queue is full, Warning and Error records wait up to MaxBackpressureWaitSeconds for a free slot (backpressure)
+ * and less important ones are dropped right away. All cases are counted and reported by GetStats.
+ */
+class PUBNUBLIBRARY_API FPubnubAsyncLogSink : public FRunnable
+{
+public:
+
+	//Called on the sink thread with every batch of records taken from the queue
+	typedef TFunction<void(TArrayView<const FPubnubLogRecord>)> FBatchHandler;
+
+	//Maximum number of records passed to the handler at once
+	static constexpr int32 MaxBatchSize = 256;
+	//Longest time a Warning or Error record waits for a free slot before it's dropped
+	static constexpr double MaxBackpressureWaitSeconds = 0.1;
+
+	FPubnubAsyncLogSink(uint32 InQueueCapacity, FBatchHandler InBatchHandler);
+	virtual ~FPubnubAsyncLogSink() override;
+
+	FPubnubAsyncLogSink(const FPubnubAsyncLogSink&) = delete;
+	FPubnubAsyncLogSink& operator=(const FPubnubAsyncLogSink&) = delete;
+
+	/**
+	 * Queues record for the sink thread. Can be called from any thread.
+	 * Returns false if the sink doesn't accept records (it's shut down or it's called from the sink thread itself),
+	 * in which case the caller should dispatch the record synchronously. Dropped records still return true.
+	 */
+	bool Enqueue(FPubnubLogRecord&& Record);
+
+	//Stops accepting messages, dispatches everything that was already queued and stops the sink thread
+	void Shutdown();
+
+	FPubnubAsyncLogStats GetStats() const;
+
+	//FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+
+	//Takes up to MaxBatchSize records from the queue and passes them to the handler. Returns number of records dispatched
+	int32 DispatchBatch();
+
+	TPubnubMpscRingBuffer<FPubnubLogRecord> Queue;
+	FBatchHandler BatchHandler;
+	TArray<FPubnubLogRecord> Batch;
+
+	FEvent* WakeUpEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	//Read by every producer, written when the thread starts and stops
+	std::atomic<uint32> ThreadId{0};
+
+	std::atomic<bool> bAcceptingMessages{true};
+	std::atomic<bool> bStopRequested{false};
+	//Set by the sink thread right before it goes to sleep, so producers know they have to wake it up
+	std::atomic<bool> bSinkSleeping{false};
+	//Producers that passed bAcceptingMessages check and didn't finish pushing yet
+	std::atomic<int32> ActiveProducers{0};
+
+	std::atomic<int64> EnqueuedCount{0};
+	std::atomic<int64> DispatchedCount{0};
+	std::atomic<int64> DroppedCount{0};
+	std::atomic<int64> BackpressureCount{0};
+};
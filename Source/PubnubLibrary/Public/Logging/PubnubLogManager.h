@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Interfaces/PubnubLoggerInterface.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
 #include "PubnubLogManager.generated.h"
 
 struct pubnub_logger;
@@ -12,6 +14,8 @@ typedef struct pubnub_logger pubnub_logger_t;
 struct pubnub_log_message;
 typedef struct pubnub_log_message pubnub_log_message_t;
 struct pubnub_logger_interface;
+class FPubnubAsyncLogSink;
+struct FPubnubLogRecord;
 
 UCLASS()
 class PUBNUBLIBRARY_API UPubnubLogManager : public UObject
@@ -25,17 +29,96 @@ public:
 	TArray<TScriptInterface<IPubnubLoggerInterface>> GetLoggers() const;
 	void SetUESdkEmitterID(const FString& InEmitterID);
 
+	/**
+	 * Switches the manager to asynchronous mode: messages are queued and passed to loggers in batches by a background thread.
+	 * Async mode can be enabled only once for the manager, further calls do nothing.
+	 */
+	void EnableAsyncDispatch(int32 QueueCapacity);
+	//Dispatches all queued messages and switches the manager back to synchronous mode
+	void DisableAsyncDispatch();
+	FPubnubAsyncLogStats GetAsyncLogStats() const;
+
+	virtual void BeginDestroy() override;
+
 	void Log(EPubnubLogLevel Level, EPubnubLogSource Source, const FString& Message, const FString& Callsite = TEXT(""));
+
+	/**
+	 * Returns true if at least one registered logger accepts messages of given level from given source.
+	 * Uses cached level mask, so it's cheap enough to be checked before a log message is even built.
+	 * The cache is refreshed right away by NotifyLogLevelsChanged and logger registration, and at least every LevelsRefreshIntervalSeconds.
+	 */
+	bool IsLogEnabled(EPubnubLogLevel Level, EPubnubLogSource Source)
+	{
+		if (CachedLevelsEpoch.load(std::memory_order_acquire) != LogLevelsEpoch.load(std::memory_order_acquire)
+			|| FPlatformTime::Cycles64() >= NextLevelsRefreshCycles.load(std::memory_order_relaxed))
+		{
+			RefreshCachedLevels();
+		}
+		return (EnabledLevelsMask[static_cast<int32>(Source)].load(std::memory_order_relaxed) & LevelMaskBit(Level)) != 0;
+	}
+
+	//Returns the lowest level accepted by any logger for given source or PLL_None if no logger accepts it
+	EPubnubLogLevel GetMostVerboseEnabledLevel(EPubnubLogSource Source);
+
+	/**
+	 * Makes all log managers refresh their cached levels right away. UPubnubBaseLogger setters call it automatically.
+	 * Custom IPubnubLoggerInterface implementations should call it when their minimum level changes. If they don't,
+	 * the new level is picked up by the periodic refresh, within LevelsRefreshIntervalSeconds.
+	 */
+	static void NotifyLogLevelsChanged();
 	void HandleCCoreLog(const pubnub_log_message_t* Message);
 	static const pubnub_logger_interface& GetCCoreLoggerInterface();
 
 private:
-	static bool IsLevelEnabled(EPubnubLogLevel MessageLevel, EPubnubLogLevel MinimumLevel);
-	static void DispatchLevelSpecific(UObject* LoggerObject, EPubnubLogLevel Level, const FPubnubLogMessage& Message);
+	//Logger resolved when it's added or when levels change, so dispatching a message doesn't need any reflection
+	struct FLoggerDispatchEntry
+	{
+		//Weak, because the table isn't visible to GC and a removed logger can be collected while another thread still dispatches from an old table
+		TWeakObjectPtr<UObject> Object;
+		//Set only for native C++ loggers, which can be called directly without Blueprint event thunks. Use only after Object resolved
+		IPubnubLoggerInterface* NativeInterface = nullptr;
+		//Bit per accepted EPubnubLogLevel, separately for every EPubnubLogSource
+		uint8 LevelMask[2] = {0, 0};
+	};
+
+	//Longest time a level change of a logger that doesn't call NotifyLogLevelsChanged can go unnoticed
+	static constexpr double LevelsRefreshIntervalSeconds = 1.0;
+
+	static constexpr uint8 AllLevelsMask = (1 << static_cast<uint8>(EPubnubLogLevel::PLL_None)) - 1;
+	static uint8 LevelMaskBit(EPubnubLogLevel Level) { return static_cast<uint8>((1 << static_cast<uint8>(Level)) & AllLevelsMask); }
+	//Mask of all levels accepted by a logger with given minimum level
+	static uint8 LevelsFromMinimum(EPubnubLogLevel MinimumLevel);
+
+	static void DispatchLevelSpecific(const FLoggerDispatchEntry& Entry, UObject* LoggerObject, EPubnubLogLevel Level, const FPubnubLogMessage& Message);
 	void DispatchMessage(const FPubnubLogMessage& Message);
+	//Queues record for the async sink, if it's enabled, or builds the message and dispatches it synchronously
+	void SubmitRecord(FPubnubLogRecord&& Record);
+	//Formats record into the message passed to loggers
+	FPubnubLogMessage BuildLogMessage(const FPubnubLogRecord& Record) const;
+	//Drops invalid loggers and resolves the rest into a new DispatchTable, together with aggregate level masks
+	void RebuildDispatchTable();
+	//Rebuilds the table if levels changed or the periodic refresh is due. Only one of the threads that hit the periodic refresh does it
+	void RefreshCachedLevels();
+
+	//Incremented every time any logger level changes. Managers compare it with their own epoch to know when cache is outdated
+	static std::atomic<uint32> LogLevelsEpoch;
+	std::atomic<uint32> CachedLevelsEpoch{0};
+	//FPlatformTime::Cycles64 at which the cached levels are refreshed even if nobody reported a change
+	std::atomic<uint64> NextLevelsRefreshCycles{0};
+	//Levels accepted by at least one logger, per EPubnubLogSource
+	std::atomic<uint8> EnabledLevelsMask[2] = {0, 0};
+	//Never modified after it's built, only replaced. Dispatch takes it under LoggersMutex and calls loggers without the lock
+	TSharedPtr<const TArray<FLoggerDispatchEntry>, ESPMode::ThreadSafe> DispatchTable;
 
 	UPROPERTY()
 	TArray<TObjectPtr<UObject>> LoggerObjects;
+	//Loggers can be dispatched to from any thread, including the async sink thread
+	mutable FCriticalSection LoggersMutex;
+
+	//Created by EnableAsyncDispatch. Kept until the manager is destroyed, so threads that log never see it deleted
+	std::atomic<FPubnubAsyncLogSink*> AsyncSink{nullptr};
+	//Threads between loading AsyncSink and finishing Enqueue. BeginDestroy waits for them before deleting the sink
+	std::atomic<int32> ActiveSubmitters{0};
 
 	FString UESdkEmitterID = TEXT("PubNub-unknown");
 };
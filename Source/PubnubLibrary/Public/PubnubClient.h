@@ -9,12 +9,20 @@
 #include "PubnubSubsystem.h"
 #include "Crypto/PubnubCryptorInterface.h"
 #include "Interfaces/PubnubLoggerInterface.h"
+#include "Containers/Ticker.h"
+#include "PubnubKeyFuncs.h"
+#include "Entities/PubnubChannelHandlerIndex.h"
+#include "PubnubNativeMessage.h"
 #include <atomic>
 #include "PubnubClient.generated.h"
 
 class UPubnubSubsystem;
 class UPubnubCryptoBridge;
 class FPubnubFunctionThread;
+class FPubnubContextPool;
+enum class EPubnubOperationClass : uint8;
+class FPubnubTokenCache;
+class FPubnubCCoreEntityCache;
 class UPubnubSubscription;
 class UPubnubSubscriptionSet;
 class UPubnubBaseEntity;
@@ -25,6 +33,9 @@ class UPubnubUserMetadataEntity;
 class UPubnubDefaultLogger;
 class UPubnubLogManager;
 struct CCoreSubscriptionCallback;
+struct FPubnubInternalPublishTransaction;
+struct FPubnubReceivedMessageQueue;
+struct FPubnubInternalClientListenerUserData;
 
 struct pubnub_;
 typedef struct pubnub_ pubnub_t;
@@ -40,6 +51,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPubnubClientDeinitialized);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPubnubClientDeinitializeStart);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPubnubMessageReceived, FPubnubMessageData, Message);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubMessageReceivedNative, const FPubnubMessageData& Message);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubMessagesReceivedBatchNative, TArrayView<const FPubnubMessageData> Messages);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPubnubNativeMessageReceived, const FPubnubNativeMessage& Message);
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnPubnubChannelMessage, FPubnubMessageData, Message, bool, IsPresenceEvent);
+DECLARE_DELEGATE_TwoParams(FOnPubnubChannelMessageNative, const FPubnubMessageData& Message, bool IsPresenceEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubError, FString, ErrorMessage, EPubnubErrorType, ErrorType);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubErrorNative, FString ErrorMessage, EPubnubErrorType ErrorType);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPubnubSubscriptionStatusChanged, EPubnubSubscriptionStatus, Status, FPubnubSubscriptionStatusData, StatusData);
@@ -48,6 +63,8 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPubnubSubscriptionStatusChangedNative, E
 
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnPubnubPublishMessageResponse, FPubnubOperationResult, Result, FPubnubMessageData, PublishedMessage);
 DECLARE_DELEGATE_TwoParams(FOnPubnubPublishMessageResponseNative, const FPubnubOperationResult& Result, const FPubnubMessageData& PublishedMessage);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubPublishBatchResponse, const TArray<FPubnubPublishMessageResult>&, Results);
+DECLARE_DELEGATE_OneParam(FOnPubnubPublishBatchResponseNative, const TArray<FPubnubPublishMessageResult>& Results);
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnPubnubSignalResponse, FPubnubOperationResult, Result, FPubnubMessageData, SignalMessage);
 DECLARE_DELEGATE_TwoParams(FOnPubnubSignalResponseNative, const FPubnubOperationResult& Result, const FPubnubMessageData& SignalMessage);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnPubnubSubscribeOperationResponse, FPubnubOperationResult, Result);
@@ -135,6 +152,8 @@ class PUBNUBLIBRARY_API UPubnubClient : public UObject
 	friend class UPubnubSubsystem;
 	friend class UPubnubSubscription;
 	friend class UPubnubSubscriptionSet;
+	friend class UPubnubBaseEntity;
+	friend struct CCoreSubscriptionCallback;
 
 public:
 	
@@ -162,6 +181,20 @@ public:
 	/**Global listener for all messages received on subscribed channels, equivalent that accepts lambdas*/
 	FOnPubnubMessageReceivedNative OnMessageReceivedNative;
 
+	/**
+	 * Global listener for all messages received on subscribed channels, delivered once per frame with every message received since the previous one.
+	 * Called before OnMessageReceived for the same messages. The view is only valid during the broadcast.
+	 */
+	FOnPubnubMessagesReceivedBatchNative OnMessagesReceivedBatch;
+
+	/**
+	 * Global listener for all messages received on subscribed channels, with the compact native message.
+	 * Called after OnMessagesReceivedBatch and before OnMessageReceived for the same message.
+	 * FPubnubMessageData for the other delegates and channel handlers is built only when any of them needs it,
+	 * so with only this one bound, delivering a message doesn't allocate any strings.
+	 */
+	FOnPubnubNativeMessageReceived OnNativeMessageReceived;
+
 	
 	/* GENERAL FUNCTIONS */
 
@@ -244,6 +277,36 @@ public:
 	 */
 	void PublishMessageAsync(FString Channel, FString Message, FPubnubPublishSettings PublishSettings);
 
+	/**
+	 * Publishes a batch of messages synchronously.
+	 * Requests are pipelined across free pooled contexts over keep-alive connections, so the whole batch takes
+	 * roughly as long as the slowest round trips instead of one round trip per message.
+	 * Order of publishes is not guaranteed between messages of the batch.
+	 * 
+	 * @param Requests Messages to publish. Every request has its own channel, message and publish settings.
+	 * @return Array of FPubnubPublishMessageResult, one for every request and in the same order as Requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Publish")
+	TArray<FPubnubPublishMessageResult> PublishBatch(const TArray<FPubnubPublishRequest>& Requests);
+
+	/**
+	 * Publishes a batch of messages. See PublishBatch for details.
+	 * 
+	 * @param Requests Messages to publish. Every request has its own channel, message and publish settings.
+	 * @param OnPublishBatchResponse Optional delegate to listen for the results. It's called once, with results for all requests.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Publish", meta = (AutoCreateRefTerm = "OnPublishBatchResponse"))
+	void PublishBatchAsync(const TArray<FPubnubPublishRequest>& Requests, FOnPubnubPublishBatchResponse OnPublishBatchResponse);
+
+	/**
+	 * Publishes a batch of messages. See PublishBatch for details.
+	 * 
+	 * @param Requests Messages to publish. Every request has its own channel, message and publish settings.
+	 * @param NativeCallback Optional delegate to listen for the results. Delegate in native form that can accept lambdas.
+	 *						 It's called once, with results for all requests in the same order as Requests.
+	 */
+	void PublishBatchAsync(const TArray<FPubnubPublishRequest>& Requests, FOnPubnubPublishBatchResponseNative NativeCallback = nullptr);
+
 
 	/**
 	 * Sends a signal to a specified channel synchronously.
@@ -456,6 +519,165 @@ public:
 	 */
 	void UnsubscribeFromAllAsync(FOnPubnubSubscribeOperationResponseNative NativeCallback = nullptr);
 
+	/**
+	 * Binds handler for messages received on a specific channel through SubscribeToChannel/SubscribeToGroup.
+	 * Unlike OnMessageReceived, the handler is only called for messages of its channel, so every system
+	 * doesn't have to receive and filter all messages of the client.
+	 * 
+	 * @param Channel The channel to handle messages of. Channel ending with '*' is a wildcard prefix, e.g. "game.*" handles all channels starting with "game.".
+	 * @param Handler Delegate called on the game thread for every message of the channel.
+	 * @param ReceivePresenceEvents Whether presence events of the channel should be passed to the handler too.
+	 * @return ID of the bound handler, used to unbind it. -1 if the handler couldn't be bound.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	int BindChannelHandler(FString Channel, FOnPubnubChannelMessage Handler, bool ReceivePresenceEvents = false);
+
+	/**
+	 * Binds handler for messages received on a specific channel through SubscribeToChannel/SubscribeToGroup.
+	 * Unlike OnMessageReceived, the handler is only called for messages of its channel, so every system
+	 * doesn't have to receive and filter all messages of the client.
+	 * 
+	 * @param Channel The channel to handle messages of. Channel ending with '*' is a wildcard prefix, e.g. "game.*" handles all channels starting with "game.".
+	 * @param NativeHandler Delegate called on the game thread for every message of the channel. Delegate in native form that can accept lambdas.
+	 * @param ReceivePresenceEvents Whether presence events of the channel should be passed to the handler too.
+	 * @return ID of the bound handler, used to unbind it. -1 if the handler couldn't be bound.
+	 */
+	int BindChannelHandler(FString Channel, FOnPubnubChannelMessageNative NativeHandler, bool ReceivePresenceEvents = false);
+
+	/**
+	 * Unbinds handler bound with BindChannelHandler.
+	 * 
+	 * @param HandlerID ID returned by BindChannelHandler.
+	 * @return True if the handler was bound and is removed now.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	bool UnbindChannelHandler(int HandlerID);
+
+	/**
+	 * Unbinds all handlers bound with BindChannelHandler.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	void UnbindAllChannelHandlers();
+
+	/**
+	 * Sets server-side filter expression of the subscribe loop, e.g. "region == 'eu' && level > 10".
+	 * The expression is evaluated against meta of published messages, and only matching ones are sent to this client,
+	 * so messages that would be discarded anyway don't use bandwidth and aren't decoded or dispatched.
+	 * Messages published without meta are always received.
+	 * 
+	 * @Note There is one filter expression for all subscriptions of the client. It applies from the next subscribe request,
+	 * so usually after the next subscribe/unsubscribe call or when the current long-poll request ends.
+	 * FPubnubSubscribeSettings::FilterExpression changes it too when subscribing with non-empty expression.
+	 * 
+	 * @param FilterExpression The filter expression to use. Empty removes the filter.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	void SetSubscribeFilterExpression(FString FilterExpression);
+
+	/**
+	 * Gets server-side filter expression of the subscribe loop.
+	 * 
+	 * @return Filter expression currently used, empty if messages are not filtered.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub|Subscribe")
+	FString GetSubscribeFilterExpression() const;
+
+	
+	/**
+	 * Subscribes to multiple channels and channel groups synchronously - start listening for messages on all of them.
+	 * All of them are added to the subscribe loop in a single change, instead of restarting it for every channel.
+	 * Channels and groups that are already subscribed are skipped.
+	 * Use OnMessageReceived Callback to get those messages.
+	 * 
+	 * @param Channels The IDs of the channels to subscribe to.
+	 * @param ChannelGroups The names of the channel groups to subscribe to.
+	 * @param SubscribeSettings Optional settings for the subscribe operation. See FPubnubSubscribeSettings for more details.
+	 * @return FPubnubOperationResult containing the operation result.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	FPubnubOperationResult SubscribeToChannels(TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
+	/**
+	 * Subscribes to multiple channels and channel groups - start listening for messages on all of them.
+	 * All of them are added to the subscribe loop in a single change. Async subscribe and unsubscribe calls made
+	 * within FPubnubConfig::SubscriptionCoalescingWindowMs are applied together with this one.
+	 * Use OnMessageReceived Callback to get those messages.
+	 * 
+	 * @param Channels The IDs of the channels to subscribe to.
+	 * @param ChannelGroups The names of the channel groups to subscribe to.
+	 * @param OnSubscribeToChannelsResponse Optional delegate to listen for the subscribe result.
+	 * @param SubscribeSettings Optional settings for the subscribe operation. See FPubnubSubscribeSettings for more details.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe", meta = (AutoCreateRefTerm = "OnSubscribeToChannelsResponse"))
+	void SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FOnPubnubSubscribeOperationResponse OnSubscribeToChannelsResponse, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
+	/**
+	 * Subscribes to multiple channels and channel groups - start listening for messages on all of them.
+	 * All of them are added to the subscribe loop in a single change. Async subscribe and unsubscribe calls made
+	 * within FPubnubConfig::SubscriptionCoalescingWindowMs are applied together with this one.
+	 * Use OnMessageReceived Callback to get those messages.
+	 * 
+	 * @param Channels The IDs of the channels to subscribe to.
+	 * @param ChannelGroups The names of the channel groups to subscribe to.
+	 * @param NativeCallback Optional delegate to listen for the subscribe result. Delegate in native form that can accept lambdas.
+	 *						 Can be skipped if subscribe result is not needed.
+	 * @param SubscribeSettings Optional settings for the subscribe operation. See FPubnubSubscribeSettings for more details.
+	 */
+	void SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FOnPubnubSubscribeOperationResponseNative NativeCallback = nullptr, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
+	/**
+	 * Subscribes to multiple channels and channel groups - start listening for messages on all of them. Overload without delegate to get subscribe result.
+	 * Use OnMessageReceived Callback to get those messages.
+	 * 
+	 * @param Channels The IDs of the channels to subscribe to.
+	 * @param ChannelGroups The names of the channel groups to subscribe to.
+	 * @param SubscribeSettings Optional settings for the subscribe operation. See FPubnubSubscribeSettings for more details.
+	 */
+	void SubscribeToChannelsAsync(TArray<FString> Channels, TArray<FString> ChannelGroups, FPubnubSubscribeSettings SubscribeSettings);
+
+	
+	/**
+	 * Adds and removes channels and channel groups of the client subscriptions synchronously, as a single change of the subscribe loop.
+	 * Removals are applied before additions. Channels and groups that are already in the requested state are skipped.
+	 * 
+	 * @param ChannelsToAdd The IDs of the channels to subscribe to.
+	 * @param ChannelGroupsToAdd The names of the channel groups to subscribe to.
+	 * @param ChannelsToRemove The IDs of the channels to unsubscribe from.
+	 * @param ChannelGroupsToRemove The names of the channel groups to unsubscribe from.
+	 * @param SubscribeSettings Optional settings for the added channels and groups. See FPubnubSubscribeSettings for more details.
+	 * @return FPubnubOperationResult containing the operation result.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe")
+	FPubnubOperationResult UpdateSubscriptions(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
+	/**
+	 * Adds and removes channels and channel groups of the client subscriptions, as a single change of the subscribe loop.
+	 * Async subscribe and unsubscribe calls made within FPubnubConfig::SubscriptionCoalescingWindowMs are applied together with this one.
+	 * 
+	 * @param ChannelsToAdd The IDs of the channels to subscribe to.
+	 * @param ChannelGroupsToAdd The names of the channel groups to subscribe to.
+	 * @param ChannelsToRemove The IDs of the channels to unsubscribe from.
+	 * @param ChannelGroupsToRemove The names of the channel groups to unsubscribe from.
+	 * @param OnUpdateSubscriptionsResponse Optional delegate to listen for the update result.
+	 * @param SubscribeSettings Optional settings for the added channels and groups. See FPubnubSubscribeSettings for more details.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Subscribe", meta = (AutoCreateRefTerm = "OnUpdateSubscriptionsResponse"))
+	void UpdateSubscriptionsAsync(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FOnPubnubSubscribeOperationResponse OnUpdateSubscriptionsResponse, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
+	/**
+	 * Adds and removes channels and channel groups of the client subscriptions, as a single change of the subscribe loop.
+	 * Async subscribe and unsubscribe calls made within FPubnubConfig::SubscriptionCoalescingWindowMs are applied together with this one.
+	 * 
+	 * @param ChannelsToAdd The IDs of the channels to subscribe to.
+	 * @param ChannelGroupsToAdd The names of the channel groups to subscribe to.
+	 * @param ChannelsToRemove The IDs of the channels to unsubscribe from.
+	 * @param ChannelGroupsToRemove The names of the channel groups to unsubscribe from.
+	 * @param NativeCallback Optional delegate to listen for the update result. Delegate in native form that can accept lambdas.
+	 *						 Can be skipped if update result is not needed.
+	 * @param SubscribeSettings Optional settings for the added channels and groups. See FPubnubSubscribeSettings for more details.
+	 */
+	void UpdateSubscriptionsAsync(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FOnPubnubSubscribeOperationResponseNative NativeCallback = nullptr, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
+
 
 	
 	/* CHANNEL GROUPS API */
@@ -889,11 +1111,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pubnub|Access Manager")
 	FString ParseToken(FString Token);
 
+	/**
+	 * Checks if an access token grants given permission to a resource, either directly or through one of its patterns.
+	 * The token is parsed only the first time it's checked, later checks use the cached permissions and don't parse anything.
+	 * Expired tokens don't grant any permissions.
+	 * 
+	 * @param Token The access token to check.
+	 * @param ResourceType Type of the resource: channel, channel group or user.
+	 * @param ResourceID ID of the resource.
+	 * @param Permission The permission to check.
+	 * @return True if the token is valid and grants the permission.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Access Manager")
+	bool HasPermission(FString Token, EPubnubTokenResourceType ResourceType, FString ResourceID, EPubnubTokenPermission Permission);
+
 	
 	/**
-	 * Sets the PAM v3 access token for this client on the calling thread. The underlying update is
-	 * immediate (no network call), but this variant blocks the caller until the token pointer is
-	 * swapped in both C-Core contexts.
+	 * Sets the PAM v3 access token for this client on the calling thread. The update is immediate
+	 * (no network call) and doesn't wait for in-flight requests or subscribe operations: idle contexts
+	 * use the new token right away, contexts in the middle of a request once that request finishes.
 	 * Use this in shipped game clients after your backend mints a scoped token.
 	 * 
 	 * @param Token PAM v3 access token with embedded permissions, minted server-side.
@@ -934,6 +1170,21 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub|Config")
 	FString GetOrigin() const;
 
+	/**
+	 * Gets the number of requests sent by non-subscribe operations and the number of connections opened for them.
+	 * Use it to check how well connections are reused with the keep-alive settings of FPubnubNetworkingConfig.
+	 * 
+	 * @return Counters collected since client initialization or the last ResetConnectionStats call.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Pubnub|Networking")
+	FPubnubConnectionStats GetConnectionStats() const;
+
+	/**
+	 * Sets all counters returned by GetConnectionStats back to zero.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Networking")
+	void ResetConnectionStats();
+
 
 
 	/* MESSAGE PERSISTENCE API */
@@ -2499,6 +2750,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pubnub|Logger")
 	TArray<TScriptInterface<IPubnubLoggerInterface>> GetLoggers();
 
+	/**
+	 * Returns counters of the asynchronous log pipeline (queued, dispatched, dropped and delayed messages).
+	 * All counters are 0 if async logging is not enabled in FPubnubLoggerConfig.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Pubnub|Logger")
+	FPubnubAsyncLogStats GetAsyncLogStats();
+
 #pragma endregion
 
 #pragma region ENTITIES
@@ -2668,22 +2926,80 @@ private:
 	/** Counterpart to ManagedSubscriptions for subscription sets. */
 	TMap<pubnub_subscription_set_t*, TWeakObjectPtr<UPubnubSubscriptionSet>> ManagedSubscriptionSets;
 
-	//Thread for all PubNub operations, this thread will queue all PubNub calls and trigger them one by one
+	//Dispatcher for all Async PubNub operations, it queues all PubNub calls and executes them on its worker threads
 	FPubnubFunctionThread* PubnubCallsThread = nullptr;
 
-	//Mutex to guard all Pubnub operations. As user can call multiple operations at the same time, they need to be guarded
-	FCriticalSection PubnubOperationMutex;
+	//Pool of C-Core contexts for all non-subscribe operations. Every operation checks out its own context, so up to ContextPoolSize of them can run at once
+	FPubnubContextPool* ContextPool = nullptr;
 
 	//Serializes all subscribe/unsubscribe operations across all API entry points.
 	FCriticalSection SubscriptionOperationExecutionMutex;
 	//Guards pending subscription operation state used by callback completion.
 	FCriticalSection PendingSubscriptionOperationMutex;
 
-	//Pubnub context for the most of the pubnub operations
-	pubnub_t *ctx_pub = nullptr;
 	//Pubnub context for the event engine - subscribe operations
 	pubnub_t *ctx_ee = nullptr;
 
+	//C-Core entities reused by subscriptions created on ctx_ee
+	FPubnubCCoreEntityCache* CCoreEntityCache = nullptr;
+
+	//Entity objects returned by Create*Entity, so asking for the same entity again doesn't create a new object
+	FCriticalSection EntityObjectsMutex;
+	using FEntityObjectKey = TPair<EPubnubEntityType, FString>;
+	TMap<FEntityObjectKey, TWeakObjectPtr<UPubnubBaseEntity>, FDefaultSetAllocator, TPubnubCaseSensitiveKeyFuncs<FEntityObjectKey, TWeakObjectPtr<UPubnubBaseEntity>>> EntityObjects;
+	//Entries of garbage collected entities are removed when the map grows past this size
+	int32 EntityObjectsPruneThreshold = 64;
+
+	//Released subscriptions waiting to be reused by CreateSubscription
+	UPROPERTY()
+	TArray<TObjectPtr<UPubnubSubscription>> PooledSubscriptions;
+	FCriticalSection SubscriptionPoolMutex;
+	int32 SubscriptionPoolCapacity = 0;
+
+	//Returns existing entity object of given type and ID, or creates a new one
+	template<typename EntityClass>
+	EntityClass* GetOrCreateEntity_priv(const FString& EntityID, EPubnubEntityType EntityType);
+
+	//Takes released, unsubscribed subscription. Returns false if it can't be pooled and has to be cleaned up
+	bool AddSubscriptionToPool(UPubnubSubscription* Subscription);
+	//Returns pooled subscription created for the same entity and presence setting, or nullptr if there is none
+	UPubnubSubscription* TakePooledSubscription(const FString& EntityID, EPubnubEntityType EntityType, bool bReceivePresenceEvents);
+
+	//Tokens parsed by HasPermission. Shared, so a check running on another thread keeps it alive while the client deinitializes
+	TSharedPtr<FPubnubTokenCache, ESPMode::ThreadSafe> TokenCache;
+
+	//Messages received by C-Core subscribe listeners, waiting for delivery on the game thread
+	TSharedPtr<FPubnubReceivedMessageQueue, ESPMode::ThreadSafe> ReceivedMessageQueue;
+	//user_data of client-level listeners. Freed together with ctx_ee, so no callback can use it afterwards
+	FPubnubInternalClientListenerUserData* ClientListenerUserData = nullptr;
+	FTSTicker::FDelegateHandle ReceivedMessagesTickerHandle;
+	int32 MessageDeliveryBudgetPerFrame = 0;
+	//Reused between frames, so the batch delegate doesn't allocate every frame
+	TArray<FPubnubNativeMessage> ReceivedNativeMessagesBatch;
+
+	//Blueprint structs of ReceivedNativeMessagesBatch. Filled only when OnMessagesReceivedBatch is bound
+	TArray<FPubnubMessageData> ReceivedMessagesBatch;
+
+	//Broadcasts queued messages on the game thread, up to MessageDeliveryBudgetPerFrame. Ticked every frame
+	bool DeliverReceivedMessages(float DeltaTime);
+
+	struct FChannelHandler
+	{
+		FOnPubnubChannelMessageNative Handler;
+		bool bReceivePresenceEvents = false;
+		//Cleared when unbound, so a handler unbound by another handler of the same message is not called anymore
+		std::atomic<bool> bIsBound{true};
+	};
+
+	//Handlers bound with BindChannelHandler and index of their channels
+	FCriticalSection ChannelHandlersMutex;
+	TMap<int32, TSharedRef<FChannelHandler, ESPMode::ThreadSafe>> ChannelHandlers;
+	FPubnubChannelHandlerIndex ChannelHandlerIndex;
+	int32 NextChannelHandlerID = 0;
+
+	//Calls channel handlers matching the message. Called on the game thread, after OnMessageReceived. GetMessageData is called only if any handler matches
+	void RouteMessageToChannelHandlers(const FPubnubNativeMessage& NativeMessage, TFunctionRef<const FPubnubMessageData&()> GetMessageData);
+
 #pragma region PUBNUB INIT
 
 	void InitWithConfig(UPubnubSubsystem* InPubnubSubsystem, FPubnubConfig InConfig, int InClientID, FString InDebugName = "");
@@ -2714,13 +3030,32 @@ private:
 	//Auth token has to be kept alive for the lifetime of the sdk, so this is the container for it
 	char* AuthTokenBuffer = nullptr;
 	size_t AuthTokenLength = 0;
-	//Previous auth token buffers retired after a swap; freed at deinit because ctx_ee may still read them briefly
-	TArray<char*> RetiredAuthTokenBuffers;
+	//Incremented with every new token, 0 means no token was set
+	uint64 AuthTokenGeneration = 0;
+
+	//Previous auth token buffer, kept until no context can point to it anymore
+	struct FRetiredAuthToken
+	{
+		char* Buffer = nullptr;
+		uint64 Generation = 0;
+	};
+	TArray<FRetiredAuthToken> RetiredAuthTokenBuffers;
+	//Guards auth token buffers and ctx_ee while the token is swapped. Never held during network I/O
+	FCriticalSection AuthTokenMutex;
+
+	//Frees retired auth token buffers that none of the contexts points to anymore. Has to be called with AuthTokenMutex locked
+	void ReclaimRetiredAuthTokenBuffers();
 
 	//Origin has to be kept alive for the lifetime of the sdk, so this is the container for it
 	char* OriginBuffer = nullptr;
 	size_t OriginLength = 0;
 
+	//Filter expression of the subscribe loop, kept alive as long as ctx_ee may use it. Guarded by SubscriptionOperationExecutionMutex
+	char* FilterExpressionBuffer = nullptr;
+	FString SubscribeFilterExpression = "";
+	//Guards only SubscribeFilterExpression, so the getter doesn't wait for subscribe operations
+	mutable FCriticalSection SubscribeFilterExpressionMutex;
+
 	//Runtime SDK suffix has to be kept alive for the lifetime of the sdk, so this is the container for it
 	char* RuntimeSdkVersionSuffixBuffer = nullptr;
 	size_t RuntimeSdkVersionSuffixLength = 0;
@@ -2742,6 +3077,9 @@ private:
 	char SubscribeKey[PublishKeySize + 1] = {};
 	char SecretKey[SecretKeySize + 1] = {};
 
+	//Size from which publishes with default method are sent with POST and GZIP. -1 if CompressLargePublishes is off
+	int32 PublishCompressionThresholdBytes = -1;
+
 #pragma endregion 
 
 #pragma region PUBNUB SUBSCRIPTION
@@ -2749,6 +3087,41 @@ private:
 	//Storage for global subscriptions (not from Entities)
 	TMap<FString, CCoreSubscriptionCallback*> ChannelSubscriptions;
 	TMap<FString, CCoreSubscriptionCallback*> ChannelGroupSubscriptions;
+	//Sets used to subscribe many global subscriptions at once, with the number of their subscriptions that are still subscribed
+	TMap<pubnub_subscription_set_t*, int32> ClientSubscriptionSets;
+
+	//Channels and groups to add to and remove from global subscriptions in a single change of the subscribe loop
+	struct FSubscriptionChanges
+	{
+		TMap<FString, FPubnubSubscribeSettings> ChannelsToAdd;
+		TMap<FString, FPubnubSubscribeSettings> ChannelGroupsToAdd;
+		TSet<FString> ChannelsToRemove;
+		TSet<FString> ChannelGroupsToRemove;
+
+		bool IsEmpty() const
+		{
+			return ChannelsToAdd.IsEmpty() && ChannelGroupsToAdd.IsEmpty() && ChannelsToRemove.IsEmpty() && ChannelGroupsToRemove.IsEmpty();
+		}
+	};
+
+	//Async subscribe/unsubscribe call waiting to be applied together with other calls made in the coalescing window
+	struct FQueuedSubscriptionChange
+	{
+		TArray<FString> ChannelsToAdd;
+		TArray<FString> ChannelGroupsToAdd;
+		TArray<FString> ChannelsToRemove;
+		TArray<FString> ChannelGroupsToRemove;
+		FPubnubSubscribeSettings SubscribeSettings;
+		FOnPubnubSubscribeOperationResponseNative Callback;
+		//Subscribe/unsubscribe of a single channel or group. Like its Sync version, it fails if it's already (or not) subscribed
+		bool bSingleEntity = false;
+	};
+
+	FCriticalSection QueuedSubscriptionChangesMutex;
+	TArray<FQueuedSubscriptionChange> QueuedSubscriptionChanges;
+	FTSTicker::FDelegateHandle SubscriptionChangesTickerHandle;
+	bool bSubscriptionChangesFlushScheduled = false;
+	int32 SubscriptionCoalescingWindowMs = 0;
 
 	struct FPendingSubscriptionOperationState
 	{
@@ -2771,30 +3144,84 @@ private:
 
 	void OnCCoreSubscriptionStatusReceived(int StatusEnum, const void* StatusData);
 
+	//Automatic reconnection of the subscribe loop after it failed, according to RetryConfig of PubnubConfig
+	FCriticalSection SubscribeRetryMutex;
+	FTSTicker::FDelegateHandle SubscribeRetryTickerHandle;
+	//Reconnection attempts since the subscribe loop was last connected. Guarded by SubscribeRetryMutex
+	int32 SubscribeRetryCount = 0;
+	//Schedules reconnection after a failure status and resets the attempts on connection. Returns attempts made before this status
+	int32 HandleSubscribeRetry(int StatusEnum);
+	void ReconnectSubscriptionsForRetry_priv();
+	//Drops scheduled reconnection, so it doesn't reconnect subscriptions disconnected on purpose
+	void CancelSubscribeRetry();
+
+	//Queues Async subscription change. Changes queued before the flush runs are applied together
+	void QueueSubscriptionChange(FQueuedSubscriptionChange&& Change);
+	//Has to be called with QueuedSubscriptionChangesMutex locked
+	void ScheduleSubscriptionChangesFlush();
+	//Flushes queued changes without waiting for the coalescing window, so they are applied before operations queued after this call
+	void ExpediteQueuedSubscriptionChanges();
+	void FlushQueuedSubscriptionChanges();
+	//Fails all queued changes, used when the client deinitializes before they were applied
+	void CancelQueuedSubscriptionChanges(const FString& CancelReason);
+	FPubnubOperationResult ApplySubscriptionChanges_priv(const FSubscriptionChanges& Changes);
+	//Unsubscribes and frees given global subscriptions. Returns false if any of them failed to unsubscribe, those are kept
+	bool RemoveClientSubscriptions(const TSet<FString>& Channels, const TSet<FString>& ChannelGroups);
+	//Subscribes given global subscriptions, all with the same settings, with a single change of the subscribe loop. Has to run under ExecuteSerializedSubscriptionOperation
+	bool AddClientSubscriptions(const TArray<FString>& Channels, const TArray<FString>& ChannelGroups, const FPubnubSubscribeSettings& SubscribeSettings, FString& OutErrorMessage);
+	//Sets filter expression of ctx_ee if it's different from the current one. Empty keeps the current one unless bAllowEmpty is true.
+	//Has to be called with SubscriptionOperationExecutionMutex locked
+	void ApplySubscribeFilterExpression_priv(const FString& FilterExpression, bool bAllowEmpty = false);
+
 #pragma endregion
 	
 	//Returns FString from the pubnub_get response
 	FString GetLastResponse(pubnub_t* context);
 
-	//Special GetLastResponse for app context getters. It doesn't print 404 code as error, but debug.
-	FString GetResponseForGetObject(pubnub_t* context);
+	//Returns UTF-8 view of the pubnub_get response, without converting it. It points into the context buffer, so it's valid until the next transaction on the context
+	FAnsiStringView GetLastResponseView(pubnub_t* context);
+
+	//Special GetLastResponseView for app context getters. It doesn't print 404 code as error, but debug. Falls back to the raw server response.
+	FAnsiStringView GetResponseViewForGetObject(pubnub_t* context);
 	
 	//Returns FString from the pubnub_get_channel response
 	FString GetLastChannelResponse(pubnub_t* context);
 
+	//Waits for one attempt of the transaction started by StartTransaction (which returns pubnub_res of the start) and returns its pubnub_res.
+	//OutRetryDelaySeconds (if given) is set to the delay before the next retry allowed by RetryConfig for Endpoint, or to -1 if there shouldn't be one
+	int AwaitAttempt_priv(pubnub_t* Context, EPubnubRetryEndpoint Endpoint, TFunctionRef<int()> StartTransaction, int32 RetriesDone, float* OutRetryDelaySeconds);
+	//Calls Attempt(RetriesDone, OutRetryDelaySeconds) until it doesn't ask for a retry. Delays are waited on the calling thread, used by sync functions
+	template<typename ResultType>
+	ResultType RunWithRetry_priv(TFunctionRef<ResultType(int32, float*)> Attempt);
+	//Queues Attempt on the calls thread. Retry is queued again by a one-shot ticker after its delay, so no thread waits for it.
+	//Attempt is called only while the client exists. OnFinished is called with the result of the last attempt
+	template<typename ResultType>
+	void RunWithRetryAsync_priv(EPubnubOperationClass OperationClass, TFunction<ResultType(int32, float*)> Attempt, TFunction<void(const ResultType&)> OnFinished, int32 RetriesDone = 0);
+
 	void AttachCCoreLogger();
+	//Pushes the most verbose C-Core level accepted by any logger down to all C-Core contexts, if it changed (or always, if bForce is true)
+	void SyncCCoreLogLevel(bool bForce = false);
 	
 	void InitPubnub_priv(const FPubnubConfig& Config);
+	//Applies keep-alive, timeouts and DNS servers to the context. Subscribe context keeps its own (long-poll) transaction timeout
+	void ApplyNetworkingConfig_priv(pubnub_t* Context, const FPubnubNetworkingConfig& NetworkingConfig, bool bIsSubscribeContext);
 	void SetUserID_priv(FString UserID);
 	FString GetUserID_priv();
 	void SetSecretKey_priv();
-	FPubnubPublishMessageResult PublishMessage_priv(FString Channel, FString Message, FPubnubPublishSettings PublishSettings = FPubnubPublishSettings());
-	FPubnubSignalResult Signal_priv(FString Channel, FString Message, FPubnubSignalSettings SignalSettings = FPubnubSignalSettings());
+	FPubnubPublishMessageResult PublishMessage_priv(FString Channel, FString Message, FPubnubPublishSettings PublishSettings = FPubnubPublishSettings(), int32 RetriesDone = 0, float* OutRetryDelaySeconds = nullptr);
+	TArray<FPubnubPublishMessageResult> PublishBatch_priv(const TArray<FPubnubPublishRequest>& Requests);
+	//Starts publish transaction on given context without waiting for it. OutTransaction has to be kept alive until the transaction finishes.
+	//Returns false and fills OutErrorResult if the transaction couldn't be started
+	bool StartPublish_priv(pubnub_t* Context, const FPubnubPublishRequest& Request, TUniquePtr<FPubnubInternalPublishTransaction>& OutTransaction, FPubnubPublishMessageResult& OutErrorResult);
+	//Fills publish result from the context after its publish transaction has finished
+	FPubnubPublishMessageResult FinishPublish_priv(pubnub_t* Context, const FPubnubPublishRequest& Request);
+	FPubnubSignalResult Signal_priv(FString Channel, FString Message, FPubnubSignalSettings SignalSettings = FPubnubSignalSettings(), int32 RetriesDone = 0, float* OutRetryDelaySeconds = nullptr);
 	FPubnubOperationResult SubscribeToChannel_priv(FString Channel, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
 	FPubnubOperationResult SubscribeToGroup_priv(FString ChannelGroup, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
 	FPubnubOperationResult UnsubscribeFromChannel_priv(FString Channel);
 	FPubnubOperationResult UnsubscribeFromGroup_priv(FString ChannelGroup);
 	FPubnubOperationResult UnsubscribeFromAll_priv();
+	FPubnubOperationResult UpdateSubscriptions_priv(TArray<FString> ChannelsToAdd, TArray<FString> ChannelGroupsToAdd, TArray<FString> ChannelsToRemove, TArray<FString> ChannelGroupsToRemove, FPubnubSubscribeSettings SubscribeSettings = FPubnubSubscribeSettings());
 	FPubnubOperationResult AddChannelToGroup_priv(FString Channel, FString ChannelGroup);
 	FPubnubOperationResult RemoveChannelFromGroup_priv(FString Channel, FString ChannelGroup);
 	FPubnubListChannelsFromGroupResult ListChannelsFromGroup_priv(FString ChannelGroup);
@@ -2807,12 +3234,13 @@ private:
 	FPubnubGrantTokenResult GrantToken_priv(FString PermissionObject);
 	FPubnubOperationResult RevokeToken_priv(FString Token);
 	FString ParseToken_priv(FString Token);
+	bool HasPermission_priv(const FString& Token, EPubnubTokenResourceType ResourceType, const FString& ResourceID, EPubnubTokenPermission Permission);
 	void SetAuthToken_priv(FString Token);
 	int SetOrigin_priv(FString Origin);
 	void SetRuntimeSdkVersionSuffix_priv(FString Suffix);
-	FPubnubFetchHistoryResult FetchHistory_priv(FString Channel, FPubnubFetchHistorySettings FetchHistorySettings = FPubnubFetchHistorySettings());
+	FPubnubFetchHistoryResult FetchHistory_priv(FString Channel, FPubnubFetchHistorySettings FetchHistorySettings = FPubnubFetchHistorySettings(), int32 RetriesDone = 0, float* OutRetryDelaySeconds = nullptr);
 	FPubnubOperationResult DeleteMessages_priv(FString Channel, FPubnubDeleteMessagesSettings DeleteMessagesSettings);
-	FPubnubMessageCountsResult MessageCounts_priv(FString Channel, FString Timetoken);
+	FPubnubMessageCountsResult MessageCounts_priv(FString Channel, FString Timetoken, int32 RetriesDone = 0, float* OutRetryDelaySeconds = nullptr);
 	FPubnubMessageCountsMultipleResult MessageCountsMultiple_priv(TArray<FString> Channels, TArray<FString> Timetokens);
 	FPubnubGetAllUserMetadataResult GetAllUserMetadata_priv(FString Include, int Limit, FString Filter, FString Sort, FPubnubPage Page, EPubnubTribool Count);
 	FPubnubUserMetadataResult SetUserMetadata_priv(FString User, FString UserMetadataObj, FString Include);
@@ -2851,6 +3279,8 @@ private:
 	TObjectPtr<UPubnubDefaultLogger> DefaultLogger = nullptr;
 
 	pubnub_logger_t* CCoreLogger = nullptr;
+	//Minimum level currently set on C-Core contexts. PLL_None until the logger is attached
+	EPubnubLogLevel AppliedCCoreLogLevel = EPubnubLogLevel::PLL_None;
 };
 
 
@@ -135,4 +135,46 @@ enum class EPubnubEntityType : uint8
 	PEnT_ChannelGroup			UMETA(DisplayName="ChannelGroup"),
 	PEnT_ChannelMetadata		UMETA(DisplayName="ChannelMetadata"),
 	PEnT_UserMetadata			UMETA(DisplayName="UserMetadata"),
-};
\ No newline at end of file
+};
+
+UENUM(BlueprintType)
+enum class EPubnubTokenResourceType : uint8
+{
+	PTRT_Channel				UMETA(DisplayName="Channel"),
+	PTRT_ChannelGroup			UMETA(DisplayName="ChannelGroup"),
+	PTRT_User					UMETA(DisplayName="User"),
+};
+
+UENUM(BlueprintType)
+enum class EPubnubTokenPermission : uint8
+{
+	PTP_Read					UMETA(DisplayName="Read"),
+	PTP_Write					UMETA(DisplayName="Write"),
+	PTP_Manage					UMETA(DisplayName="Manage"),
+	PTP_Delete					UMETA(DisplayName="Delete"),
+	PTP_Get						UMETA(DisplayName="Get"),
+	PTP_Update					UMETA(DisplayName="Update"),
+	PTP_Join					UMETA(DisplayName="Join"),
+};
+
+UENUM(BlueprintType)
+enum class EPubnubRetryPolicy : uint8
+{
+	//Failed requests are not retried
+	PRP_None					UMETA(DisplayName="None"),
+	//Every retry waits the same delay
+	PRP_Linear					UMETA(DisplayName="Linear"),
+	//Delay doubles with every retry, up to the maximum delay
+	PRP_Exponential				UMETA(DisplayName="Exponential"),
+};
+
+UENUM(BlueprintType)
+enum class EPubnubRetryEndpoint : uint8
+{
+	//Publish and signal. Retried only if the request wasn't sent or got HTTP 429, so a message is never published twice
+	PRE_MessageSend				UMETA(DisplayName="MessageSend"),
+	//Subscribe loop reconnection
+	PRE_Subscribe				UMETA(DisplayName="Subscribe"),
+	//Fetch history and message counts
+	PRE_MessageStorage			UMETA(DisplayName="MessageStorage"),
+};
@@ -0,0 +1,74 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Crc.h"
+
+/**
+ * Helpers for maps keyed by PubNub names (channels, groups, users, token resources).
+ * Those names are case-sensitive, but FString keys of TMap/TSet are compared and hashed case-insensitively.
+ */
+namespace PubnubKeyFuncs
+{
+	//Same hash for a string and a view of the same characters, so maps can be searched by a part of a string without copying it
+	inline uint32 CaseSensitiveHash(FStringView Key)
+	{
+		return FCrc::MemCrc32(Key.GetData(), Key.Len() * sizeof(TCHAR));
+	}
+
+	inline uint32 CaseSensitiveHash(const FString& Key)
+	{
+		return CaseSensitiveHash(FStringView(Key));
+	}
+
+	inline bool CaseSensitiveEquals(const FString& A, const FString& B)
+	{
+		return A.Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	inline bool CaseSensitiveEquals(const FString& A, FStringView B)
+	{
+		return FStringView(A).Equals(B, ESearchCase::CaseSensitive);
+	}
+
+	template<typename FirstType>
+	uint32 CaseSensitiveHash(const TPair<FirstType, FString>& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Key), CaseSensitiveHash(Key.Value));
+	}
+
+	template<typename FirstType>
+	bool CaseSensitiveEquals(const TPair<FirstType, FString>& A, const TPair<FirstType, FString>& B)
+	{
+		return A.Key == B.Key && CaseSensitiveEquals(A.Value, B.Value);
+	}
+}
+
+/**
+ * TMap key funcs comparing string keys case-sensitively. Works with FString keys and with TPair<Any, FString> keys.
+ * Usage: TMap<FString, ValueType, FDefaultSetAllocator, TPubnubCaseSensitiveKeyFuncs<FString, ValueType>>
+ * Maps with FString keys can also be searched with FindByHash(PubnubKeyFuncs::CaseSensitiveHash(View), View).
+ */
+template<typename KeyType, typename ValueType>
+struct TPubnubCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<KeyType, ValueType>, KeyType, false>
+{
+	using KeyInitType = typename BaseKeyFuncs<TPair<KeyType, ValueType>, KeyType, false>::KeyInitType;
+	using ElementInitType = typename BaseKeyFuncs<TPair<KeyType, ValueType>, KeyType, false>::ElementInitType;
+
+	static FORCEINLINE KeyInitType GetSetKey(ElementInitType Element)
+	{
+		return Element.Key;
+	}
+
+	template<typename ComparableKey>
+	static FORCEINLINE bool Matches(KeyInitType A, const ComparableKey& B)
+	{
+		return PubnubKeyFuncs::CaseSensitiveEquals(A, B);
+	}
+
+	static FORCEINLINE uint32 GetKeyHash(KeyInitType Key)
+	{
+		return PubnubKeyFuncs::CaseSensitiveHash(Key);
+	}
+};
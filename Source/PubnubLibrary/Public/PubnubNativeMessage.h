@@ -0,0 +1,177 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/RefCounting.h"
+#include "PubnubEnumLibrary.h"
+#include "PubnubStructLibrary.h"
+#include <atomic>
+
+class FPubnubNameTable;
+class FPubnubMessageArena;
+
+/**
+ * Name (channel, user, group, custom message type) interned in FPubnubNameTable.
+ * Copying and comparing it is a pointer operation and it never allocates. Unlike FName, it's case-sensitive,
+ * same as PubNub names, so "Lobby" and "lobby" are two different names.
+ */
+struct PUBNUBLIBRARY_API FPubnubInternedName
+{
+	//Interned string. Stays valid for the lifetime of the program
+	const FString& ToString() const { return Name ? *Name : EmptyName; }
+	bool IsEmpty() const { return !Name; }
+
+	bool operator==(const FPubnubInternedName& Other) const { return Name == Other.Name; }
+	bool operator!=(const FPubnubInternedName& Other) const { return Name != Other.Name; }
+	friend uint32 GetTypeHash(const FPubnubInternedName& InternedName) { return ::PointerHash(InternedName.Name); }
+
+private:
+
+	friend class FPubnubNameTable;
+
+	const FString* Name = nullptr;
+	static const FString EmptyName;
+};
+
+/**
+ * Process-wide table of interned PubNub names. Names are interned straight from UTF-8 bytes received from C-Core,
+ * so a name that was seen before costs a hash and a read lock, without any allocation.
+ * Entries are never removed - it's meant for names that repeat (channels, groups, publishers), not for unique payload values.
+ */
+class PUBNUBLIBRARY_API FPubnubNameTable
+{
+public:
+
+	static FPubnubNameTable& Get();
+
+	FPubnubNameTable() = default;
+	~FPubnubNameTable();
+	FPubnubNameTable(const FPubnubNameTable&) = delete;
+	FPubnubNameTable& operator=(const FPubnubNameTable&) = delete;
+
+	//Returns interned name for given UTF-8 string, adding it to the table if needed. Empty string gives an empty name. Can be called from any thread
+	FPubnubInternedName Intern(FAnsiStringView Utf8Name);
+	FPubnubInternedName Intern(const FString& Name);
+
+	int32 Num() const;
+
+private:
+
+	struct FEntry
+	{
+		TArray<ANSICHAR> Utf8Name;
+		FString Name;
+	};
+
+	//Caller has to hold the lock
+	const FEntry* Find_priv(uint32 Hash, FAnsiStringView Utf8Name) const;
+
+	mutable FRWLock Lock;
+	//Entries are never moved or freed while the table exists, so interned names can point at them without a lock
+	TMultiMap<uint32, FEntry*> EntriesByHash;
+};
+
+/**
+ * Reference-counted memory block of FPubnubMessageArena. Raw UTF-8 payload and metadata of a received message
+ * are copied into one block, and the message keeps views into it. Goes back to its arena when the last reference is released.
+ */
+class PUBNUBLIBRARY_API FPubnubMessageArenaBlock
+{
+public:
+
+	FPubnubMessageArenaBlock(const FPubnubMessageArenaBlock&) = delete;
+	FPubnubMessageArenaBlock& operator=(const FPubnubMessageArenaBlock&) = delete;
+
+	uint32 AddRef() const;
+	uint32 Release() const;
+	uint32 GetRefCount() const { return RefCount.load(std::memory_order_relaxed); }
+
+	//Copies given bytes after the ones added before and returns view of the copy. Can't add more than the capacity the block was acquired with
+	FAnsiStringView Append(FAnsiStringView Bytes);
+
+	int32 GetCapacity() const { return Data.Max(); }
+
+private:
+
+	friend class FPubnubMessageArena;
+
+	FPubnubMessageArenaBlock() = default;
+
+	TArray<ANSICHAR> Data;
+	mutable std::atomic<uint32> RefCount{0};
+	//Arena the block goes back to. Set only while the block is in use, so free blocks don't keep their arena alive
+	mutable TSharedPtr<FPubnubMessageArena, ESPMode::ThreadSafe> Arena;
+};
+
+/**
+ * Pool of FPubnubMessageArenaBlock used by C-Core subscribe listeners. Released blocks keep their memory and are reused
+ * by the next messages, so after a short warm-up receiving a message doesn't allocate for its payload.
+ * Thread-safe: blocks are acquired on C-Core threads and released on the game thread.
+ */
+class PUBNUBLIBRARY_API FPubnubMessageArena : public TSharedFromThis<FPubnubMessageArena, ESPMode::ThreadSafe>
+{
+public:
+
+	//Blocks bigger than this are freed when released, so one huge message doesn't keep its memory in the pool
+	static constexpr int32 MaxPooledBlockSize = 8 * 1024;
+
+	explicit FPubnubMessageArena(int32 InMaxFreeBlocks);
+	~FPubnubMessageArena();
+
+	FPubnubMessageArena(const FPubnubMessageArena&) = delete;
+	FPubnubMessageArena& operator=(const FPubnubMessageArena&) = delete;
+
+	//Returns empty block that can hold at least Capacity bytes. Arena has to be owned by a thread-safe TSharedPtr
+	TRefCountPtr<FPubnubMessageArenaBlock> Acquire(int32 Capacity);
+
+	int32 NumFreeBlocks() const;
+
+private:
+
+	friend class FPubnubMessageArenaBlock;
+
+	void ReturnBlock(FPubnubMessageArenaBlock* Block);
+
+	mutable FCriticalSection FreeBlocksMutex;
+	TArray<FPubnubMessageArenaBlock*> FreeBlocks;
+	int32 NumFree = 0;
+	int32 MaxFreeBlocks = 0;
+};
+
+/**
+ * Native-only form of a received message. Names are interned, timetoken is a number and payload with metadata
+ * are raw UTF-8 JSON views into one pooled arena block, so receiving it doesn't create any FString.
+ * FPubnubMessageData for Blueprints and older delegates is built from it only when something needs it (ToMessageData).
+ * Views stay valid as long as any copy of the message exists.
+ */
+struct PUBNUBLIBRARY_API FPubnubNativeMessage
+{
+	//Message payload as JSON, exactly as it was published
+	FAnsiStringView Payload;
+	//Message metadata as JSON, empty if there is none
+	FAnsiStringView Metadata;
+	FPubnubInternedName Channel;
+	FPubnubInternedName UserID;
+	FPubnubInternedName CustomMessageType;
+	//Subscription match or the channel group
+	FPubnubInternedName MatchOrGroup;
+	//Time token of the message - when it was published. 0 if the message didn't have one
+	int64 Timetoken = 0;
+	EPubnubMessageType MessageType = EPubnubMessageType::PMT_Published;
+	//Presence event, received on "<channel>-pnpres"
+	bool bIsPresenceEvent = false;
+	//Keeps Payload and Metadata alive
+	TRefCountPtr<FPubnubMessageArenaBlock> Block;
+
+	//Payload converted to the message string, the same way FPubnubMessageData::Message is
+	FString GetMessageString() const;
+	FString GetTimetokenString() const;
+
+	//Builds Blueprint message struct with the same values as UPubnubUtilities::UEMessageFromPubnubMessage gives
+	FPubnubMessageData ToMessageData() const;
+
+	//Parses decimal timetoken. Returns 0 if it's not a valid timetoken
+	static int64 ParseTimetoken(FAnsiStringView Timetoken);
+};
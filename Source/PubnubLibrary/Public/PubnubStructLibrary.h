@@ -30,6 +30,124 @@ struct FPubnubLoggerConfig
 	 */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Logger")
 	TArray<UObject*> InitialLoggers;
+
+	/**
+	 * If true, log messages are queued and passed to loggers in batches by a background thread,
+	 * so logging never blocks the thread that logs. Loggers are then called from that background thread.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Logger")
+	bool bEnableAsyncLogging = false;
+
+	/**
+	 * Maximum number of log messages waiting for the background thread when async logging is enabled.
+	 * When the queue is full, Warning and Error messages wait for a free slot and less important messages are dropped.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Logger", meta = (ClampMin = "64"))
+	int AsyncLogQueueCapacity = 4096;
+};
+
+/**
+ * Network tuning of the C-Core contexts, applied to every context during client initialization.
+ * Zero or empty values keep C-Core defaults.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubNetworkingConfig
+{
+	GENERATED_BODY()
+
+	/**
+	 * If true, connections stay open between transactions, so following requests skip the TCP and TLS handshake.
+	 * Turn it off only if the network closes idle connections in a way that makes requests fail.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking")
+	bool bUseHttpKeepAlive = true;
+
+	/** If true, TCP keep-alive probes are sent on idle connections, so a dropped connection is detected before the next request is sent on it. Works only with bUseHttpKeepAlive. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking")
+	bool bUseTcpKeepAlive = true;
+
+	/** Time in seconds a connection has to be idle before the first TCP keep-alive probe is sent. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking", meta = (ClampMin = "1", ClampMax = "255", EditCondition = "bUseTcpKeepAlive"))
+	int TcpKeepAliveIdleSeconds = 60;
+
+	/** Time in seconds between TCP keep-alive probes that were not acknowledged. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking", meta = (ClampMin = "1", ClampMax = "255", EditCondition = "bUseTcpKeepAlive"))
+	int TcpKeepAliveIntervalSeconds = 20;
+
+	/** Number of unacknowledged TCP keep-alive probes after which the connection is considered broken. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking", meta = (ClampMin = "1", ClampMax = "255", EditCondition = "bUseTcpKeepAlive"))
+	int TcpKeepAliveProbes = 3;
+
+	/**
+	 * Time limit in milliseconds of a single non-subscribe request (publish, history, App Context, etc.). 0 keeps C-Core default.
+	 * C-Core doesn't accept values below 10000. Subscribe is a long-poll request and always keeps its own timeout.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking", meta = (ClampMin = "0"))
+	int TransactionTimeoutMs = 0;
+
+	/** Time limit in milliseconds for opening a TCP connection. 0 keeps C-Core default. C-Core doesn't accept values below 5000. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking", meta = (ClampMin = "0"))
+	int WaitConnectTimeoutMs = 0;
+
+	/** IPv4 address ("numbers-and-dots") of the DNS server used to resolve the origin. Empty keeps C-Core default. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking")
+	FString PrimaryDnsServer = "";
+
+	/** IPv4 address of the DNS server used when a query to the primary one fails. Empty keeps C-Core default. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking")
+	FString SecondaryDnsServer = "";
+};
+
+/**
+ * Policy of retrying requests that failed because of the network or a temporary server error (HTTP 429 and 5xx).
+ * Every delay gets a random jitter, so clients that lost connection at the same time don't retry all at once.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubRetryConfig
+{
+	GENERATED_BODY()
+
+	/** How delays between retries grow. None turns retrying off. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry")
+	EPubnubRetryPolicy Policy = EPubnubRetryPolicy::PRP_None;
+
+	/** Delay in seconds before every retry with Linear policy, and before the first one with Exponential policy. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry", meta = (ClampMin = "0.1"))
+	float DelaySeconds = 2.0f;
+
+	/** Longest delay in seconds between retries with Exponential policy. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry", meta = (ClampMin = "0.1"))
+	float MaximumDelaySeconds = 150.0f;
+
+	/** Random time from 0 up to this many seconds added to every delay. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry", meta = (ClampMin = "0"))
+	float JitterSeconds = 1.0f;
+
+	/** Maximum number of retries of a single request. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry", meta = (ClampMin = "1", ClampMax = "10"))
+	int MaxRetries = 6;
+
+	/** Endpoints that are never retried, even if the policy is set. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry")
+	TArray<EPubnubRetryEndpoint> ExcludedEndpoints;
+};
+
+/**
+ * Counters of requests sent by non-subscribe operations and of connections opened for them, since client initialization.
+ * ConnectionsOpened much lower than RequestsSent means connections are reused between requests.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubConnectionStats
+{
+	GENERATED_BODY()
+
+	/** Number of requests sent on pooled contexts. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Networking")
+	int64 RequestsSent = 0;
+
+	/** Number of requests that had to open a new connection, as no open one was kept from the previous request on the same context. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Networking")
+	int64 ConnectionsOpened = 0;
 };
 
 /**
@@ -67,6 +185,64 @@ struct FPubnubConfig
 	 * Do not enable this in shipped game clients.
 	 */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Server Only") bool SetSecretKeyAutomatically = false;
+	/**
+	 * Number of C-Core contexts shared by Sync (non-Async) calls of non-subscribe operations (publish, history, App Context, presence, etc.).
+	 * Each context runs one operation at a time, so this is how many such Sync calls can be in flight at once.
+	 * Every context keeps its own connection to PubNub.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "1", ClampMax = "32")) int ContextPoolSize = 2;
+	/**
+	 * Time in milliseconds that a Sync call waits for a free context when ContextPoolSize calls are already in flight.
+	 * The call fails with an error only if no context is released within this time. 0 fails right away.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0")) int ContextAcquireTimeoutMs = 2000;
+	/**
+	 * Number of worker threads executing Async calls. Every worker has its own C-Core context, in addition to ContextPoolSize.
+	 * Operations of the same kind (publish, history, App Context, presence) start in the order they were called
+	 * and different kinds run in parallel on different workers.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "1", ClampMax = "16")) int AsyncWorkerCount = 3;
+	/**
+	 * Maximum number of Async operations of the same kind (publish, history, App Context, presence) running at once. 0 means up to AsyncWorkerCount.
+	 * 1 runs operations of one kind strictly one after another, so e.g. publishes reach PubNub in the order they were called.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0", ClampMax = "16")) int MaxConcurrentOperationsPerKind = 0;
+	/**
+	 * Maximum number of received messages and events broadcast on the game thread in a single frame.
+	 * Messages above the budget stay queued and are delivered in the following frames, so a burst doesn't cause a frame spike. 0 means no limit.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0")) int MessageDeliveryBudgetPerFrame = 1000;
+	/**
+	 * Capacity of the queue holding received messages until they are delivered on the game thread.
+	 * When it's full (the game thread doesn't keep up), newly received messages are dropped and a warning with their count is logged.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "64")) int ReceivedMessageQueueCapacity = 8192;
+	/**
+	 * Time in milliseconds that Async subscribe and unsubscribe calls wait for each other.
+	 * All calls made within this window are applied as a single change of the subscribe loop. 0 applies every call on its own.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0")) int SubscriptionCoalescingWindowMs = 20;
+	/** Maximum number of parsed access tokens kept by HasPermission, so a token is parsed only once. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "1")) int TokenCacheCapacity = 256;
+	/**
+	 * Maximum number of released subscriptions (UPubnubSubscription::Release) kept by the client for reuse.
+	 * CreateSubscription takes a matching one from this pool instead of creating new objects. 0 disables the pool.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0")) int SubscriptionPoolCapacity = 256;
+	/** Maximum number of C-Core entities kept between subscriptions, so subscribing to the same channel again doesn't allocate it again. 0 disables the cache. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub", meta = (ClampMin = "0")) int EntityCacheCapacity = 1024;
+	/**
+	 * If true, messages published with the default SendViaGET method are sent with POST and GZIP compressed body
+	 * once they reach PublishCompressionThresholdBytes. Large JSON payloads are then neither URL-encoded nor sent uncompressed.
+	 * Messages that don't compress well are sent with plain POST. Explicitly set PublishMethod of FPubnubPublishSettings is always kept.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Publish") bool CompressLargePublishes = false;
+	/** Size in bytes of the serialized (UTF-8) message from which CompressLargePublishes applies. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Publish", meta = (ClampMin = "0", EditCondition = "CompressLargePublishes")) int PublishCompressionThresholdBytes = 2048;
+	/** Keep-alive, timeouts and DNS servers of the C-Core contexts. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Networking") FPubnubNetworkingConfig NetworkingConfig;
+	/** Retrying of requests that failed because of the network or a temporary server error. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Retry") FPubnubRetryConfig RetryConfig;
 	/** Logger setup used during client initialization. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub|Logger") FPubnubLoggerConfig LoggerConfig;
 	
@@ -108,6 +284,19 @@ struct FPubnubPublishSettings
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FString CustomMessageType = "";
 };
 
+USTRUCT(BlueprintType)
+struct FPubnubPublishRequest
+{
+	GENERATED_BODY()
+
+	/** The channel to publish the message to. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FString Channel = "";
+	/** The message to publish. Can be any string or a JSON object/array. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FString Message = "";
+	/** Optional settings for this publish. */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FPubnubPublishSettings PublishSettings;
+};
+
 USTRUCT(BlueprintType)
 struct FPubnubSignalSettings
 {
@@ -126,6 +315,12 @@ struct FPubnubSubscribeSettings
 
 	/** Whether presence events should be received or not. */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") bool ReceivePresenceEvents = false;
+	/**
+	 * Server-side filter expression evaluated against meta of published messages, e.g. "region == 'eu' && level > 10".
+	 * Messages not matching the expression are not sent to the client at all. Empty keeps the filter expression the client already uses.
+	 * Note: there is one filter expression per client subscribe loop, so setting it here changes it for all subscriptions of the client.
+	 */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FString FilterExpression = "";
 };
 
 USTRUCT(BlueprintType)
@@ -978,6 +1173,8 @@ struct FPubnubSubscriptionStatusData
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") TArray<FString> Channels;
 	/** All currently subscribed channel groups */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") TArray<FString> ChannelGroups;
+	/** Number of automatic reconnection attempts since the subscribe loop was last connected. See RetryConfig of FPubnubConfig */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") int RetryCount = 0;
 	
 };
 
@@ -992,6 +1189,8 @@ struct FPubnubOperationResult
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") bool Error = false;
 	/**In case of error should contain useful information about the error */
 	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") FString ErrorMessage = "";
+	/**Number of times the request was retried according to RetryConfig of FPubnubConfig */
+	UPROPERTY(BlueprintReadWrite, VisibleAnywhere, Category = "Pubnub") int RetryCount = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -1021,6 +1220,31 @@ struct FPubnubLogMessage
 	FString PubnubInstanceID = "";
 };
 
+/**
+ * Counters of the asynchronous log pipeline. All values are totals since async logging was enabled.
+ */
+USTRUCT(BlueprintType)
+struct FPubnubAsyncLogStats
+{
+	GENERATED_BODY()
+
+	/** Messages accepted into the queue. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Logger")
+	int64 EnqueuedCount = 0;
+
+	/** Messages passed to loggers by the background thread. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Logger")
+	int64 DispatchedCount = 0;
+
+	/** Messages dropped because the queue was full: Trace, Debug and Info right away, Warning and Error after waiting too long for a free slot. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Logger")
+	int64 DroppedCount = 0;
+
+	/** Warning and Error messages that had to wait for a free slot because the queue was full. */
+	UPROPERTY(BlueprintReadOnly, VisibleAnywhere, Category = "Pubnub|Logger")
+	int64 BackpressureCount = 0;
+};
+
 USTRUCT(BlueprintType)
 struct FPubnubEncryptedData
 {
@@ -0,0 +1,202 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "PubnubStructLibrary.h"
+#include <atomic>
+
+class FEvent;
+struct pubnub_;
+typedef struct pubnub_ pubnub_t;
+
+/**
+ * Fixed-size pool of synchronous (PNA_SYNC) C-Core contexts used for all non-subscribe operations.
+ *
+ * Every context can run only one transaction at a time, so it's marked as in use while checked out.
+ * Operations check a context out with TryAcquire (or Acquire, which waits for a busy pool) and give it back with Release
+ * (see FPubnubContextLease), which lets as many operations be in flight as there are contexts in the pool.
+ * Code that has to wait for all in-flight operations (deinitialization) uses LockAll/UnlockAll
+ * (see FPubnubContextPoolExclusiveLock). While the pool is locked, TryAcquire fails.
+ *
+ * Auth token is published to the pool without waiting for in-flight operations: idle contexts are switched right away,
+ * busy ones when they are released. Every context remembers the generation of the token it points to,
+ * so the owner knows when an old token buffer isn't referenced anymore (GetOldestAuthTokenGeneration).
+ *
+ * Besides the shared contexts, the pool can hold reserved contexts - one per FPubnubFunctionThread worker.
+ * A reserved context is only handed out to the thread it's bound to (BindReservedContextToCurrentThread),
+ * so Async operations never compete with Sync calls for the shared contexts.
+ *
+ * Operations report every request they start (RecordRequest), which tells how often the pool's keep-alive connections are reused.
+ */
+class PUBNUBLIBRARY_API FPubnubContextPool
+{
+public:
+
+	explicit FPubnubContextPool(int32 InSharedPoolSize, int32 InReservedPoolSize = 0);
+	~FPubnubContextPool();
+
+	FPubnubContextPool(const FPubnubContextPool&) = delete;
+	FPubnubContextPool& operator=(const FPubnubContextPool&) = delete;
+
+	//Allocates and initializes all contexts of the pool. Keys have to stay alive for the lifetime of the contexts
+	bool AllocateContexts(const char* PublishKey, const char* SubscribeKey);
+	//Frees all contexts of the pool. Caller has to hold LockAll, so no operation is using any of them
+	void FreeContexts();
+
+	//Cancels transactions on all contexts, so threads blocked in pubnub_await can return quickly. Threads waiting in Acquire give up
+	void CancelAll();
+
+	//Checks out a free context - reserved context of the current thread if it has one, otherwise a shared one. Returns INDEX_NONE if every context is busy
+	int32 TryAcquire();
+	/**
+	 * Same as TryAcquire, but if every context is busy waits up to TimeoutMs for one to be released.
+	 * Returns INDEX_NONE right away while the pool is locked, and when CancelAll is called during the wait.
+	 */
+	int32 Acquire(uint32 TimeoutMs);
+	//Returns context checked out with TryAcquire back to the pool
+	void Release(int32 SlotIndex);
+
+	//Blocks until every context is free and keeps all of them locked until UnlockAll
+	void LockAll();
+	void UnlockAll();
+
+	//Binds reserved context with given index to the calling thread. INDEX_NONE unbinds it
+	void BindReservedContextToCurrentThread(int32 ReservedIndex);
+
+	/**
+	 * Points all contexts at given auth token. C-Core keeps only the pointer, so the token has to stay alive
+	 * until GetOldestAuthTokenGeneration is greater than Generation. Generations have to grow with every call.
+	 */
+	void PublishAuthToken(const char* AuthToken, uint64 Generation);
+	//Lowest auth token generation that any allocated context may still point to. 0 if some context never got a token
+	uint64 GetOldestAuthTokenGeneration();
+
+	//Calls given function for every allocated context. Meant for setters that have to be applied to the whole pool
+	void ForEachContext(TFunctionRef<void(pubnub_t*)> Function) const;
+
+	//Counts a request that is about to be started on given context, and a new connection if the context has none open. Lock-free
+	void RecordRequest(pubnub_t* Context);
+	FPubnubConnectionStats GetConnectionStats() const;
+	void ResetConnectionStats();
+
+	pubnub_t* GetContext(int32 SlotIndex) const;
+	//Context used for getters of values that are the same on every context (user id, origin, etc.)
+	pubnub_t* GetPrimaryContext() const { return GetContext(0); }
+
+	int32 Num() const { return Slots.Num(); }
+	int32 NumReserved() const { return Slots.Num() - SharedPoolSize; }
+
+private:
+
+	struct FContextSlot
+	{
+		pubnub_t* Context = nullptr;
+		bool bInUse = false;
+		uint64 AuthTokenGeneration = 0;
+	};
+
+	//Switches context of the slot to the latest published auth token. Caller has to hold PoolMutex
+	void ApplyAuthToken(FContextSlot& Slot);
+	//Checks out a free slot without looking at LockCount. Caller has to hold PoolMutex
+	int32 AcquireFreeSlot_priv();
+	//True if any shared context is free. Caller has to hold PoolMutex
+	bool HasFreeSharedSlot_priv() const;
+
+	//FCriticalSection is recursive, so it can't be used per slot - the same thread would be able to check out one context twice
+	//Shared contexts first, reserved contexts after them
+	TArray<FContextSlot> Slots;
+	int32 SharedPoolSize = 1;
+	//Guards bInUse flags and LockCount
+	FCriticalSection PoolMutex;
+	//Serializes LockAll callers
+	FCriticalSection ExclusiveMutex;
+	int32 LockCount = 0;
+	//Triggered on every Release, so LockAll and Acquire can wait for in-flight operations without polling.
+	//Auto-reset, so a waiter that can't use the wake-up, or that took a context while another one is still free, passes it on with another Trigger
+	FEvent* ContextReleasedEvent = nullptr;
+	//Incremented by CancelAll, so threads waiting in Acquire know they should give up. Guarded by PoolMutex
+	uint32 CancelGeneration = 0;
+	//Latest published auth token (owned by the caller of PublishAuthToken). Guarded by PoolMutex
+	const char* AuthToken = nullptr;
+	uint64 AuthTokenGeneration = 0;
+	std::atomic<int64> RequestsSent{0};
+	std::atomic<int64> ConnectionsOpened{0};
+};
+
+/**
+ * RAII checkout of a single context from FPubnubContextPool.
+ *
+ * Constructed in two phases (construct + TryAcquire) so it can be declared at function scope by
+ * the PUBNUB_ACQUIRE_CONTEXT_* macros (PubnubInternalMacros.h). If TryAcquire succeeds, the context
+ * is returned to the pool when the enclosing function returns - after the post-pubnub_await
+ * result accessors - so DeinitializeClient can safely free the pool under LockAll.
+ */
+struct FPubnubContextLease
+{
+	explicit FPubnubContextLease(FPubnubContextPool* InPool)
+		: Pool(InPool)
+	{
+	}
+
+	~FPubnubContextLease()
+	{
+		if (Pool && SlotIndex != INDEX_NONE)
+		{
+			Pool->Release(SlotIndex);
+		}
+	}
+
+	//Waits up to TimeoutMs for a context if every one is busy. 0 doesn't wait
+	bool TryAcquire(uint32 TimeoutMs = 0)
+	{
+		if (!Pool)
+		{
+			return false;
+		}
+		SlotIndex = TimeoutMs > 0 ? Pool->Acquire(TimeoutMs) : Pool->TryAcquire();
+		return SlotIndex != INDEX_NONE;
+	}
+
+	pubnub_t* Get() const
+	{
+		return SlotIndex != INDEX_NONE ? Pool->GetContext(SlotIndex) : nullptr;
+	}
+
+	FPubnubContextLease(const FPubnubContextLease&) = delete;
+	FPubnubContextLease& operator=(const FPubnubContextLease&) = delete;
+
+private:
+	FPubnubContextPool* Pool = nullptr;
+	int32 SlotIndex = INDEX_NONE;
+};
+
+/**
+ * Scope lock waiting for all in-flight operations of FPubnubContextPool and blocking new ones until released.
+ */
+struct FPubnubContextPoolExclusiveLock
+{
+	explicit FPubnubContextPoolExclusiveLock(FPubnubContextPool* InPool)
+		: Pool(InPool)
+	{
+		if (Pool)
+		{
+			Pool->LockAll();
+		}
+	}
+
+	~FPubnubContextPoolExclusiveLock()
+	{
+		if (Pool)
+		{
+			Pool->UnlockAll();
+		}
+	}
+
+	FPubnubContextPoolExclusiveLock(const FPubnubContextPoolExclusiveLock&) = delete;
+	FPubnubContextPoolExclusiveLock& operator=(const FPubnubContextPoolExclusiveLock&) = delete;
+
+private:
+	FPubnubContextPool* Pool = nullptr;
+};
@@ -5,42 +5,105 @@
 #include "CoreMinimal.h"
 #include "HAL/Runnable.h"
 #include "HAL/RunnableThread.h"
+#include "Containers/Queue.h"
+
+class FEvent;
+class FPubnubContextPool;
+
+/**
+ * Class of the operation queued on FPubnubFunctionThread. Every class has its own FIFO queue. Functions of one class
+ * start in the order they were queued and by default as many of them as there are workers can run at once.
+ * Capping a class to 1 (SetMaxConcurrency) makes it strictly sequential, so e.g. a write followed by a read of the same App Context object keeps its order.
+ */
+enum class EPubnubOperationClass : uint8
+{
+	//Operations that don't fit any other class (channel groups, access manager, etc.)
+	General,
+	//Publish and signal
+	Publish,
+	//Fetch history, message counts, message actions, etc.
+	History,
+	//Users, channels, memberships and members
+	AppContext,
+	//Here now, where now, state and heartbeat
+	Presence,
+	//Subscribe, unsubscribe and auth token changes. Runs after everything queued before it finishes and blocks everything queued after it
+	StateChange,
+
+	Count
+};
 
 /**
- * 
+ * Event-driven dispatcher for all Async PubNub operations.
+ *
+ * Queued functions are executed by a configurable number of worker threads. Idle workers sleep on their own
+ * FEvent and are woken as soon as there is work, so there is no polling delay. Functions are kept in
+ * per-class queues and different classes run in parallel on different workers, so a slow App Context
+ * page fetch can't starve a latency-critical publish. A class can be capped to fewer concurrent functions than there are workers.
+ * If a context pool is provided, every worker gets its own reserved C-Core context from it.
  */
-class PUBNUBLIBRARY_API FPubnubFunctionThread : FRunnable
+class PUBNUBLIBRARY_API FPubnubFunctionThread
 {
 public:
-	
-	FPubnubFunctionThread()
+
+	explicit FPubnubFunctionThread(int32 InWorkerCount = 1, FPubnubContextPool* InContextPool = nullptr);
+	~FPubnubFunctionThread();
+
+	FPubnubFunctionThread(const FPubnubFunctionThread&) = delete;
+	FPubnubFunctionThread& operator=(const FPubnubFunctionThread&) = delete;
+
+	//Stops all workers. Functions that didn't start yet are not executed
+	void Stop();
+
+	//Add function to the queue of given class, it will be executed by the first worker that is free to take it
+	void AddFunctionToQueue(TFunction<void()> InFunction, EPubnubOperationClass OperationClass = EPubnubOperationClass::General);
+
+	int32 GetWorkerCount() const { return Workers.Num(); }
+
+	//Sets how many functions of given class can run at once. 0 or less means up to the worker count. StateChange always runs alone
+	void SetMaxConcurrency(EPubnubOperationClass OperationClass, int32 MaxConcurrent);
+	int32 GetMaxConcurrency(EPubnubOperationClass OperationClass);
+
+private:
+
+	class FWorker : public FRunnable
 	{
-		Thread = FRunnableThread::Create(this, TEXT("PubnubThread"));
+	public:
+		FWorker(FPubnubFunctionThread* InDispatcher, int32 InWorkerIndex);
+		virtual ~FWorker() override;
+
+		virtual uint32 Run() override;
+		virtual void Stop() override;
+
+		FPubnubFunctionThread* Dispatcher = nullptr;
+		int32 WorkerIndex = INDEX_NONE;
+		FEvent* WakeUpEvent = nullptr;
+		FRunnableThread* Thread = nullptr;
 	};
-	~FPubnubFunctionThread()
+
+	struct FQueuedFunction
 	{
-		if(Thread)
-		{
-			Thread->Kill();
-			delete Thread;
-		}
+		TFunction<void()> Function;
+		uint64 Sequence = 0;
 	};
-	virtual bool Init() override;
-	virtual uint32 Run() override;
-	virtual void Exit() override;
-	virtual void Stop() override;
-	
-	FRunnableThread* Thread;
-	bool bShutdown = false;
 
-	//Add function to the queue buffer, it will be added to the queue after current queue is finished
-	void AddFunctionToQueue(TFunction<void()> InFunction);
+	//Takes the oldest function that is allowed to run. Has to be called with QueueMutex locked
+	bool TryDequeue_Locked(FQueuedFunction& OutFunction, EPubnubOperationClass& OutClass);
+	//Wakes one sleeping worker, if there is any. Has to be called with QueueMutex locked
+	void WakeUpIdleWorker_Locked();
+
+	//Worker loop. Returns when dispatcher is stopped
+	void RunWorker(FWorker& Worker);
+
+	TArray<TUniquePtr<FWorker>> Workers;
+	FPubnubContextPool* ContextPool = nullptr;
 
-private:
-	TArray<TFunction<void()>> PubnubAsyncFunctionsBuffer;
-	TArray<TFunction<void()>> PubnubAsyncFunctionsQueue;
 	FCriticalSection QueueMutex;
-	
-	float QueueLoopDelay = 0.05f;
+	TQueue<FQueuedFunction> Queues[static_cast<int32>(EPubnubOperationClass::Count)];
+	int32 RunningCount[static_cast<int32>(EPubnubOperationClass::Count)] = {};
+	int32 MaxConcurrency[static_cast<int32>(EPubnubOperationClass::Count)] = {};
+	int32 TotalRunningCount = 0;
+	uint64 NextSequence = 0;
+	TArray<FWorker*> IdleWorkers;
+	bool bShutdown = false;
 };
-
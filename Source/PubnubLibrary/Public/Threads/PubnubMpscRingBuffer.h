@@ -0,0 +1,122 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/UniquePtr.h"
+#include <atomic>
+
+/**
+ * Bounded lock-free ring buffer for many producer threads and a single consumer thread.
+ *
+ * Every cell carries a sequence number that tells whether it is free for the producer that claimed
+ * its position or already holds an element for the consumer, so producers never block each other
+ * and the consumer never blocks producers. Elements are moved in and out of preallocated cells,
+ * so there is no allocation per element. Capacity is rounded up to the nearest power of two.
+ */
+template<typename ElementType>
+class TPubnubMpscRingBuffer
+{
+public:
+
+	explicit TPubnubMpscRingBuffer(uint32 InCapacity)
+	{
+		CapacityMask = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2)) - 1;
+		Cells = MakeUnique<FCell[]>(CapacityMask + 1);
+		for(uint32 i = 0; i <= CapacityMask; i++)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	TPubnubMpscRingBuffer(const TPubnubMpscRingBuffer&) = delete;
+	TPubnubMpscRingBuffer& operator=(const TPubnubMpscRingBuffer&) = delete;
+
+	//Adds element to the buffer. Returns false if the buffer is full. Can be called from any thread
+	bool TryPush(ElementType&& Item)
+	{
+		uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		while(true)
+		{
+			FCell& Cell = Cells[Position & CapacityMask];
+			const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+			const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+			if(Difference == 0)
+			{
+				//Cell is free - claim its position. On failure Position is reloaded and we try again
+				if(EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					Cell.Data = MoveTemp(Item);
+					Cell.Sequence.store(Position + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if(Difference < 0)
+			{
+				//Consumer didn't free this cell yet
+				return false;
+			}
+			else
+			{
+				//Another producer took this position in the meantime
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	//Adds element to the buffer, yielding the calling thread while the buffer is full. Returns false if there was no free cell for TimeoutSeconds. Can be called from any thread
+	bool Push(ElementType&& Item, double TimeoutSeconds)
+	{
+		if(TryPush(MoveTemp(Item)))
+		{
+			return true;
+		}
+
+		const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+		while(!TryPush(MoveTemp(Item)))
+		{
+			if(FPlatformTime::Seconds() >= EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Yield();
+		}
+		return true;
+	}
+
+	//Takes the oldest element from the buffer. Returns false if the buffer is empty. Has to be called only from the consumer thread
+	bool TryPop(ElementType& OutItem)
+	{
+		FCell& Cell = Cells[DequeuePosition & CapacityMask];
+		const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+		if(Sequence != DequeuePosition + 1)
+		{
+			return false;
+		}
+
+		OutItem = MoveTemp(Cell.Data);
+		//Mark cell as free for the producer that will wrap around to it
+		Cell.Sequence.store(DequeuePosition + CapacityMask + 1, std::memory_order_release);
+		DequeuePosition++;
+		return true;
+	}
+
+	uint32 Capacity() const { return CapacityMask + 1; }
+
+private:
+
+	struct FCell
+	{
+		std::atomic<uint64> Sequence{0};
+		ElementType Data;
+	};
+
+	TUniquePtr<FCell[]> Cells;
+	uint32 CapacityMask = 0;
+
+	//Producers and consumer positions are on separate cache lines, so they don't invalidate each other
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePosition{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePosition = 0;
+};
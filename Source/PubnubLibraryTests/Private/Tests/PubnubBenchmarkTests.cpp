@@ -0,0 +1,872 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Crypto/PubnubAesCryptor.h"
+#include "Crypto/PubnubCryptoModule.h"
+#include "Crypto/PubnubLegacyCryptor.h"
+#include "FunctionLibraries/PubnubCryptoUtilities.h"
+#include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "FunctionLibraries/PubnubLogUtilities.h"
+#include "FunctionLibraries/PubnubUtilities.h"
+#include "FunctionLibraries/PubnubInternalUtilities.h"
+#include "Logging/PubnubLogManager.h"
+#include "PubnubBaseLogger.h"
+#include "PubnubSubsystem.h"
+#include "PubnubClient.h"
+#include "Entities/PubnubChannelEntity.h"
+#include "Entities/PubnubSubscription.h"
+#include "PubnubNativeMessage.h"
+#include "Engine/GameInstance.h"
+#include "UObject/UObjectArray.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/Compression.h"
+#include "GenericPlatform/GenericPlatformHttp.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+/**
+ * Micro-benchmarks of the SDK hot paths. They don't need network access and are not part of the smoke tests,
+ * results are reported as test info in nanoseconds per operation.
+ */
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMessagePayloadParsingBenchmark, "Pubnub.Benchmark.MessagePayloadParsing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPublishPathLoggingBenchmark, "Pubnub.Benchmark.PublishPathLogging", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLoggerDispatchBenchmark, "Pubnub.Benchmark.LoggerDispatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCryptoBenchmark, "Pubnub.Benchmark.Crypto", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCryptoProviderDecryptBenchmark, "Pubnub.Benchmark.CryptoProviderDecrypt", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHistoryDecryptionBenchmark, "Pubnub.Benchmark.HistoryDecryption", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppContextListParsingBenchmark, "Pubnub.Benchmark.AppContextListParsing", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubscriptionChurnBenchmark, "Pubnub.Benchmark.SubscriptionChurn", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPublishCompressionBenchmark, "Pubnub.Benchmark.PublishCompression", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FReceivedMessageAllocationsBenchmark, "Pubnub.Benchmark.ReceivedMessageAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter);
+
+namespace
+{
+	//Runs Operation Iterations times (after a short warm-up) and returns average time of a single run in nanoseconds
+	double MeasureNanosecondsPerOperation(int32 Iterations, TFunctionRef<void()> Operation)
+	{
+		for(int32 i = 0; i < FMath::Max(1, Iterations / 10); i++)
+		{
+			Operation();
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		for(int32 i = 0; i < Iterations; i++)
+		{
+			Operation();
+		}
+		return (FPlatformTime::Seconds() - StartTime) * 1e9 / Iterations;
+	}
+
+	bool IsSameUserData(const FPubnubUserData& A, const FPubnubUserData& B)
+	{
+		return A.UserID == B.UserID && A.UserName == B.UserName && A.ExternalID == B.ExternalID && A.ProfileUrl == B.ProfileUrl && A.Email == B.Email
+			&& A.Custom == B.Custom && A.Status == B.Status && A.Type == B.Type && A.Updated == B.Updated && A.ETag == B.ETag;
+	}
+
+	bool IsSameChannelData(const FPubnubChannelData& A, const FPubnubChannelData& B)
+	{
+		return A.ChannelID == B.ChannelID && A.ChannelName == B.ChannelName && A.Description == B.Description && A.Custom == B.Custom
+			&& A.Status == B.Status && A.Type == B.Type && A.Updated == B.Updated && A.ETag == B.ETag;
+	}
+
+	//Forwards everything to the engine allocator and counts allocations made by one thread, so other threads don't add noise
+	class FCountingMallocProxy : public FMalloc
+	{
+	public:
+
+		explicit FCountingMallocProxy(FMalloc* InInnerMalloc) : InnerMalloc(InInnerMalloc) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation();
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if(Count > 0)
+			{
+				CountAllocation();
+			}
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+		virtual void Free(void* Original) override { InnerMalloc->Free(Original); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return InnerMalloc->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return InnerMalloc->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+		virtual bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+		virtual const TCHAR* GetDescriptiveName() override { return TEXT("PubnubCountingMallocProxy"); }
+
+		FMalloc* InnerMalloc = nullptr;
+		std::atomic<uint32> CountedThreadId{0};
+		std::atomic<int64> Allocations{0};
+
+	private:
+
+		void CountAllocation()
+		{
+			if(FPlatformTLS::GetCurrentThreadId() == CountedThreadId.load(std::memory_order_relaxed))
+			{
+				Allocations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	};
+
+	//Runs Operation Iterations times (after a warm-up) with GMalloc wrapped in FCountingMallocProxy and returns average number of allocations per run
+	double MeasureAllocationsPerOperation(int32 Iterations, TFunctionRef<void()> Operation)
+	{
+		for(int32 i = 0; i < FMath::Max(1, Iterations / 10); i++)
+		{
+			Operation();
+		}
+
+		//Never freed: another thread can still be inside the proxy right after GMalloc is restored
+		static FCountingMallocProxy* Proxy = new FCountingMallocProxy(GMalloc);
+		FMalloc* PreviousMalloc = GMalloc;
+		Proxy->InnerMalloc = PreviousMalloc;
+		Proxy->Allocations = 0;
+		Proxy->CountedThreadId = FPlatformTLS::GetCurrentThreadId();
+		GMalloc = Proxy;
+		for(int32 i = 0; i < Iterations; i++)
+		{
+			Operation();
+		}
+		GMalloc = PreviousMalloc;
+		Proxy->CountedThreadId = 0;
+		return static_cast<double>(Proxy->Allocations.load()) / Iterations;
+	}
+
+	void ReportComparison(FAutomationTestBase& Test, const FString& CaseName, double BaselineNs, double OptimizedNs)
+	{
+		Test.AddInfo(FString::Printf(TEXT("%s: baseline %.1f ns/op, optimized %.1f ns/op, speedup x%.2f"),
+			*CaseName, BaselineNs, OptimizedNs, OptimizedNs > 0.0 ? BaselineNs / OptimizedNs : 0.0));
+	}
+
+	//UPubnubLogManager dispatch from before the dispatch table, kept as it was: every message takes the loggers lock,
+	//validates every logger, asks it for its level through reflection and calls it through Execute_ thunks while holding the lock
+	class FLegacyLogDispatcher
+	{
+	public:
+
+		void AddLogger(UObject* LoggerObject)
+		{
+			FScopeLock Lock(&LoggersMutex);
+			LoggerObjects.Add(LoggerObject);
+			RefreshCachedLevels();
+		}
+
+		void Log(EPubnubLogLevel Level, EPubnubLogSource Source, const FString& Message, const FString& Callsite = TEXT(""))
+		{
+			if (!IsLogEnabled(Level, Source))
+			{
+				return;
+			}
+
+			FPubnubLogMessage PubnubLogMessage;
+			PubnubLogMessage.LogLevel = Level;
+			PubnubLogMessage.Source = Source;
+			PubnubLogMessage.Message = Message;
+			PubnubLogMessage.TimestampUtc = FDateTime::UtcNow();
+			PubnubLogMessage.Callsite = Callsite;
+			PubnubLogMessage.PubnubInstanceID = Source == EPubnubLogSource::PLS_CCore ? TEXT("PubNub-unknown") : UESdkEmitterID;
+			DispatchMessage(PubnubLogMessage);
+		}
+
+	private:
+
+		bool IsLogEnabled(EPubnubLogLevel Level, EPubnubLogSource Source) const
+		{
+			return Level != EPubnubLogLevel::PLL_None
+				&& static_cast<uint8>(Level) >= CachedMinimumLevels[static_cast<int32>(Source)].load(std::memory_order_relaxed);
+		}
+
+		static bool IsLevelEnabled(EPubnubLogLevel MessageLevel, EPubnubLogLevel MinimumLevel)
+		{
+			if (MinimumLevel == EPubnubLogLevel::PLL_None)
+			{
+				return false;
+			}
+
+			return static_cast<uint8>(MessageLevel) >= static_cast<uint8>(MinimumLevel);
+		}
+
+		void RefreshCachedLevels()
+		{
+			FScopeLock Lock(&LoggersMutex);
+
+			uint8 MinimumUELevel = static_cast<uint8>(EPubnubLogLevel::PLL_None);
+			uint8 MinimumCCoreLevel = static_cast<uint8>(EPubnubLogLevel::PLL_None);
+			for (UObject* LoggerObject : LoggerObjects)
+			{
+				if (!IsValid(LoggerObject) || !LoggerObject->GetClass()->ImplementsInterface(UPubnubLoggerInterface::StaticClass()))
+				{
+					continue;
+				}
+
+				MinimumUELevel = FMath::Min(MinimumUELevel, static_cast<uint8>(IPubnubLoggerInterface::Execute_GetMinimumLogLevel(LoggerObject)));
+				MinimumCCoreLevel = FMath::Min(MinimumCCoreLevel, static_cast<uint8>(IPubnubLoggerInterface::Execute_GetMinimumCCoreLogLevel(LoggerObject)));
+			}
+
+			CachedMinimumLevels[static_cast<int32>(EPubnubLogSource::PLS_UE)].store(MinimumUELevel, std::memory_order_relaxed);
+			CachedMinimumLevels[static_cast<int32>(EPubnubLogSource::PLS_CCore)].store(MinimumCCoreLevel, std::memory_order_relaxed);
+		}
+
+		void DispatchMessage(const FPubnubLogMessage& Message)
+		{
+			FScopeLock Lock(&LoggersMutex);
+			bool AnyLoggerRemoved = false;
+			for (int32 Index = LoggerObjects.Num() - 1; Index >= 0; --Index)
+			{
+				UObject* LoggerObject = LoggerObjects[Index];
+				if (!LoggerObject
+					|| !IsValid(LoggerObject)
+					|| LoggerObject->IsUnreachable()
+					|| LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed)
+					|| !LoggerObject->GetClass()->ImplementsInterface(UPubnubLoggerInterface::StaticClass()))
+				{
+					LoggerObjects.RemoveAt(Index);
+					AnyLoggerRemoved = true;
+					continue;
+				}
+
+				const EPubnubLogLevel MinimumLevel = Message.Source == EPubnubLogSource::PLS_CCore
+					? IPubnubLoggerInterface::Execute_GetMinimumCCoreLogLevel(LoggerObject)
+					: IPubnubLoggerInterface::Execute_GetMinimumLogLevel(LoggerObject);
+
+				if (!IsLevelEnabled(Message.LogLevel, MinimumLevel))
+				{
+					continue;
+				}
+
+				DispatchLevelSpecific(LoggerObject, Message.LogLevel, Message);
+			}
+
+			if (AnyLoggerRemoved)
+			{
+				RefreshCachedLevels();
+			}
+		}
+
+		static void DispatchLevelSpecific(UObject* LoggerObject, EPubnubLogLevel Level, const FPubnubLogMessage& Message)
+		{
+			if (!LoggerObject
+				|| !IsValid(LoggerObject)
+				|| LoggerObject->IsUnreachable()
+				|| LoggerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed))
+			{
+				return;
+			}
+
+			switch (Level)
+			{
+			case EPubnubLogLevel::PLL_Trace:
+				IPubnubLoggerInterface::Execute_LogTrace(LoggerObject, Message);
+				break;
+			case EPubnubLogLevel::PLL_Debug:
+				IPubnubLoggerInterface::Execute_LogDebug(LoggerObject, Message);
+				break;
+			case EPubnubLogLevel::PLL_Info:
+				IPubnubLoggerInterface::Execute_LogInfo(LoggerObject, Message);
+				break;
+			case EPubnubLogLevel::PLL_Warning:
+				IPubnubLoggerInterface::Execute_LogWarning(LoggerObject, Message);
+				break;
+			case EPubnubLogLevel::PLL_Error:
+				IPubnubLoggerInterface::Execute_LogError(LoggerObject, Message);
+				break;
+			case EPubnubLogLevel::PLL_None:
+			default:
+				break;
+			}
+		}
+
+		TArray<UObject*> LoggerObjects;
+		FCriticalSection LoggersMutex;
+		std::atomic<uint8> CachedMinimumLevels[2] = {static_cast<uint8>(EPubnubLogLevel::PLL_None), static_cast<uint8>(EPubnubLogLevel::PLL_None)};
+		FString UESdkEmitterID = TEXT("PubNub-unknown");
+	};
+}
+
+bool FMessagePayloadParsingBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 20000;
+
+	TMap<FString, FString> Payloads;
+	Payloads.Add(TEXT("Object"), TEXT("{\"text\":\"Hello from the game\",\"position\":{\"x\":12.5,\"y\":-3.25,\"z\":100},\"tags\":[\"a\",\"b\",\"c\"],\"alive\":true}"));
+	Payloads.Add(TEXT("Array"), TEXT("[1,2,3,4,5,6,7,8,9,10,\"eleven\",{\"twelve\":12}]"));
+	Payloads.Add(TEXT("String"), TEXT("\"Player \\\"Zoe\\\" joined the lobby\\nWelcome! \\u263A\""));
+	Payloads.Add(TEXT("Number"), TEXT("1234.5678"));
+
+	for(const TPair<FString, FString>& Payload : Payloads)
+	{
+		//Messages arrive from C-Core as UTF-8 bytes, so both paths start from the same buffer
+		FTCHARToUTF8 Utf8Payload(*Payload.Value);
+		const char* Data = Utf8Payload.Get();
+		const int32 Length = Utf8Payload.Length();
+
+		FString BaselineResult;
+		const double BaselineNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			FUTF8ToTCHAR Converter(Data, Length);
+			BaselineResult = FString(Converter.Length(), Converter.Get());
+			if(!UPubnubJsonUtilities::IsCorrectJsonString(BaselineResult, false))
+			{
+				BaselineResult = UPubnubJsonUtilities::DeserializeString(BaselineResult);
+			}
+		});
+
+		FString OptimizedResult;
+		const double OptimizedNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			OptimizedResult = UPubnubJsonUtilities::JsonPayloadToMessageString(Data, Length);
+		});
+
+		TestEqual(FString::Printf(TEXT("%s payload should give the same message"), *Payload.Key), OptimizedResult, BaselineResult);
+		ReportComparison(*this, Payload.Key, BaselineNs, OptimizedNs);
+	}
+
+	return true;
+}
+
+bool FPublishPathLoggingBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 20000;
+
+	UPubnubLogManager* LogManager = NewObject<UPubnubLogManager>();
+	UPubnubBaseLogger* Logger = NewObject<UPubnubBaseLogger>();
+	TScriptInterface<IPubnubLoggerInterface> LoggerInterface;
+	LoggerInterface.SetObject(Logger);
+	LoggerInterface.SetInterface(Cast<IPubnubLoggerInterface>(Logger));
+	LogManager->AddLogger(LoggerInterface);
+
+	const FString Channel = TEXT("benchmark_channel");
+	const FString Message = TEXT("{\"text\":\"Hello from the game\",\"score\":1234}");
+	FPubnubPublishSettings PublishSettings;
+	PublishSettings.MetaData = TEXT("{\"region\":\"eu\"}");
+	PublishSettings.CustomMessageType = TEXT("benchmark-type");
+
+	//Same log calls PublishMessage_priv does around a single publish: called trace, inputs debug and result debug
+	auto BuildInputsMessage = [&]()
+	{
+		const TArray<FString> InputPairs = {
+			FString::Printf(TEXT("%s = %s"), TEXT("Channel"), *UPubnubLogUtilities::LogToString(Channel)),
+			FString::Printf(TEXT("%s = %s"), TEXT("Message"), *UPubnubLogUtilities::LogToString(Message)),
+			FString::Printf(TEXT("%s = %s"), TEXT("PublishSettings"), *UPubnubLogUtilities::LogToString(PublishSettings))
+		};
+		const FString FunctionName = UPubnubUtilities::GetNameFromFunctionMacro(ANSI_TO_TCHAR(__FUNCTION__));
+		return FString::Printf(TEXT("%s with inputs:\n\t-%s"), *FunctionName, *FString::Join(InputPairs, TEXT("\n\t-")));
+	};
+	auto LogPublishPathEagerly = [&]()
+	{
+		LogManager->Log(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_UE, TEXT("PublishMessage called."), ANSI_TO_TCHAR(__FUNCTION__));
+		LogManager->Log(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE, BuildInputsMessage(), ANSI_TO_TCHAR(__FUNCTION__));
+		LogManager->Log(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE, BuildInputsMessage(), ANSI_TO_TCHAR(__FUNCTION__));
+	};
+	auto LogPublishPathLazily = [&]()
+	{
+		if(LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_UE))
+		{
+			LogManager->Log(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_UE, TEXT("PublishMessage called."), ANSI_TO_TCHAR(__FUNCTION__));
+		}
+		for(int32 i = 0; i < 2; i++)
+		{
+			if(LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE))
+			{
+				LogManager->Log(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE, BuildInputsMessage(), ANSI_TO_TCHAR(__FUNCTION__));
+			}
+		}
+	};
+
+	IPubnubLoggerInterface::Execute_SetMinimumLogLevel(Logger, EPubnubLogLevel::PLL_Trace);
+	const double TraceNs = MeasureNanosecondsPerOperation(Iterations, LogPublishPathLazily);
+
+	IPubnubLoggerInterface::Execute_SetMinimumLogLevel(Logger, EPubnubLogLevel::PLL_Error);
+	TestFalse("Debug logs should be disabled with Error level", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE));
+	const double ErrorEagerNs = MeasureNanosecondsPerOperation(Iterations, LogPublishPathEagerly);
+	const double ErrorLazyNs = MeasureNanosecondsPerOperation(Iterations, LogPublishPathLazily);
+
+	AddInfo(FString::Printf(TEXT("Publish path logging with Trace level: %.1f ns/op"), TraceNs));
+	ReportComparison(*this, TEXT("Publish path logging with Error level"), ErrorEagerNs, ErrorLazyNs);
+
+	LogManager->ClearLoggers();
+	return true;
+}
+
+bool FLoggerDispatchBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 20000;
+
+	for(const int32 LoggersCount : {1, 4, 16})
+	{
+		UPubnubLogManager* LogManager = NewObject<UPubnubLogManager>();
+		FLegacyLogDispatcher LegacyDispatcher;
+		for(int32 i = 0; i < LoggersCount; i++)
+		{
+			UPubnubBaseLogger* Logger = NewObject<UPubnubBaseLogger>();
+			//Half of the loggers filter the message out, so level checks are part of the measured cost
+			IPubnubLoggerInterface::Execute_SetMinimumLogLevel(Logger, i % 2 == 0 ? EPubnubLogLevel::PLL_Trace : EPubnubLogLevel::PLL_Error);
+			TScriptInterface<IPubnubLoggerInterface> LoggerInterface;
+			LoggerInterface.SetObject(Logger);
+			LoggerInterface.SetInterface(Cast<IPubnubLoggerInterface>(Logger));
+			LogManager->AddLogger(LoggerInterface);
+			LegacyDispatcher.AddLogger(Logger);
+		}
+
+		const FString Message = TEXT("PublishMessage succeeded.");
+
+		const double ReflectiveNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			LegacyDispatcher.Log(EPubnubLogLevel::PLL_Info, EPubnubLogSource::PLS_UE, Message);
+		});
+
+		const double TableNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			LogManager->Log(EPubnubLogLevel::PLL_Info, EPubnubLogSource::PLS_UE, Message);
+		});
+
+		ReportComparison(*this, FString::Printf(TEXT("Dispatch to %d loggers"), LoggersCount), ReflectiveNs, TableNs);
+		LogManager->ClearLoggers();
+	}
+
+	return true;
+}
+
+bool FCryptoBenchmark::RunTest(const FString& Parameters)
+{
+	UPubnubAesCryptor* AesCryptor = NewObject<UPubnubAesCryptor>();
+	AesCryptor->SetCipherKey(TEXT("benchmark-cipher-key"));
+	UPubnubLegacyCryptor* LegacyCryptor = NewObject<UPubnubLegacyCryptor>();
+	LegacyCryptor->SetCipherKey(TEXT("benchmark-cipher-key"));
+
+	const TArray<TPair<FString, UObject*>> Cryptors = {{TEXT("ACRH"), AesCryptor}, {TEXT("Legacy"), LegacyCryptor}};
+	const TArray<TPair<FString, int32>> PayloadSizes = {{TEXT("1 B"), 1}, {TEXT("1 KB"), 1024}, {TEXT("32 KB"), 32 * 1024}};
+
+	for(const TPair<FString, int32>& PayloadSize : PayloadSizes)
+	{
+		FString Payload;
+		Payload.Reserve(PayloadSize.Value);
+		for(int32 i = 0; i < PayloadSize.Value; i++)
+		{
+			Payload.AppendChar(TEXT('a') + i % 26);
+		}
+		//Bigger payloads are dominated by AES itself, so fewer iterations are enough
+		const int32 Iterations = PayloadSize.Value > 1024 ? 500 : 10000;
+
+		for(const TPair<FString, UObject*>& Cryptor : Cryptors)
+		{
+			FPubnubEncryptedData EncryptedData;
+			const double EncryptNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+			{
+				EncryptedData = IPubnubCryptorInterface::Execute_Encrypt(Cryptor.Value, Payload);
+			});
+
+			FString DecryptedData;
+			const double DecryptNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+			{
+				DecryptedData = IPubnubCryptorInterface::Execute_Decrypt(Cryptor.Value, EncryptedData);
+			});
+
+			TestEqual(FString::Printf(TEXT("%s %s payload should survive encryption round trip"), *Cryptor.Key, *PayloadSize.Key), DecryptedData, Payload);
+			AddInfo(FString::Printf(TEXT("%s %s: encrypt %.1f ns/op, decrypt %.1f ns/op"), *Cryptor.Key, *PayloadSize.Key, EncryptNs, DecryptNs));
+		}
+	}
+
+	return true;
+}
+
+bool FCryptoProviderDecryptBenchmark::RunTest(const FString& Parameters)
+{
+	UPubnubAesCryptor* AesCryptor = NewObject<UPubnubAesCryptor>();
+	AesCryptor->SetCipherKey(TEXT("benchmark-cipher-key"));
+	TScriptInterface<IPubnubCryptorInterface> AesInterface;
+	AesInterface.SetObject(AesCryptor);
+	AesInterface.SetInterface(Cast<IPubnubCryptorInterface>(AesCryptor));
+	UPubnubCryptoModule* Module = NewObject<UPubnubCryptoModule>();
+	Module->InitCryptoModule(AesInterface, {});
+
+	for(const int32 PayloadSize : {64, 1024, 32 * 1024})
+	{
+		FString Payload = TEXT("\"");
+		for(int32 i = 0; i < PayloadSize - 2; i++)
+		{
+			Payload.AppendChar(TEXT('a') + i % 26);
+		}
+		Payload.AppendChar(TEXT('"'));
+		const int32 Iterations = PayloadSize > 1024 ? 500 : 10000;
+
+		//Header + ciphertext as C-Core passes it to the crypto bridge
+		TArray<uint8> EncryptedBytes;
+		UPubnubCryptoUtilities::Base64Decode(IPubnubCryptoProviderInterface::Execute_ProviderEncrypt(Module, Payload), EncryptedBytes);
+
+		//FString round trip the bridge used before the byte API
+		size_t BaselineSize = 0;
+		const double BaselineNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			const FString Base64 = UPubnubCryptoUtilities::Base64Encode(EncryptedBytes);
+			const FString Plain = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(Module, Base64);
+			uint8* Bytes = nullptr;
+			UPubnubCryptoUtilities::ConvertStringToBytes(Plain, Bytes, BaselineSize);
+			free(Bytes);
+		});
+
+		TArray<uint8> PlainBytes;
+		const double OptimizedNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			IPubnubCryptoProviderInterface::ProviderDecryptBytes(Module, EncryptedBytes, PlainBytes);
+		});
+
+		TestEqual(FString::Printf(TEXT("%d B payload should decrypt to the same size"), PayloadSize), static_cast<int32>(BaselineSize), PlainBytes.Num());
+		ReportComparison(*this, FString::Printf(TEXT("Provider decrypt of %d B payload"), PayloadSize), BaselineNs, OptimizedNs);
+	}
+
+	return true;
+}
+
+bool FHistoryDecryptionBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 50;
+
+	UPubnubAesCryptor* AesCryptor = NewObject<UPubnubAesCryptor>();
+	AesCryptor->SetCipherKey(TEXT("benchmark-cipher-key"));
+	TScriptInterface<IPubnubCryptorInterface> AesInterface;
+	AesInterface.SetObject(AesCryptor);
+	AesInterface.SetInterface(Cast<IPubnubCryptorInterface>(AesCryptor));
+	UPubnubCryptoModule* Module = NewObject<UPubnubCryptoModule>();
+	Module->InitCryptoModule(AesInterface, {});
+
+	for(const int32 PageSize : {25, 100})
+	{
+		//Encrypted chat messages as FetchHistoryJsonToData leaves them: Base64 of header + ciphertext
+		TArray<FPubnubHistoryMessageData> EncryptedPage;
+		for(int32 i = 0; i < PageSize; i++)
+		{
+			FPubnubHistoryMessageData Message;
+			Message.Message = IPubnubCryptoProviderInterface::Execute_ProviderEncrypt(Module,
+				FString::Printf(TEXT("\"Chat line %d from the lobby, with some \\\"quoted\\\" text to make it realistic\""), i));
+			Message.Timetoken = FString::Printf(TEXT("%d"), 17000000 + i);
+			EncryptedPage.Add(Message);
+		}
+
+		//Serial decryption through the reflected ProviderDecrypt and FJsonSerializer, as the client used to do it
+		TArray<FPubnubHistoryMessageData> BaselinePage;
+		const double BaselineNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			BaselinePage = EncryptedPage;
+			for(FPubnubHistoryMessageData& Message : BaselinePage)
+			{
+				const FString Plain = IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(Module, Message.Message);
+				if(!Plain.IsEmpty())
+				{
+					Message.Message = UPubnubJsonUtilities::DeserializeString(Plain);
+				}
+			}
+		});
+
+		TArray<FPubnubHistoryMessageData> OptimizedPage;
+		const double OptimizedNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			OptimizedPage = EncryptedPage;
+			UPubnubCryptoUtilities::DecryptHistoryMessages(Module, OptimizedPage);
+		});
+
+		bool bSameMessages = BaselinePage.Num() == OptimizedPage.Num();
+		for(int32 i = 0; bSameMessages && i < BaselinePage.Num(); i++)
+		{
+			bSameMessages = BaselinePage[i].Message == OptimizedPage[i].Message && BaselinePage[i].Timetoken == OptimizedPage[i].Timetoken;
+		}
+		TestTrue(FString::Printf(TEXT("%d message page should decrypt to the same messages in the same order"), PageSize), bSameMessages);
+		ReportComparison(*this, FString::Printf(TEXT("Decrypt %d message history page"), PageSize), BaselineNs, OptimizedNs);
+	}
+
+	return true;
+}
+
+bool FAppContextListParsingBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 200;
+	const int32 PageSize = 100;
+
+	//100 item pages, shaped like GetAllUserMetadata and GetMemberships responses with all includes enabled
+	FString UsersJson = TEXT("{\"status\":200,\"data\":[");
+	FString MembershipsJson = TEXT("{\"status\":200,\"data\":[");
+	for(int32 i = 0; i < PageSize; i++)
+	{
+		const TCHAR* Separator = i > 0 ? TEXT(",") : TEXT("");
+		UsersJson += FString::Printf(TEXT("%s{\"id\":\"user-%d\",\"name\":\"Player %d\",\"externalId\":\"ext-%d\",\"profileUrl\":\"https://example.com/avatars/%d.png\",")
+			TEXT("\"email\":\"player%d@example.com\",\"custom\":{\"level\":%d,\"guild\":\"Knights of \\\"Dawn\\\"\",\"premium\":true},")
+			TEXT("\"status\":\"online\",\"type\":\"player\",\"updated\":\"2025-03-14T10:15:45.123456Z\",\"eTag\":\"AbCdEf%d\"}"),
+			Separator, i, i, i, i, i, i, i);
+		MembershipsJson += FString::Printf(TEXT("%s{\"channel\":{\"id\":\"room-%d\",\"name\":\"Room %d\",\"description\":\"Lobby room number %d\",")
+			TEXT("\"custom\":{\"map\":\"desert\",\"slots\":%d},\"status\":\"open\",\"type\":\"lobby\",\"updated\":\"2025-03-14T10:15:45.123456Z\",\"eTag\":\"Ch%d\"},")
+			TEXT("\"custom\":{\"role\":\"member\"},\"status\":\"active\",\"type\":\"default\",\"updated\":\"2025-03-14T10:15:45.123456Z\",\"eTag\":\"Mb%d\"}"),
+			Separator, i, i, i, i, i, i);
+	}
+	UsersJson += TEXT("],\"next\":\"MTAw\",\"totalCount\":1000}");
+	MembershipsJson += TEXT("],\"next\":\"MTAw\",\"totalCount\":1000}");
+
+	//Responses come from C-Core as UTF-8, the DOM path had to convert them to FString first
+	FTCHARToUTF8 UsersUtf8(*UsersJson);
+	FTCHARToUTF8 MembershipsUtf8(*MembershipsJson);
+
+	TArray<FPubnubUserData> BaselineUsers;
+	const double BaselineUsersNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+	{
+		FUTF8ToTCHAR Converter(UsersUtf8.Get(), UsersUtf8.Length());
+		TSharedPtr<FJsonObject> JsonObject;
+		UPubnubJsonUtilities::StringToJsonObject(FString(Converter.Length(), Converter.Get()), JsonObject);
+		UPubnubJsonUtilities::GetOperationResultFromJson_AppContext(JsonObject);
+		BaselineUsers.Reset();
+		for(const TSharedPtr<FJsonValue>& UserJsonValue : JsonObject->GetArrayField(TEXT("data")))
+		{
+			BaselineUsers.Add(UPubnubJsonUtilities::GetUserDataFromJson(UPubnubJsonUtilities::JsonObjectToString(UserJsonValue->AsObject())));
+		}
+	});
+
+	TArray<FPubnubUserData> OptimizedUsers;
+	const double OptimizedUsersNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+	{
+		FPubnubOperationResult Result;
+		FPubnubPage Page;
+		int TotalCount = 0;
+		OptimizedUsers.Reset();
+		UPubnubJsonUtilities::GetAllUserMetadataJsonToData(UsersUtf8.Get(), UsersUtf8.Length(), Result, OptimizedUsers, Page, TotalCount);
+	});
+
+	bool bSameUsers = BaselineUsers.Num() == PageSize && OptimizedUsers.Num() == PageSize;
+	for(int32 i = 0; bSameUsers && i < PageSize; i++)
+	{
+		bSameUsers = IsSameUserData(BaselineUsers[i], OptimizedUsers[i]);
+	}
+	TestTrue("Single pass reader should give the same users as the DOM path", bSameUsers);
+	ReportComparison(*this, TEXT("GetAllUserMetadata 100 item page"), BaselineUsersNs, OptimizedUsersNs);
+
+	TArray<FPubnubMembershipData> BaselineMemberships;
+	const double BaselineMembershipsNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+	{
+		FUTF8ToTCHAR Converter(MembershipsUtf8.Get(), MembershipsUtf8.Length());
+		TSharedPtr<FJsonObject> JsonObject;
+		UPubnubJsonUtilities::StringToJsonObject(FString(Converter.Length(), Converter.Get()), JsonObject);
+		UPubnubJsonUtilities::GetOperationResultFromJson_AppContext(JsonObject);
+		BaselineMemberships = UPubnubJsonUtilities::GetMembershipsDataArrayFromJson(JsonObject);
+	});
+
+	TArray<FPubnubMembershipData> OptimizedMemberships;
+	const double OptimizedMembershipsNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+	{
+		FPubnubOperationResult Result;
+		FPubnubPage Page;
+		int TotalCount = 0;
+		OptimizedMemberships.Reset();
+		UPubnubJsonUtilities::GetMembershipsJsonToData(MembershipsUtf8.Get(), MembershipsUtf8.Length(), Result, OptimizedMemberships, Page, TotalCount);
+	});
+
+	bool bSameMemberships = BaselineMemberships.Num() == PageSize && OptimizedMemberships.Num() == PageSize;
+	for(int32 i = 0; bSameMemberships && i < PageSize; i++)
+	{
+		const FPubnubMembershipData& Baseline = BaselineMemberships[i];
+		const FPubnubMembershipData& Optimized = OptimizedMemberships[i];
+		bSameMemberships = IsSameChannelData(Baseline.Channel, Optimized.Channel) && Baseline.Custom == Optimized.Custom && Baseline.Status == Optimized.Status
+			&& Baseline.Type == Optimized.Type && Baseline.Updated == Optimized.Updated && Baseline.ETag == Optimized.ETag;
+	}
+	TestTrue("Single pass reader should give the same memberships as the DOM path", bSameMemberships);
+	ReportComparison(*this, TEXT("GetMemberships 100 item page"), BaselineMembershipsNs, OptimizedMembershipsNs);
+
+	return true;
+}
+
+bool FSubscriptionChurnBenchmark::RunTest(const FString& Parameters)
+{
+	//Proximity style churn: subscriptions of a small set of channels are created and released over and over.
+	//Nothing is subscribed, so it only measures the object and C-Core allocation cost
+	const int32 Iterations = 20000;
+	const int32 ChannelsCount = 64;
+
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+	UPubnubSubsystem* PubnubSubsystem = GameInstance->GetSubsystem<UPubnubSubsystem>();
+	if(!TestNotNull("Pubnub Subsystem exists", PubnubSubsystem))
+	{
+		GameInstance->Shutdown();
+		return false;
+	}
+
+	FPubnubConfig Config;
+	Config.UserID = TEXT("UE_SDK_Benchmark_User");
+	Config.PublishKey = TEXT("demo");
+	Config.SubscribeKey = TEXT("demo");
+	Config.LoggerConfig.DefaultLoggerMinLevel = EPubnubLogLevel::PLL_Error;
+
+	FPubnubConfig BaselineConfig = Config;
+	BaselineConfig.SubscriptionPoolCapacity = 0;
+	BaselineConfig.EntityCacheCapacity = 0;
+
+	UPubnubClient* BaselineClient = PubnubSubsystem->CreatePubnubClient(BaselineConfig, TEXT("ChurnBaseline"));
+	UPubnubClient* PooledClient = PubnubSubsystem->CreatePubnubClient(Config, TEXT("ChurnPooled"));
+
+	TArray<FString> Channels;
+	for(int32 i = 0; i < ChannelsCount; i++)
+	{
+		Channels.Add(FString::Printf(TEXT("benchmark_churn_channel_%d"), i));
+	}
+
+	auto MeasureChurn = [&](UPubnubClient* Client, int32& OutCreatedObjects)
+	{
+		int32 ChannelIndex = 0;
+		const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		const double NsPerOperation = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			UPubnubChannelEntity* ChannelEntity = Client->CreateChannelEntity(Channels[ChannelIndex]);
+			UPubnubSubscription* Subscription = ChannelEntity->CreateSubscription();
+			Subscription->Release();
+			ChannelIndex = (ChannelIndex + 1) % ChannelsCount;
+		});
+		OutCreatedObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+		return NsPerOperation;
+	};
+
+	int32 BaselineCreatedObjects = 0;
+	int32 PooledCreatedObjects = 0;
+	const double BaselineNs = MeasureChurn(BaselineClient, BaselineCreatedObjects);
+	const double PooledNs = MeasureChurn(PooledClient, PooledCreatedObjects);
+
+	AddInfo(FString::Printf(TEXT("UObjects created by %d subscription cycles: baseline %d, pooled %d"), Iterations + Iterations / 10, BaselineCreatedObjects, PooledCreatedObjects));
+	ReportComparison(*this, FString::Printf(TEXT("Create and release subscription of one of %d channels"), ChannelsCount), BaselineNs, PooledNs);
+	TestTrue("Pooled churn should create fewer objects than the baseline", PooledCreatedObjects < BaselineCreatedObjects);
+
+	BaselineClient->DestroyClient();
+	PooledClient->DestroyClient();
+	PubnubSubsystem->DeinitPubnub();
+	GameInstance->Shutdown();
+
+	return true;
+}
+
+bool FPublishCompressionBenchmark::RunTest(const FString& Parameters)
+{
+	//Inventory/state snapshot like payloads. GET sends the message URL-encoded in the query string, POST with GZIP sends it deflated in the body.
+	//C-Core has its own deflate implementation, so the GZIP size measured here with the engine's zlib is an estimate of what goes on the wire
+	const int32 Iterations = 500;
+	const int32 PayloadSizes[] = {512, 2 * 1024, 10 * 1024, 30 * 1024};
+	const int32 CompressionThresholdBytes = FPubnubConfig().PublishCompressionThresholdBytes;
+
+	auto MakeInventoryPayload = [](int32 MinSizeBytes)
+	{
+		FString Payload = TEXT("{\"player\":\"UE_SDK_Benchmark_User\",\"version\":42,\"items\":[");
+		for(int32 ItemIndex = 0; Payload.Len() < MinSizeBytes; ItemIndex++)
+		{
+			Payload += FString::Printf(TEXT("%s{\"id\":\"item_%d\",\"type\":\"%s\",\"count\":%d,\"durability\":%.2f,\"equipped\":%s,\"slot\":%d}"),
+				ItemIndex > 0 ? TEXT(",") : TEXT(""), ItemIndex, ItemIndex % 3 == 0 ? TEXT("weapon") : TEXT("consumable"),
+				ItemIndex % 7 + 1, (ItemIndex % 100) / 100.0f, ItemIndex % 5 == 0 ? TEXT("true") : TEXT("false"), ItemIndex % 40);
+		}
+		Payload += TEXT("]}");
+		return Payload;
+	};
+
+	for(const int32 PayloadSize : PayloadSizes)
+	{
+		const FString Payload = MakeInventoryPayload(PayloadSize);
+		const FTCHARToUTF8 PayloadUtf8(*Payload);
+
+		int32 GetBytes = 0;
+		const double GetNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			GetBytes = FGenericPlatformHttp::UrlEncode(Payload).Len();
+		});
+
+		TArray<uint8> CompressedBuffer;
+		CompressedBuffer.SetNumUninitialized(FCompression::CompressMemoryBound(NAME_Gzip, PayloadUtf8.Length()));
+		int32 GzipBytes = 0;
+		const double GzipNs = MeasureNanosecondsPerOperation(Iterations, [&]()
+		{
+			GzipBytes = CompressedBuffer.Num();
+			if(!FCompression::CompressMemory(NAME_Gzip, CompressedBuffer.GetData(), GzipBytes, PayloadUtf8.Get(), PayloadUtf8.Length()))
+			{
+				GzipBytes = 0;
+			}
+		});
+		TestTrue(FString::Printf(TEXT("%d bytes payload compressed"), PayloadUtf8.Length()), GzipBytes > 0);
+
+		const EPubnubPublishMethod SelectedMethod = UPubnubInternalUtilities::GetPublishMethodForMessageSize(EPubnubPublishMethod::PPM_SendViaGET, PayloadUtf8.Length(), CompressionThresholdBytes);
+		AddInfo(FString::Printf(TEXT("%d bytes JSON: GET %d bytes on wire (%.1f us to encode), POST with GZIP ~%d bytes (%.1f us to encode), x%.1f smaller. Sent with %s"),
+			PayloadUtf8.Length(), GetBytes, GetNs / 1000.0, GzipBytes, GzipNs / 1000.0, GzipBytes > 0 ? static_cast<double>(GetBytes) / GzipBytes : 0.0,
+			SelectedMethod == EPubnubPublishMethod::PPM_SendViaPOSTwithGZIP ? TEXT("POST with GZIP") : TEXT("GET")));
+	}
+
+	return true;
+}
+
+bool FReceivedMessageAllocationsBenchmark::RunTest(const FString& Parameters)
+{
+	const int32 Iterations = 20000;
+
+	//Same fields C-Core fills for a published message received by a subscribe listener
+	const char* Payload = "{\"text\":\"Hello from the game\",\"position\":{\"x\":12.5,\"y\":-3.25},\"alive\":true}";
+	const char* Metadata = "{\"region\":\"eu\"}";
+	auto ToMemBlock = [](const char* Text)
+	{
+		pubnub_char_mem_block MemBlock;
+		MemBlock.ptr = Text;
+		MemBlock.size = FCStringAnsi::Strlen(Text);
+		return MemBlock;
+	};
+	pubnub_v2_message Message = {};
+	Message.payload = ToMemBlock(Payload);
+	Message.metadata = ToMemBlock(Metadata);
+	Message.channel = ToMemBlock("benchmark_channel");
+	Message.publisher = ToMemBlock("benchmark_user");
+	Message.tt = ToMemBlock("17301234567890123");
+	Message.custom_message_type = ToMemBlock("benchmark-type");
+	Message.match_or_group = ToMemBlock("benchmark_group");
+	Message.message_type = pbsbPublished;
+
+	TSharedRef<FPubnubMessageArena, ESPMode::ThreadSafe> Arena = MakeShared<FPubnubMessageArena, ESPMode::ThreadSafe>(64);
+
+	//Every message is dropped right after it's created, the same as after delivery, so native blocks go back to the arena
+	FPubnubMessageData MessageData;
+	auto ReceiveAsMessageData = [&]()
+	{
+		MessageData = UPubnubUtilities::UEMessageFromPubnubMessage(Message);
+		MessageData = FPubnubMessageData();
+	};
+	auto ReceiveAsNativeMessage = [&]()
+	{
+		FPubnubNativeMessage NativeMessage = UPubnubUtilities::NativeMessageFromPubnubMessage(Message, *Arena);
+	};
+	auto ReceiveAsNativeMessageWithMessageData = [&]()
+	{
+		FPubnubNativeMessage NativeMessage = UPubnubUtilities::NativeMessageFromPubnubMessage(Message, *Arena);
+		MessageData = NativeMessage.ToMessageData();
+		MessageData = FPubnubMessageData();
+	};
+
+	const double MessageDataAllocations = MeasureAllocationsPerOperation(Iterations, ReceiveAsMessageData);
+	const double NativeAllocations = MeasureAllocationsPerOperation(Iterations, ReceiveAsNativeMessage);
+	const double NativeWithMessageDataAllocations = MeasureAllocationsPerOperation(Iterations, ReceiveAsNativeMessageWithMessageData);
+	const double MessageDataNs = MeasureNanosecondsPerOperation(Iterations, ReceiveAsMessageData);
+	const double NativeNs = MeasureNanosecondsPerOperation(Iterations, ReceiveAsNativeMessage);
+
+	TestEqual("Native message should give the same Blueprint struct", UPubnubUtilities::NativeMessageFromPubnubMessage(Message, *Arena).ToMessageData().Message,
+		UPubnubUtilities::UEMessageFromPubnubMessage(Message).Message);
+	if(MessageDataAllocations > 0.0)
+	{
+		TestEqual("Native message should not allocate once the arena and name table are warm", NativeAllocations, 0.0);
+	}
+	else
+	{
+		AddWarning(TEXT("Allocations are not counted with this allocator, only times are reported"));
+	}
+
+	AddInfo(FString::Printf(TEXT("Allocations per message: FPubnubMessageData %.2f, native %.2f, native + lazily built FPubnubMessageData %.2f"),
+		MessageDataAllocations, NativeAllocations, NativeWithMessageDataAllocations));
+	ReportComparison(*this, TEXT("Received message conversion"), MessageDataNs, NativeNs);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
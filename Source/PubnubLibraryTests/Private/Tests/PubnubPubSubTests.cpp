@@ -63,6 +63,26 @@ IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubPublishMessage_SubscribeThenPubli
 	"Pubnub.Integration.PubSub.PublishMessage.4Advanced.SubscribeThenPublish_MessageReceived",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubPublishMessage_Sequential_ReusesConnection, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.PublishMessage.4Advanced.Sequential_ReusesConnection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+// ---------------------------------------------------------------------------
+// UPubnubClient::PublishBatch - Automated tests
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubPublishBatch_InvalidRequests_ReturnPerMessageErrors, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.PublishBatch.1Validation.InvalidRequests",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubPublishBatch_HappyPath_ResultsInRequestOrder, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.PublishBatch.2HappyPath.ResultsInRequestOrder",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubPublishBatch_Async_SingleCallbackWithAllResults, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.PublishBatch.4Advanced.AsyncSingleCallback",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
 // ---------------------------------------------------------------------------
 // UPubnubClient::Signal - Automated tests
 // ---------------------------------------------------------------------------
@@ -135,6 +155,10 @@ IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscribeToChannel_SubscribeThenP
 	"Pubnub.Integration.PubSub.SubscribeToChannel.4Advanced.SubscribeThenPublish_ReceivesMessage",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
 
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscribeToChannel_FilterExpression_ReceivesOnlyMatchingMessages, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.SubscribeToChannel.4Advanced.FilterExpression_ReceivesOnlyMatchingMessages",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
 // ---------------------------------------------------------------------------
 // UPubnubClient::UnsubscribeFromChannel - Automated tests (sync only)
 // ---------------------------------------------------------------------------
@@ -239,6 +263,38 @@ IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubUnsubscribeFromAll_ChannelsAndGro
 	"Pubnub.Integration.PubSub.UnsubscribeFromAll.4Advanced.ChannelsAndGroup_NoneReceiveAfter",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
 
+// ---------------------------------------------------------------------------
+// UPubnubClient::SubscribeToChannels / UpdateSubscriptions - Automated tests
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscribeToChannels_ThreeChannels_AllReceive, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.UpdateSubscriptions.2HappyPath.SubscribeToChannels_ThreeChannels_AllReceive",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubUpdateSubscriptions_RemoveOneFromBatchAndAddOne_OnlyRemovedNotReceived, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.UpdateSubscriptions.4Advanced.RemoveOneFromBatchAndAddOne_OnlyRemovedNotReceived",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+// ---------------------------------------------------------------------------
+// UPubnubClient Async subscribe / unsubscribe coalescing - Automated tests
+// ---------------------------------------------------------------------------
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscriptionCoalescing_PerCallValidation_ReturnsErrors, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.SubscriptionCoalescing.1Validation.PerCallValidation_ReturnsErrors",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscriptionCoalescing_AsyncCallsInWindow_AppliedTogether, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.SubscriptionCoalescing.2HappyPath.AsyncCallsInWindow_AppliedTogether",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscriptionCoalescing_UnsubscribeThenSubscribeSameSettings_StaysSubscribed, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.SubscriptionCoalescing.4Advanced.UnsubscribeThenSubscribeSameSettings_StaysSubscribed",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+IMPLEMENT_CUSTOM_SIMPLE_AUTOMATION_TEST(FPubnubSubscriptionCoalescing_UnsubscribeThenSubscribeNewSettings_Resubscribes, FPubnubAutomationTestBase,
+	"Pubnub.Integration.PubSub.SubscriptionCoalescing.4Advanced.UnsubscribeThenSubscribeNewSettings_Resubscribes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
 // ---------------------------------------------------------------------------
 // Input validation (fast-fail) - PUBNUB_RETURN_WRAPPER_IF_FIELD_EMPTY
 // UserID is set in all tests per requirement; we do not test UserID-not-set.
@@ -609,6 +665,184 @@ bool FPubnubPublishMessage_SubscribeThenPublish_MessageReceived::RunTest(const F
 	return true;
 }
 
+// Back-to-back sync publishes run on the same pooled context, so with default HTTP keep-alive only the first one opens a connection.
+bool FPubnubPublishMessage_Sequential_ReusesConnection::RunTest(const FString& Parameters)
+{
+	const FString TestChannel = SDK_PREFIX + "publish_keep_alive_ch";
+	const FString TestUser = SDK_PREFIX + "publish_keep_alive_user";
+	const int32 MessagesCount = 5;
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+	PubnubClient->ResetConnectionStats();
+
+	for (int32 i = 0; i < MessagesCount; i++)
+	{
+		FPubnubPublishMessageResult Result = PubnubClient->PublishMessage(TestChannel, FString::Printf(TEXT("{\"index\":%d}"), i));
+		TestFalse(FString::Printf(TEXT("Publish %d should succeed"), i), Result.Result.Error);
+	}
+
+	const FPubnubConnectionStats Stats = PubnubClient->GetConnectionStats();
+	TestEqual("Every publish is counted as a request", Stats.RequestsSent, static_cast<int64>(MessagesCount));
+	TestTrue("Connection is opened once and reused", Stats.ConnectionsOpened <= 1);
+
+	CleanUp();
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// UPubnubClient::PublishBatch
+// ---------------------------------------------------------------------------
+
+// Invalid requests fail on their own, valid requests of the same batch are still published.
+bool FPubnubPublishBatch_InvalidRequests_ReturnPerMessageErrors::RunTest(const FString& Parameters)
+{
+	const FString TestChannel = SDK_PREFIX + "publish_batch_invalid_ch";
+	const FString TestUser = SDK_PREFIX + "publish_batch_invalid_user";
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubClient->SetUserID(TestUser);
+
+	TestEqual("Empty batch returns no results", PubnubClient->PublishBatch(TArray<FPubnubPublishRequest>()).Num(), 0);
+
+	TArray<FPubnubPublishRequest> Requests;
+	Requests.Add({FString(), TEXT("\"no channel\""), FPubnubPublishSettings()});
+	Requests.Add({TestChannel, TEXT("\"valid\""), FPubnubPublishSettings()});
+	Requests.Add({TestChannel, FString(), FPubnubPublishSettings()});
+
+	TArray<FPubnubPublishMessageResult> Results = PubnubClient->PublishBatch(Requests);
+
+	if (!TestEqual("Every request has a result", Results.Num(), Requests.Num()))
+	{
+		CleanUp();
+		return true;
+	}
+	TestTrue("Request without channel fails", Results[0].Result.Error);
+	TestTrue("Error mentions Channel", Results[0].Result.ErrorMessage.Contains(TEXT("Channel")));
+	TestFalse("Valid request is published", Results[1].Result.Error);
+	TestFalse("Valid request has timetoken", Results[1].PublishedMessage.Timetoken.IsEmpty());
+	TestTrue("Request without message fails", Results[2].Result.Error);
+	TestTrue("Error mentions Message", Results[2].Result.ErrorMessage.Contains(TEXT("Message")));
+
+	CleanUp();
+	return true;
+}
+
+// Batch larger than the context pool - every message is published and results keep the order of requests.
+bool FPubnubPublishBatch_HappyPath_ResultsInRequestOrder::RunTest(const FString& Parameters)
+{
+	const FString TestChannelPrefix = SDK_PREFIX + "publish_batch_happy_ch_";
+	const FString TestUser = SDK_PREFIX + "publish_batch_happy_user";
+	const int32 MessagesCount = 20;
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	TArray<FPubnubPublishRequest> Requests;
+	for (int32 i = 0; i < MessagesCount; i++)
+	{
+		FPubnubPublishRequest Request;
+		Request.Channel = TestChannelPrefix + FString::FromInt(i % 4);
+		Request.Message = FString::Printf(TEXT("{\"index\":%d}"), i);
+		Request.PublishSettings.CustomMessageType = TEXT("batch-type");
+		Requests.Add(Request);
+	}
+
+	TArray<FPubnubPublishMessageResult> Results = PubnubClient->PublishBatch(Requests);
+
+	if (!TestEqual("Every request has a result", Results.Num(), MessagesCount))
+	{
+		CleanUp();
+		return true;
+	}
+	for (int32 i = 0; i < MessagesCount; i++)
+	{
+		TestFalse(FString::Printf(TEXT("Publish %d should succeed"), i), Results[i].Result.Error);
+		TestEqual(FString::Printf(TEXT("Publish %d HTTP status"), i), Results[i].Result.Status, 200);
+		TestEqual(FString::Printf(TEXT("Publish %d channel"), i), Results[i].PublishedMessage.Channel, Requests[i].Channel);
+		TestEqual(FString::Printf(TEXT("Publish %d message"), i), Results[i].PublishedMessage.Message, Requests[i].Message);
+		TestEqual(FString::Printf(TEXT("Publish %d CustomMessageType"), i), Results[i].PublishedMessage.CustomMessageType, Requests[i].PublishSettings.CustomMessageType);
+		TestFalse(FString::Printf(TEXT("Publish %d timetoken"), i), Results[i].PublishedMessage.Timetoken.IsEmpty());
+	}
+
+	CleanUp();
+	return true;
+}
+
+bool FPubnubPublishBatch_Async_SingleCallbackWithAllResults::RunTest(const FString& Parameters)
+{
+	const FString TestChannel = SDK_PREFIX + "publish_batch_async_ch";
+	const FString TestUser = SDK_PREFIX + "publish_batch_async_user";
+	const int32 MessagesCount = 8;
+
+	TSharedPtr<int32> CallbackCount = MakeShared<int32>(0);
+	TSharedPtr<TArray<FPubnubPublishMessageResult>> ReceivedResults = MakeShared<TArray<FPubnubPublishMessageResult>>();
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	TArray<FPubnubPublishRequest> Requests;
+	for (int32 i = 0; i < MessagesCount; i++)
+	{
+		Requests.Add({TestChannel, FString::Printf(TEXT("\"async batch %d\""), i), FPubnubPublishSettings()});
+	}
+
+	FOnPubnubPublishBatchResponseNative Callback;
+	Callback.BindLambda([CallbackCount, ReceivedResults](const TArray<FPubnubPublishMessageResult>& Results)
+	{
+		(*CallbackCount)++;
+		*ReceivedResults = Results;
+	});
+	PubnubClient->PublishBatchAsync(Requests, Callback);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([CallbackCount]() { return *CallbackCount > 0; }, MAX_WAIT_TIME));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, CallbackCount, ReceivedResults, MessagesCount]()
+	{
+		TestEqual("Callback is called exactly once", *CallbackCount, 1);
+		TestEqual("Callback receives result for every request", ReceivedResults->Num(), MessagesCount);
+		for (const FPubnubPublishMessageResult& Result : *ReceivedResults)
+		{
+			TestFalse("Publish should succeed", Result.Result.Error);
+		}
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
 // ---------------------------------------------------------------------------
 // UPubnubClient::Signal - Input validation (fast-fail)
 // ---------------------------------------------------------------------------
@@ -1319,6 +1553,83 @@ bool FPubnubSubscribeToChannel_SubscribeThenPublish_ReceivesMessage::RunTest(con
 	return true;
 }
 
+bool FPubnubSubscribeToChannel_FilterExpression_ReceivesOnlyMatchingMessages::RunTest(const FString& Parameters)
+{
+	const FString TestChannel = SDK_PREFIX + "sub_filter_ch";
+	const FString FilteredOutMessage = TEXT("\"Blue team message\"");
+	const FString MatchingMessage = TEXT("\"Red team message\"");
+	const FString TestUser = SDK_PREFIX + "sub_filter_user";
+
+	TSharedPtr<bool> bMatchingReceived = MakeShared<bool>(false);
+	TSharedPtr<bool> bFilteredOutReceived = MakeShared<bool>(false);
+	TSharedPtr<bool> bSubscribeDone = MakeShared<bool>(false);
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[TestChannel, MatchingMessage, FilteredOutMessage, bMatchingReceived, bFilteredOutReceived](const FPubnubMessageData& Msg)
+		{
+			if (Msg.Channel != TestChannel)
+			{
+				return;
+			}
+			if (Msg.Message == MatchingMessage)
+			{
+				*bMatchingReceived = true;
+			}
+			else if (Msg.Message == FilteredOutMessage)
+			{
+				*bFilteredOutReceived = true;
+			}
+		});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, TestChannel, bSubscribeDone]()
+	{
+		FPubnubSubscribeSettings SubscribeSettings;
+		SubscribeSettings.FilterExpression = TEXT("team == 'red'");
+		FPubnubOperationResult SubResult = PubnubClient->SubscribeToChannel(TestChannel, SubscribeSettings);
+		*bSubscribeDone = true;
+		TestFalse("Subscribe should succeed", SubResult.Error);
+		TestEqual("Client filter expression", PubnubClient->GetSubscribeFilterExpression(), SubscribeSettings.FilterExpression);
+	}, 0.1f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bSubscribeDone]() { return *bSubscribeDone; }, MAX_WAIT_TIME));
+
+	//Filtered out message goes first, so it would have arrived before the matching one if the filter didn't work
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, TestChannel, FilteredOutMessage, MatchingMessage]()
+	{
+		FPubnubPublishSettings PublishSettings;
+		PublishSettings.MetaData = TEXT("{\"team\":\"blue\"}");
+		FPubnubPublishMessageResult PubResult = PubnubClient->PublishMessage(TestChannel, FilteredOutMessage, PublishSettings);
+		TestFalse("Publish of filtered out message should succeed", PubResult.Result.Error);
+
+		PublishSettings.MetaData = TEXT("{\"team\":\"red\"}");
+		PubResult = PubnubClient->PublishMessage(TestChannel, MatchingMessage, PublishSettings);
+		TestFalse("Publish of matching message should succeed", PubResult.Result.Error);
+	}, 0.1f));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bMatchingReceived]() { return *bMatchingReceived; }, MAX_WAIT_TIME));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, bMatchingReceived, bFilteredOutReceived]()
+	{
+		TestTrue("Message matching the filter expression was received", *bMatchingReceived);
+		TestFalse("Message not matching the filter expression was not received", *bFilteredOutReceived);
+	}, 0.5f));
+
+	CleanUp();
+	return true;
+}
+
 // ---------------------------------------------------------------------------
 // UPubnubClient::UnsubscribeFromChannel - Input validation (fast-fail)
 // ---------------------------------------------------------------------------
@@ -2229,4 +2540,375 @@ bool FPubnubUnsubscribeFromAll_ChannelsAndGroup_UnsubscribeFromAll_NoneReceive::
 	return true;
 }
 
+// SubscribeToChannels subscribes all channels with a single change of the subscribe loop; every channel then receives its message.
+bool FPubnubSubscribeToChannels_ThreeChannels_AllReceive::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "sub_channels_user";
+	TArray<FString> Channels = { SDK_PREFIX + "sub_channels_a", SDK_PREFIX + "sub_channels_b", SDK_PREFIX + "sub_channels_c" };
+	TArray<FString> Messages = { TEXT("\"msg_a\""), TEXT("\"msg_b\""), TEXT("\"msg_c\"") };
+	TSharedPtr<TArray<bool>> Received = MakeShared<TArray<bool>>();
+	Received->Init(false, 3);
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	FPubnubOperationResult Result = PubnubClient->SubscribeToChannels(Channels, {});
+	TestFalse("SubscribeToChannels should succeed", Result.Error);
+	TestEqual("SubscribeToChannels status", Result.Status, 200);
+
+	//Already subscribed channels are skipped, so calling it again is not an error
+	FPubnubOperationResult SecondResult = PubnubClient->SubscribeToChannels(Channels, {});
+	TestFalse("Second SubscribeToChannels should succeed", SecondResult.Error);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[Channels, Messages, Received](const FPubnubMessageData& Msg)
+		{
+			for (int32 i = 0; i < 3; ++i)
+			{
+				if (Msg.Channel == Channels[i] && Msg.Message == Messages[i]) { (*Received)[i] = true; break; }
+			}
+		});
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		const int32 Idx = i;
+		ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, Channels, Messages, Idx]()
+		{
+			FPubnubPublishMessageResult PubResult = PubnubClient->PublishMessage(Channels[Idx], Messages[Idx]);
+			TestFalse(FString::Printf(TEXT("Publish to channel %d should succeed"), Idx), PubResult.Result.Error);
+		}, 0.1f));
+		ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([Received, Idx]() { return (*Received)[Idx]; }, MAX_WAIT_TIME));
+	}
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, Received]()
+	{
+		TestTrue("Channel 0 received", (*Received)[0]);
+		TestTrue("Channel 1 received", (*Received)[1]);
+		TestTrue("Channel 2 received", (*Received)[2]);
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
+// Removing one channel from a batch leaves the rest of the batch subscribed; the channel added in the same update receives as well.
+bool FPubnubUpdateSubscriptions_RemoveOneFromBatchAndAddOne_OnlyRemovedNotReceived::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "update_subs_user";
+	const FString ChannelA = SDK_PREFIX + "update_subs_a";
+	const FString ChannelB = SDK_PREFIX + "update_subs_b";
+	const FString ChannelC = SDK_PREFIX + "update_subs_c";
+	const FString ChannelD = SDK_PREFIX + "update_subs_d";
+	const FString MessageA = TEXT("\"msg_a\"");
+	const FString MessageB = TEXT("\"msg_b\"");
+	const FString MessageD = TEXT("\"msg_d\"");
+
+	TSharedPtr<bool> bReceivedA = MakeShared<bool>(false);
+	TSharedPtr<bool> bReceivedB = MakeShared<bool>(false);
+	TSharedPtr<bool> bReceivedD = MakeShared<bool>(false);
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	FPubnubOperationResult SubResult = PubnubClient->SubscribeToChannels({ChannelA, ChannelB, ChannelC}, {});
+	TestFalse("SubscribeToChannels should succeed", SubResult.Error);
+
+	FPubnubOperationResult UpdateResult = PubnubClient->UpdateSubscriptions({ChannelD}, {}, {ChannelB}, {});
+	TestFalse("UpdateSubscriptions should succeed", UpdateResult.Error);
+	TestEqual("UpdateSubscriptions status", UpdateResult.Status, 200);
+
+	//B is no longer subscribed, so unsubscribing it on its own fails
+	FPubnubOperationResult UnsubB = PubnubClient->UnsubscribeFromChannel(ChannelB);
+	TestTrue("UnsubscribeFromChannel for removed channel should fail", UnsubB.Error);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[ChannelA, ChannelB, ChannelD, MessageA, MessageB, MessageD, bReceivedA, bReceivedB, bReceivedD](const FPubnubMessageData& Msg)
+		{
+			if (Msg.Channel == ChannelA && Msg.Message == MessageA) { *bReceivedA = true; }
+			if (Msg.Channel == ChannelB && Msg.Message == MessageB) { *bReceivedB = true; }
+			if (Msg.Channel == ChannelD && Msg.Message == MessageD) { *bReceivedD = true; }
+		});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, ChannelA, ChannelB, ChannelD, MessageA, MessageB, MessageD]()
+	{
+		FPubnubPublishMessageResult PubB = PubnubClient->PublishMessage(ChannelB, MessageB);
+		FPubnubPublishMessageResult PubA = PubnubClient->PublishMessage(ChannelA, MessageA);
+		FPubnubPublishMessageResult PubD = PubnubClient->PublishMessage(ChannelD, MessageD);
+		TestFalse("Publish to A should succeed", PubA.Result.Error);
+		TestFalse("Publish to B should succeed", PubB.Result.Error);
+		TestFalse("Publish to D should succeed", PubD.Result.Error);
+	}, 0.1f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bReceivedA, bReceivedD]() { return *bReceivedA && *bReceivedD; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, bReceivedA, bReceivedB, bReceivedD]()
+	{
+		TestTrue("Channel A (still in batch) received", *bReceivedA);
+		TestTrue("Channel D (added by update) received", *bReceivedD);
+		TestFalse("Channel B (removed by update) must not receive", *bReceivedB);
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
+bool FPubnubSubscriptionCoalescing_PerCallValidation_ReturnsErrors::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "coalescing_validation_user";
+	const FString TestChannel = SDK_PREFIX + "coalescing_validation_ch";
+	const FString NotSubscribedChannel = SDK_PREFIX + "coalescing_validation_not_subscribed_ch";
+
+	TArray<TSharedPtr<FPubnubOperationResult>> Results;
+	TSharedPtr<int32> CallbacksCount = MakeShared<int32>(0);
+	auto MakeCallback = [&Results, CallbacksCount]()
+	{
+		TSharedPtr<FPubnubOperationResult> Result = MakeShared<FPubnubOperationResult>();
+		Results.Add(Result);
+		return FOnPubnubSubscribeOperationResponseNative::CreateLambda([Result, CallbacksCount](const FPubnubOperationResult& OperationResult)
+		{
+			*Result = OperationResult;
+			(*CallbacksCount)++;
+		});
+	};
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubClient->SetUserID(TestUser);
+
+	//All calls are made within one coalescing window. Each of them is still validated against the state left by the earlier ones
+	PubnubClient->SubscribeToChannelAsync(TestChannel, MakeCallback());
+	PubnubClient->SubscribeToChannelAsync(TestChannel, MakeCallback());
+	PubnubClient->SubscribeToChannelAsync(FString(), MakeCallback());
+	PubnubClient->UnsubscribeFromChannelAsync(NotSubscribedChannel, MakeCallback());
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([CallbacksCount]() { return *CallbacksCount == 4; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, Results, CallbacksCount]()
+	{
+		TestEqual("Every call should get its own callback", *CallbacksCount, 4);
+		TestFalse("First subscribe should succeed", Results[0]->Error);
+		TestEqual("First subscribe status", Results[0]->Status, 200);
+		TestTrue("Second subscribe to the same channel should fail", Results[1]->Error);
+		TestTrue("ErrorMessage should mention already subscribed", Results[1]->ErrorMessage.Contains(TEXT("Already subscribed")));
+		TestTrue("Subscribe to empty channel should fail", Results[2]->Error);
+		TestTrue("Unsubscribe from channel that is not subscribed should fail", Results[3]->Error);
+		TestTrue("ErrorMessage should mention missing subscription", Results[3]->ErrorMessage.Contains(TEXT("no such subscription")));
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
+bool FPubnubSubscriptionCoalescing_AsyncCallsInWindow_AppliedTogether::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "coalescing_window_user";
+	const FString ChannelA = SDK_PREFIX + "coalescing_window_a";
+	const FString ChannelB = SDK_PREFIX + "coalescing_window_b";
+	const FString ChannelC = SDK_PREFIX + "coalescing_window_c";
+	const FString MessageA = TEXT("\"msg_a\"");
+	const FString MessageB = TEXT("\"msg_b\"");
+	const FString MessageC = TEXT("\"msg_c\"");
+
+	TSharedPtr<int32> SucceededCount = MakeShared<int32>(0);
+	TSharedPtr<int32> CallbacksCount = MakeShared<int32>(0);
+	TSharedPtr<bool> bReceivedA = MakeShared<bool>(false);
+	TSharedPtr<bool> bReceivedB = MakeShared<bool>(false);
+	TSharedPtr<bool> bReceivedC = MakeShared<bool>(false);
+	FOnPubnubSubscribeOperationResponseNative Callback = FOnPubnubSubscribeOperationResponseNative::CreateLambda([SucceededCount, CallbacksCount](const FPubnubOperationResult& Result)
+	{
+		if (!Result.Error) { (*SucceededCount)++; }
+		(*CallbacksCount)++;
+	});
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	//B is subscribed and unsubscribed within the window, so only A and C reach the subscribe loop
+	PubnubClient->SubscribeToChannelAsync(ChannelA, Callback);
+	PubnubClient->SubscribeToChannelAsync(ChannelB, Callback);
+	PubnubClient->SubscribeToChannelAsync(ChannelC, Callback);
+	PubnubClient->UnsubscribeFromChannelAsync(ChannelB, Callback);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[ChannelA, ChannelB, ChannelC, MessageA, MessageB, MessageC, bReceivedA, bReceivedB, bReceivedC](const FPubnubMessageData& Msg)
+		{
+			if (Msg.Channel == ChannelA && Msg.Message == MessageA) { *bReceivedA = true; }
+			if (Msg.Channel == ChannelB && Msg.Message == MessageB) { *bReceivedB = true; }
+			if (Msg.Channel == ChannelC && Msg.Message == MessageC) { *bReceivedC = true; }
+		});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([CallbacksCount]() { return *CallbacksCount == 4; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, SucceededCount, ChannelA, ChannelB, ChannelC, MessageA, MessageB, MessageC]()
+	{
+		TestEqual("All coalesced calls should succeed", *SucceededCount, 4);
+
+		//B is not subscribed anymore, so unsubscribing it on its own fails
+		FPubnubOperationResult UnsubB = PubnubClient->UnsubscribeFromChannel(ChannelB);
+		TestTrue("UnsubscribeFromChannel for channel removed within the window should fail", UnsubB.Error);
+
+		FPubnubPublishMessageResult PubB = PubnubClient->PublishMessage(ChannelB, MessageB);
+		FPubnubPublishMessageResult PubA = PubnubClient->PublishMessage(ChannelA, MessageA);
+		FPubnubPublishMessageResult PubC = PubnubClient->PublishMessage(ChannelC, MessageC);
+		TestFalse("Publish to A should succeed", PubA.Result.Error);
+		TestFalse("Publish to B should succeed", PubB.Result.Error);
+		TestFalse("Publish to C should succeed", PubC.Result.Error);
+	}, 0.1f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bReceivedA, bReceivedC]() { return *bReceivedA && *bReceivedC; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, bReceivedA, bReceivedB, bReceivedC]()
+	{
+		TestTrue("Channel A received", *bReceivedA);
+		TestTrue("Channel C received", *bReceivedC);
+		TestFalse("Channel B (unsubscribed within the window) must not receive", *bReceivedB);
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
+bool FPubnubSubscriptionCoalescing_UnsubscribeThenSubscribeSameSettings_StaysSubscribed::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "coalescing_same_settings_user";
+	const FString TestChannel = SDK_PREFIX + "coalescing_same_settings_ch";
+	const FString TestMessage = TEXT("\"Still subscribed\"");
+
+	TSharedPtr<int32> SucceededCount = MakeShared<int32>(0);
+	TSharedPtr<int32> CallbacksCount = MakeShared<int32>(0);
+	TSharedPtr<bool> bMessageReceived = MakeShared<bool>(false);
+	FOnPubnubSubscribeOperationResponseNative Callback = FOnPubnubSubscribeOperationResponseNative::CreateLambda([SucceededCount, CallbacksCount](const FPubnubOperationResult& Result)
+	{
+		if (!Result.Error) { (*SucceededCount)++; }
+		(*CallbacksCount)++;
+	});
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	FPubnubOperationResult SubResult = PubnubClient->SubscribeToChannel(TestChannel);
+	TestFalse("Initial subscribe should succeed", SubResult.Error);
+
+	//Same settings as the existing subscription, so the pair cancels out and the subscription is not touched
+	PubnubClient->UnsubscribeFromChannelAsync(TestChannel, Callback);
+	PubnubClient->SubscribeToChannelAsync(TestChannel, Callback);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[TestChannel, TestMessage, bMessageReceived](const FPubnubMessageData& Msg)
+		{
+			if (Msg.Channel == TestChannel && Msg.Message == TestMessage) { *bMessageReceived = true; }
+		});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([CallbacksCount]() { return *CallbacksCount == 2; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, SucceededCount, TestChannel, TestMessage]()
+	{
+		TestEqual("Both coalesced calls should succeed", *SucceededCount, 2);
+		FPubnubPublishMessageResult PubResult = PubnubClient->PublishMessage(TestChannel, TestMessage);
+		TestFalse("Publish should succeed", PubResult.Result.Error);
+	}, 0.1f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bMessageReceived]() { return *bMessageReceived; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, bMessageReceived, TestChannel]()
+	{
+		TestTrue("Channel is still subscribed", *bMessageReceived);
+		FPubnubOperationResult UnsubResult = PubnubClient->UnsubscribeFromChannel(TestChannel);
+		TestFalse("Channel subscription should still exist", UnsubResult.Error);
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
+bool FPubnubSubscriptionCoalescing_UnsubscribeThenSubscribeNewSettings_Resubscribes::RunTest(const FString& Parameters)
+{
+	const FString TestUser = SDK_PREFIX + "coalescing_new_settings_user";
+	const FString TestChannel = SDK_PREFIX + "coalescing_new_settings_ch";
+	const FString PresenceChannel = TestChannel + TEXT("-pnpres");
+
+	TSharedPtr<int32> SucceededCount = MakeShared<int32>(0);
+	TSharedPtr<int32> CallbacksCount = MakeShared<int32>(0);
+	TSharedPtr<bool> bPresenceEventReceived = MakeShared<bool>(false);
+	FOnPubnubSubscribeOperationResponseNative Callback = FOnPubnubSubscribeOperationResponseNative::CreateLambda([SucceededCount, CallbacksCount](const FPubnubOperationResult& Result)
+	{
+		if (!Result.Error) { (*SucceededCount)++; }
+		(*CallbacksCount)++;
+	});
+
+	if (!InitTest())
+	{
+		AddError("InitTest failed");
+		return false;
+	}
+
+	PubnubSubsystem->OnPubnubErrorNative.AddLambda([this](FString ErrorMessage, EPubnubErrorType ErrorType)
+	{
+		AddError(ErrorMessage);
+	});
+	PubnubClient->SetUserID(TestUser);
+
+	FPubnubOperationResult SubResult = PubnubClient->SubscribeToChannel(TestChannel);
+	TestFalse("Initial subscribe without presence should succeed", SubResult.Error);
+
+	//Settings differ, so the pair must not cancel out - the channel is subscribed again with presence events
+	FPubnubSubscribeSettings PresenceSettings;
+	PresenceSettings.ReceivePresenceEvents = true;
+	PubnubClient->UnsubscribeFromChannelAsync(TestChannel, Callback);
+	PubnubClient->SubscribeToChannelAsync(TestChannel, Callback, PresenceSettings);
+
+	PubnubClient->OnMessageReceivedNative.AddLambda(
+		[PresenceChannel, bPresenceEventReceived](const FPubnubMessageData& Msg)
+		{
+			if (Msg.Channel == PresenceChannel) { *bPresenceEventReceived = true; }
+		});
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([CallbacksCount]() { return *CallbacksCount == 2; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, SucceededCount, TestChannel]()
+	{
+		TestEqual("Both coalesced calls should succeed", *SucceededCount, 2);
+		//State change is reported on the presence channel, which is received only with the new settings
+		FPubnubOperationResult SetStateResult = PubnubClient->SetState(TestChannel, TEXT("{\"coalescing\":true}"));
+		TestFalse("SetState should succeed", SetStateResult.Error);
+	}, 0.5f));
+	ADD_LATENT_AUTOMATION_COMMAND(FWaitUntilLatentCommand([bPresenceEventReceived]() { return *bPresenceEventReceived; }, MAX_WAIT_TIME));
+	ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([this, bPresenceEventReceived]()
+	{
+		TestTrue("Presence event received after subscribing again with new settings", *bPresenceEventReceived);
+	}, 0.1f));
+
+	CleanUp();
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
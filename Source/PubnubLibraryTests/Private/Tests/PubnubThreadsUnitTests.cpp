@@ -0,0 +1,509 @@
+// Copyright 2026 PubNub Inc. All Rights Reserved.
+
+#include "Threads/PubnubContextPool.h"
+#include "Threads/PubnubFunctionThread.h"
+#include "Threads/PubnubMpscRingBuffer.h"
+#include "HAL/PlatformProcess.h"
+#include "Async/Async.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolAcquireReleaseUnitTest, "Pubnub.aUnit.Threads.ContextPoolAcquireRelease", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolLeaseUnitTest, "Pubnub.aUnit.Threads.ContextPoolLease", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolAcquireWaitsUnitTest, "Pubnub.aUnit.Threads.ContextPoolAcquireWaits", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolWakesAllWaitersUnitTest, "Pubnub.aUnit.Threads.ContextPoolWakesAllWaiters", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolReservedContextUnitTest, "Pubnub.aUnit.Threads.ContextPoolReservedContext", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContextPoolAuthTokenGenerationUnitTest, "Pubnub.aUnit.Threads.ContextPoolAuthTokenGeneration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionThreadExecutesInClassOrderUnitTest, "Pubnub.aUnit.Threads.FunctionThreadExecutesInClassOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionThreadClassConcurrencyUnitTest, "Pubnub.aUnit.Threads.FunctionThreadClassConcurrency", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionThreadClassIsolationUnitTest, "Pubnub.aUnit.Threads.FunctionThreadClassIsolation", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFunctionThreadStateChangeBarrierUnitTest, "Pubnub.aUnit.Threads.FunctionThreadStateChangeBarrier", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpscRingBufferPushPopUnitTest, "Pubnub.aUnit.Threads.MpscRingBufferPushPop", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMpscRingBufferMultipleProducersUnitTest, "Pubnub.aUnit.Threads.MpscRingBufferMultipleProducers", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+
+namespace
+{
+	//Blocks the calling thread until Condition is true or Timeout (in seconds) passes
+	bool WaitForCondition(TFunctionRef<bool()> Condition, double Timeout = 5.0)
+	{
+		const double EndTime = FPlatformTime::Seconds() + Timeout;
+		while(!Condition())
+		{
+			if(FPlatformTime::Seconds() > EndTime)
+			{
+				return false;
+			}
+			FPlatformProcess::Sleep(0.001f);
+		}
+		return true;
+	}
+}
+
+
+bool FContextPoolAcquireReleaseUnitTest::RunTest(const FString& Parameters)
+{
+	// Pool size is clamped to at least one context
+	FPubnubContextPool EmptySizePool(0);
+	TestEqual("Pool size 0 is clamped to 1", EmptySizePool.Num(), 1);
+
+	FPubnubContextPool Pool(2);
+	TestEqual("Pool has requested amount of slots", Pool.Num(), 2);
+
+	// Nothing can be acquired before contexts are allocated
+	TestEqual("TryAcquire before allocation returns INDEX_NONE", Pool.TryAcquire(), INDEX_NONE);
+
+	TestTrue("AllocateContexts succeeds", Pool.AllocateContexts("demo", "demo"));
+	TestNotNull("Primary context is allocated", Pool.GetPrimaryContext());
+
+	int32 ContextsCount = 0;
+	Pool.ForEachContext([&ContextsCount](pubnub_t* Context){ ContextsCount++; });
+	TestEqual("ForEachContext visits every context", ContextsCount, 2);
+
+	const int32 First = Pool.TryAcquire();
+	const int32 Second = Pool.TryAcquire();
+	TestNotEqual("First acquire succeeds", First, INDEX_NONE);
+	TestNotEqual("Second acquire succeeds", Second, INDEX_NONE);
+	TestNotEqual("Acquired slots are different", First, Second);
+	TestTrue("Acquired contexts are different", Pool.GetContext(First) != Pool.GetContext(Second));
+	TestEqual("Third acquire fails when every context is busy", Pool.TryAcquire(), INDEX_NONE);
+
+	Pool.Release(First);
+	TestEqual("Released slot is acquired again", Pool.TryAcquire(), First);
+
+	Pool.Release(First);
+	Pool.Release(Second);
+
+	Pool.LockAll();
+	Pool.FreeContexts();
+	Pool.UnlockAll();
+	TestNull("Contexts are freed", Pool.GetPrimaryContext());
+	TestEqual("TryAcquire after FreeContexts returns INDEX_NONE", Pool.TryAcquire(), INDEX_NONE);
+
+	return true;
+}
+
+bool FContextPoolLeaseUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubContextPool Pool(1);
+	Pool.AllocateContexts("demo", "demo");
+
+	{
+		FPubnubContextLease Lease(&Pool);
+		TestTrue("Lease acquires free context", Lease.TryAcquire());
+		TestTrue("Lease exposes checked out context", Lease.Get() == Pool.GetPrimaryContext());
+
+		FPubnubContextLease SecondLease(&Pool);
+		TestFalse("Second lease fails when pool is exhausted", SecondLease.TryAcquire());
+		TestNull("Failed lease has no context", SecondLease.Get());
+	}
+
+	{
+		FPubnubContextLease Lease(&Pool);
+		TestTrue("Context is returned to the pool when lease goes out of scope", Lease.TryAcquire());
+	}
+
+	FPubnubContextLease NullPoolLease(nullptr);
+	TestFalse("Lease without pool fails", NullPoolLease.TryAcquire());
+
+	return true;
+}
+
+bool FContextPoolAcquireWaitsUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubContextPool Pool(1);
+	Pool.AllocateContexts("demo", "demo");
+
+	const int32 Busy = Pool.TryAcquire();
+	TestNotEqual("Context is acquired", Busy, INDEX_NONE);
+	TestEqual("Acquire gives up after the timeout when nothing is released", Pool.Acquire(20), INDEX_NONE);
+
+	// Context released on another thread while Acquire waits is handed to the waiter
+	FPubnubFunctionThread Releaser(1);
+	Releaser.AddFunctionToQueue([&Pool, Busy]
+	{
+		FPlatformProcess::Sleep(0.05f);
+		Pool.Release(Busy);
+	});
+	const int32 Waited = Pool.Acquire(5000);
+	TestEqual("Acquire gets the context released during the wait", Waited, Busy);
+
+	// CancelAll wakes waiters up, so deinitialization doesn't wait for the full timeout
+	Releaser.AddFunctionToQueue([&Pool]
+	{
+		FPlatformProcess::Sleep(0.05f);
+		Pool.CancelAll();
+	});
+	const double StartTime = FPlatformTime::Seconds();
+	TestEqual("Acquire fails when CancelAll is called during the wait", Pool.Acquire(5000), INDEX_NONE);
+	TestTrue("Cancelled Acquire returns before the timeout", FPlatformTime::Seconds() - StartTime < 4.0);
+	Pool.Release(Waited);
+
+	// Locked pool fails right away
+	Pool.LockAll();
+	TestEqual("Acquire fails while the pool is locked", Pool.Acquire(5000), INDEX_NONE);
+	Pool.UnlockAll();
+
+	return true;
+}
+
+bool FContextPoolWakesAllWaitersUnitTest::RunTest(const FString& Parameters)
+{
+	const int32 PoolSize = 4;
+	FPubnubContextPool Pool(PoolSize);
+	Pool.AllocateContexts("demo", "demo");
+
+	TArray<int32> BusySlots;
+	for(int32 i = 0; i < PoolSize; i++)
+	{
+		BusySlots.Add(Pool.TryAcquire());
+	}
+	TestFalse("All contexts are acquired", BusySlots.Contains(INDEX_NONE));
+
+	// Every waiter keeps the context it gets, so only the releases below can wake them up
+	std::atomic<int32> WaitersStarted{0};
+	std::atomic<int32> WaitersServed{0};
+	TArray<TFuture<void>> Waiters;
+	for(int32 i = 0; i < PoolSize; i++)
+	{
+		Waiters.Add(Async(EAsyncExecution::Thread, [&Pool, &WaitersStarted, &WaitersServed]
+		{
+			WaitersStarted++;
+			if(Pool.Acquire(5000) != INDEX_NONE)
+			{
+				WaitersServed++;
+			}
+		}));
+	}
+	const double StartWaitTime = FPlatformTime::Seconds();
+	while(WaitersStarted.load() < PoolSize && FPlatformTime::Seconds() - StartWaitTime < 5.0)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	//Let the waiters block in Acquire
+	FPlatformProcess::Sleep(0.1f);
+
+	// Back-to-back releases can merge into a single wake-up, which has to reach every waiter anyway
+	const double StartTime = FPlatformTime::Seconds();
+	for(const int32 Slot : BusySlots)
+	{
+		Pool.Release(Slot);
+	}
+	for(TFuture<void>& Waiter : Waiters)
+	{
+		Waiter.Wait();
+	}
+
+	TestEqual("Every waiter gets a released context", WaitersServed.load(), PoolSize);
+	TestTrue("Waiters don't wait for the timeout", FPlatformTime::Seconds() - StartTime < 4.0);
+
+	return true;
+}
+
+bool FContextPoolReservedContextUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubContextPool Pool(1, 1);
+	Pool.AllocateContexts("demo", "demo");
+	TestEqual("Pool has shared and reserved slots", Pool.Num(), 2);
+	TestEqual("Pool has one reserved slot", Pool.NumReserved(), 1);
+
+	// Thread without bound reserved context only gets shared ones
+	const int32 Shared = Pool.TryAcquire();
+	TestEqual("Shared context is acquired first", Shared, 0);
+	TestEqual("Reserved context is not handed out to unbound thread", Pool.TryAcquire(), INDEX_NONE);
+	Pool.Release(Shared);
+
+	Pool.BindReservedContextToCurrentThread(0);
+	const int32 Reserved = Pool.TryAcquire();
+	TestEqual("Bound thread gets its reserved context", Reserved, 1);
+	TestEqual("Bound thread falls back to shared context when reserved one is busy", Pool.TryAcquire(), 0);
+	Pool.Release(0);
+	Pool.Release(Reserved);
+
+	Pool.BindReservedContextToCurrentThread(INDEX_NONE);
+	TestEqual("Unbound thread gets shared context again", Pool.TryAcquire(), 0);
+	Pool.Release(0);
+
+	return true;
+}
+
+bool FContextPoolAuthTokenGenerationUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubContextPool Pool(2);
+	Pool.AllocateContexts("demo", "demo");
+	TestEqual("No token was published yet", Pool.GetOldestAuthTokenGeneration(), (uint64)0);
+
+	// Idle contexts switch right away
+	Pool.PublishAuthToken("token_1", 1);
+	TestEqual("Idle contexts use the published token", Pool.GetOldestAuthTokenGeneration(), (uint64)1);
+
+	// Busy context keeps the previous token until it's released, publishing doesn't wait for it
+	const int32 Busy = Pool.TryAcquire();
+	TestNotEqual("Context is acquired", Busy, INDEX_NONE);
+	Pool.PublishAuthToken("token_2", 2);
+	TestEqual("Busy context may still point to the previous token", Pool.GetOldestAuthTokenGeneration(), (uint64)1);
+	Pool.Release(Busy);
+	TestEqual("Released context switches to the latest token", Pool.GetOldestAuthTokenGeneration(), (uint64)2);
+
+	// While the pool is locked contexts are not touched, they switch on the next checkout
+	Pool.LockAll();
+	Pool.PublishAuthToken("token_3", 3);
+	Pool.UnlockAll();
+	TestEqual("Locked pool keeps the previous token", Pool.GetOldestAuthTokenGeneration(), (uint64)2);
+	const int32 First = Pool.TryAcquire();
+	const int32 Second = Pool.TryAcquire();
+	TestEqual("Checked out contexts use the latest token", Pool.GetOldestAuthTokenGeneration(), (uint64)3);
+	Pool.Release(First);
+	Pool.Release(Second);
+
+	// Freed contexts don't hold old tokens back
+	Pool.LockAll();
+	Pool.FreeContexts();
+	Pool.UnlockAll();
+	Pool.PublishAuthToken("token_4", 4);
+	TestEqual("Pool without contexts reports the latest generation", Pool.GetOldestAuthTokenGeneration(), (uint64)4);
+
+	return true;
+}
+
+bool FFunctionThreadExecutesInClassOrderUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubFunctionThread FunctionThread(4);
+	TestEqual("Requested amount of workers is created", FunctionThread.GetWorkerCount(), 4);
+	TestEqual("Class can use all workers by default", FunctionThread.GetMaxConcurrency(EPubnubOperationClass::Publish), 4);
+
+	// Class capped to one function at a time is strictly sequential
+	FunctionThread.SetMaxConcurrency(EPubnubOperationClass::Publish, 1);
+
+	constexpr int32 FunctionsCount = 200;
+	FCriticalSection OrderMutex;
+	TArray<int32> ExecutionOrder;
+	std::atomic<int32> ExecutedCount{0};
+
+	for(int32 i = 0; i < FunctionsCount; i++)
+	{
+		FunctionThread.AddFunctionToQueue([i, &OrderMutex, &ExecutionOrder, &ExecutedCount]
+		{
+			{
+				FScopeLock Lock(&OrderMutex);
+				ExecutionOrder.Add(i);
+			}
+			ExecutedCount++;
+		}, EPubnubOperationClass::Publish);
+	}
+
+	TestTrue("All queued functions are executed", WaitForCondition([&ExecutedCount]{ return ExecutedCount.load() == FunctionsCount; }));
+
+	FScopeLock Lock(&OrderMutex);
+	bool bInOrder = ExecutionOrder.Num() == FunctionsCount;
+	for(int32 i = 0; bInOrder && i < FunctionsCount; i++)
+	{
+		bInOrder = ExecutionOrder[i] == i;
+	}
+	TestTrue("Functions of the same class are executed in the order they were queued", bInOrder);
+
+	return true;
+}
+
+bool FFunctionThreadClassConcurrencyUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubFunctionThread FunctionThread(3);
+
+	std::atomic<bool> bRelease{false};
+	std::atomic<int32> RunningNow{0};
+	std::atomic<int32> MaxRunning{0};
+	std::atomic<int32> FinishedCount{0};
+	auto QueueBlockingFunctions = [&](int32 Count)
+	{
+		for(int32 i = 0; i < Count; i++)
+		{
+			FunctionThread.AddFunctionToQueue([&]
+			{
+				const int32 Running = ++RunningNow;
+				int32 PreviousMax = MaxRunning.load();
+				while(Running > PreviousMax && !MaxRunning.compare_exchange_weak(PreviousMax, Running)) {}
+				WaitForCondition([&bRelease]{ return bRelease.load(); });
+				RunningNow--;
+				FinishedCount++;
+			}, EPubnubOperationClass::Publish);
+		}
+	};
+
+	// Slow functions of one class don't wait for each other
+	QueueBlockingFunctions(3);
+	TestTrue("Functions of one class run on all workers at once", WaitForCondition([&RunningNow]{ return RunningNow.load() == 3; }));
+	bRelease = true;
+	TestTrue("All functions finish", WaitForCondition([&FinishedCount]{ return FinishedCount.load() == 3; }));
+
+	// Capped class never runs more functions than allowed
+	bRelease = false;
+	MaxRunning = 0;
+	FunctionThread.SetMaxConcurrency(EPubnubOperationClass::Publish, 2);
+	TestEqual("Cap is applied", FunctionThread.GetMaxConcurrency(EPubnubOperationClass::Publish), 2);
+	QueueBlockingFunctions(3);
+	TestTrue("Capped class runs up to the cap", WaitForCondition([&RunningNow]{ return RunningNow.load() == 2; }));
+	FPlatformProcess::Sleep(0.05f);
+	TestEqual("Capped class doesn't exceed the cap", MaxRunning.load(), 2);
+	bRelease = true;
+	TestTrue("Capped functions finish", WaitForCondition([&FinishedCount]{ return FinishedCount.load() == 6; }));
+
+	FunctionThread.SetMaxConcurrency(EPubnubOperationClass::Publish, 100);
+	TestEqual("Cap is limited to the worker count", FunctionThread.GetMaxConcurrency(EPubnubOperationClass::Publish), 3);
+
+	return true;
+}
+
+bool FFunctionThreadClassIsolationUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubFunctionThread FunctionThread(2);
+
+	std::atomic<bool> bReleaseAppContext{false};
+	std::atomic<bool> bAppContextFinished{false};
+	std::atomic<bool> bPublishFinished{false};
+
+	// Simulates a slow App Context page fetch
+	FunctionThread.AddFunctionToQueue([&bReleaseAppContext, &bAppContextFinished]
+	{
+		WaitForCondition([&bReleaseAppContext]{ return bReleaseAppContext.load(); });
+		bAppContextFinished = true;
+	}, EPubnubOperationClass::AppContext);
+
+	FunctionThread.AddFunctionToQueue([&bPublishFinished]
+	{
+		bPublishFinished = true;
+	}, EPubnubOperationClass::Publish);
+
+	TestTrue("Publish is executed while App Context function is still running", WaitForCondition([&bPublishFinished]{ return bPublishFinished.load(); }));
+	TestFalse("App Context function is still running", bAppContextFinished.load());
+
+	bReleaseAppContext = true;
+	TestTrue("App Context function finishes", WaitForCondition([&bAppContextFinished]{ return bAppContextFinished.load(); }));
+
+	return true;
+}
+
+bool FFunctionThreadStateChangeBarrierUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubFunctionThread FunctionThread(3);
+
+	std::atomic<bool> bHistoryFinished{false};
+	std::atomic<bool> bHistoryFinishedBeforeStateChange{false};
+	std::atomic<bool> bStateChangeFinished{false};
+	std::atomic<bool> bStateChangeFinishedBeforePublish{false};
+	std::atomic<bool> bPublishFinished{false};
+
+	FunctionThread.AddFunctionToQueue([&bHistoryFinished]
+	{
+		FPlatformProcess::Sleep(0.05f);
+		bHistoryFinished = true;
+	}, EPubnubOperationClass::History);
+
+	FunctionThread.AddFunctionToQueue([&]
+	{
+		bHistoryFinishedBeforeStateChange = bHistoryFinished.load();
+		FPlatformProcess::Sleep(0.05f);
+		bStateChangeFinished = true;
+	}, EPubnubOperationClass::StateChange);
+
+	FunctionThread.AddFunctionToQueue([&]
+	{
+		bStateChangeFinishedBeforePublish = bStateChangeFinished.load();
+		bPublishFinished = true;
+	}, EPubnubOperationClass::Publish);
+
+	TestTrue("All functions are executed", WaitForCondition([&bPublishFinished]{ return bPublishFinished.load(); }));
+	TestTrue("StateChange waits for functions queued before it", bHistoryFinishedBeforeStateChange.load());
+	TestTrue("Functions queued after StateChange wait for it", bStateChangeFinishedBeforePublish.load());
+
+	return true;
+}
+
+bool FMpscRingBufferPushPopUnitTest::RunTest(const FString& Parameters)
+{
+	TPubnubMpscRingBuffer<FString> Buffer(3);
+	TestEqual("Capacity is rounded up to power of two", static_cast<int32>(Buffer.Capacity()), 4);
+
+	FString Popped;
+	TestFalse("Pop from empty buffer fails", Buffer.TryPop(Popped));
+
+	for(int32 i = 0; i < 4; i++)
+	{
+		TestTrue(FString::Printf(TEXT("Push %d succeeds"), i), Buffer.TryPush(FString::FromInt(i)));
+	}
+	FString Overflow = TEXT("overflow");
+	TestFalse("Push to full buffer fails", Buffer.TryPush(MoveTemp(Overflow)));
+	TestEqual("Failed push leaves the element untouched", Overflow, FString(TEXT("overflow")));
+
+	TestTrue("Pop succeeds", Buffer.TryPop(Popped));
+	TestEqual("Elements are popped in push order", Popped, FString(TEXT("0")));
+
+	// Wrap around the end of the buffer
+	TestTrue("Push after pop succeeds", Buffer.TryPush(TEXT("4")));
+	for(int32 i = 1; i <= 4; i++)
+	{
+		TestTrue(FString::Printf(TEXT("Pop %d succeeds"), i), Buffer.TryPop(Popped));
+		TestEqual(FString::Printf(TEXT("Element %d keeps order after wrap around"), i), Popped, FString::FromInt(i));
+	}
+	TestFalse("Buffer is empty again", Buffer.TryPop(Popped));
+
+	return true;
+}
+
+bool FMpscRingBufferMultipleProducersUnitTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 ProducersCount = 4;
+	constexpr int32 ItemsPerProducer = 5000;
+
+	// Small buffer, so producers regularly hit the full buffer and have to wait for the consumer
+	TPubnubMpscRingBuffer<int32> Buffer(64);
+	std::atomic<int32> FinishedProducers{0};
+	std::atomic<int32> FailedPushes{0};
+
+	FPubnubFunctionThread Producers(ProducersCount);
+	for(int32 ProducerIndex = 0; ProducerIndex < ProducersCount; ProducerIndex++)
+	{
+		Producers.AddFunctionToQueue([&Buffer, &FinishedProducers, &FailedPushes, ProducerIndex]
+		{
+			for(int32 i = 0; i < ItemsPerProducer; i++)
+			{
+				if(!Buffer.Push(ProducerIndex * ItemsPerProducer + i, 10.0))
+				{
+					FailedPushes++;
+				}
+			}
+			FinishedProducers++;
+		});
+	}
+
+	TArray<int32> LastSeen;
+	LastSeen.Init(-1, ProducersCount);
+	int32 ReceivedCount = 0;
+	bool bProducerOrderKept = true;
+	const double EndTime = FPlatformTime::Seconds() + 10.0;
+	while(ReceivedCount < ProducersCount * ItemsPerProducer && FPlatformTime::Seconds() < EndTime)
+	{
+		int32 Value = 0;
+		if(!Buffer.TryPop(Value))
+		{
+			FPlatformProcess::Yield();
+			continue;
+		}
+		const int32 ProducerIndex = Value / ItemsPerProducer;
+		const int32 ItemIndex = Value % ItemsPerProducer;
+		bProducerOrderKept &= ItemIndex == LastSeen[ProducerIndex] + 1;
+		LastSeen[ProducerIndex] = ItemIndex;
+		ReceivedCount++;
+	}
+
+	TestEqual("Every pushed element is popped exactly once", ReceivedCount, ProducersCount * ItemsPerProducer);
+	TestTrue("Elements of a single producer keep their order", bProducerOrderKept);
+	TestTrue("All producers finished", WaitForCondition([&FinishedProducers]{ return FinishedProducers.load() == ProducersCount; }));
+	TestEqual("No push waited longer than its timeout", FailedPushes.load(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "FunctionLibraries/PubnubTokenUtilities.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
+#include "AccessManager/PubnubTokenCache.h"
 #include "Dom/JsonObject.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
@@ -15,6 +16,8 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubReworkParsedTokenUnitTest, "Pubnub.aUnit
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCalculateChannelPermissionsBitmaskUnitTest, "Pubnub.aUnit.TokenUtilities.CalculateChannelPermissionsBitmask", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCalculateChannelGroupPermissionsBitmaskUnitTest, "Pubnub.aUnit.TokenUtilities.CalculateChannelGroupPermissionsBitmask", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCalculateUserPermissionsBitmaskUnitTest, "Pubnub.aUnit.TokenUtilities.CalculateUserPermissionsBitmask", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubParsedTokenPermissionsUnitTest, "Pubnub.aUnit.TokenUtilities.ParsedTokenPermissions", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPubnubTokenCacheUnitTest, "Pubnub.aUnit.TokenUtilities.TokenCache", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 
 
 bool FPubnubGrantTokenPermissionsStructureUnitTest::RunTest(const FString& Parameters)
@@ -573,4 +576,93 @@ bool FCalculateUserPermissionsBitmaskUnitTest::RunTest(const FString& Parameters
     return true;
 }
 
+bool FPubnubParsedTokenPermissionsUnitTest::RunTest(const FString& Parameters)
+{
+    FString SampleParsedToken = TEXT(R"({"v":2,"t":1752219810,"ttl":30,"aud":"server_user","res":{"chan":{"my_channel":3},"grp":{"my_group":5},"uuid":{"User1":104}},"pat":{"chan":{"^team-.*$":128,"^lobby$":1,"room-[0-9]+$":2},"grp":{},"uuid":{"^npc-":32}}})");
+
+    TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedToken = FPubnubParsedToken::FromParsedTokenJson(SampleParsedToken);
+    TestTrue("Token should be parsed", ParsedToken.IsValid());
+    if (!ParsedToken.IsValid())
+    {
+        return false;
+    }
+
+    // Main fields
+    TestEqual("Version should be 2", ParsedToken->Version, 2);
+    TestEqual("Timestamp should match", ParsedToken->Timestamp, static_cast<int64>(1752219810));
+    TestEqual("TTL should be 30", ParsedToken->TTL, 30);
+    TestEqual("Authorized user should match", ParsedToken->AuthorizedUser, FString("server_user"));
+    TestFalse("Token should be valid before TTL passes", ParsedToken->IsExpired(1752219810 + 30 * 60 - 1));
+    TestTrue("Token should expire after TTL", ParsedToken->IsExpired(1752219810 + 30 * 60));
+
+    // Resources
+    TestTrue("Channel Read", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "my_channel", EPubnubTokenPermission::PTP_Read));
+    TestTrue("Channel Write", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "my_channel", EPubnubTokenPermission::PTP_Write));
+    TestFalse("Channel Manage not granted", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "my_channel", EPubnubTokenPermission::PTP_Manage));
+    TestTrue("Group Manage", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_ChannelGroup, "my_group", EPubnubTokenPermission::PTP_Manage));
+    TestFalse("Channel permissions don't apply to group with the same name", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_ChannelGroup, "my_channel", EPubnubTokenPermission::PTP_Read));
+    TestTrue("User Update", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_User, "User1", EPubnubTokenPermission::PTP_Update));
+    TestFalse("Unknown user", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_User, "User2", EPubnubTokenPermission::PTP_Get));
+    TestFalse("Resource names are case-sensitive", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_User, "user1", EPubnubTokenPermission::PTP_Update));
+
+    // Patterns
+    TestTrue("Prefix pattern Join", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "team-red", EPubnubTokenPermission::PTP_Join));
+    TestFalse("Prefix pattern doesn't match in the middle", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "my-team-red", EPubnubTokenPermission::PTP_Join));
+    TestTrue("Exact pattern Read", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "lobby", EPubnubTokenPermission::PTP_Read));
+    TestFalse("Exact pattern doesn't match longer name", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "lobby2", EPubnubTokenPermission::PTP_Read));
+    TestTrue("Regex pattern Write", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "game-room-12", EPubnubTokenPermission::PTP_Write));
+    TestFalse("Regex pattern doesn't match", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_Channel, "game-room-x", EPubnubTokenPermission::PTP_Write));
+    TestTrue("User prefix pattern Get", ParsedToken->HasPermission(EPubnubTokenResourceType::PTRT_User, "npc-42", EPubnubTokenPermission::PTP_Get));
+
+    // Bitmask combines resource with matching patterns
+    TestEqual("Resource bitmask", static_cast<int32>(ParsedToken->GetPermissionsBitmask(EPubnubTokenResourceType::PTRT_Channel, "my_channel")), 3);
+    TestEqual("Pattern bitmask", static_cast<int32>(ParsedToken->GetPermissionsBitmask(EPubnubTokenResourceType::PTRT_Channel, "team-room-7")), 130);
+
+    // Permission bits match UPubnubTokenUtilities
+    FPubnubChannelPermissions ChannelPermissions;
+    ChannelPermissions.Join = true;
+    ChannelPermissions.Get = true;
+    TestEqual("Permission bits match channel bitmask", UPubnubTokenUtilities::GetPermissionBit(EPubnubTokenPermission::PTP_Join) | UPubnubTokenUtilities::GetPermissionBit(EPubnubTokenPermission::PTP_Get),
+        UPubnubTokenUtilities::CalculateChannelPermissionsBitmask(ChannelPermissions));
+
+    // Invalid input
+    TestFalse("Empty string should not be parsed", FPubnubParsedToken::FromParsedTokenJson(TEXT("")).IsValid());
+    TestFalse("Invalid json should not be parsed", FPubnubParsedToken::FromParsedTokenJson(TEXT("invalid json")).IsValid());
+
+    return true;
+}
+
+bool FPubnubTokenCacheUnitTest::RunTest(const FString& Parameters)
+{
+    TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedTokenA = FPubnubParsedToken::FromParsedTokenJson(TEXT(R"({"v":2,"t":1752219810,"ttl":30,"res":{"chan":{"a":1}}})"));
+    TSharedPtr<const FPubnubParsedToken, ESPMode::ThreadSafe> ParsedTokenB = FPubnubParsedToken::FromParsedTokenJson(TEXT(R"({"v":2,"t":1752219810,"ttl":30,"res":{"chan":{"b":1}}})"));
+    if (!ParsedTokenA.IsValid() || !ParsedTokenB.IsValid())
+    {
+        AddError("Sample tokens should be parsed");
+        return false;
+    }
+
+    FPubnubTokenCache Cache(2);
+    TestFalse("Empty cache should miss", Cache.Find(TEXT("TokenA")).IsValid());
+
+    Cache.Add(TEXT("TokenA"), ParsedTokenA.ToSharedRef());
+    TestTrue("Cache should return added token", Cache.Find(TEXT("TokenA")) == ParsedTokenA);
+    TestFalse("Other token should miss", Cache.Find(TEXT("TokenB")).IsValid());
+
+    // Adding the same token again keeps the first parsed one
+    TestTrue("Second add returns cached token", Cache.Add(TEXT("TokenA"), ParsedTokenB.ToSharedRef()) == ParsedTokenA.ToSharedRef());
+    TestEqual("Cache should hold one token", Cache.Num(), 1);
+
+    // Capacity is never exceeded
+    Cache.Add(TEXT("TokenB"), ParsedTokenB.ToSharedRef());
+    Cache.Add(TEXT("TokenC"), ParsedTokenB.ToSharedRef());
+    TestEqual("Cache should not grow above capacity", Cache.Num(), 2);
+    TestTrue("Last added token should be cached", Cache.Find(TEXT("TokenC")).IsValid());
+
+    Cache.Empty();
+    TestEqual("Cache should be empty", Cache.Num(), 0);
+
+    return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
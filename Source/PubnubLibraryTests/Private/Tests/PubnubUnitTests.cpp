@@ -3,8 +3,20 @@
 #include "PubnubEnumLibrary.h"
 #include "PubnubStructLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Crypto/PubnubAesCryptor.h"
+#include "Crypto/PubnubCryptoModule.h"
+#include "Crypto/PubnubLegacyCryptor.h"
+#include "FunctionLibraries/PubnubCryptoUtilities.h"
 #include "FunctionLibraries/PubnubJsonUtilities.h"
 #include "FunctionLibraries/PubnubUtilities.h"
+#include "FunctionLibraries/PubnubInternalUtilities.h"
+#include "Entities/PubnubChannelHandlerIndex.h"
+#include "PubnubNativeMessage.h"
+#include "Logging/PubnubLogManager.h"
+#include "Logging/PubnubAsyncLogSink.h"
+#include "HAL/PlatformProcess.h"
+#include "Async/Async.h"
+#include "PubnubBaseLogger.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 
@@ -60,6 +72,22 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetJsonFromMembershipsToRemoveUnitTest, "Pubnu
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetJsonFromChannelMembersToRemoveUnitTest, "Pubnub.aUnit.JsonUtilities.GetJsonFromChannelMembersToRemove", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetOperationResultFromJsonAppContextUnitTest, "Pubnub.aUnit.JsonUtilities.GetOperationResultFromJsonAppContext", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGetMessageActionFromMessageDataUnitTest, "Pubnub.aUnit.JsonUtilities.GetMessageActionFromMessageData", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClassifyJsonPayloadUnitTest, "Pubnub.aUnit.JsonUtilities.ClassifyJsonPayload", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FJsonPayloadToMessageStringUnitTest, "Pubnub.aUnit.JsonUtilities.JsonPayloadToMessageString", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLogManagerCachedLevelsUnitTest, "Pubnub.aUnit.Logging.LogManagerCachedLevels", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLogManagerRemoveLoggerDuringDispatchUnitTest, "Pubnub.aUnit.Logging.LogManagerRemoveLoggerDuringDispatch", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncLogSinkDeliversInOrderUnitTest, "Pubnub.aUnit.Logging.AsyncLogSinkDeliversInOrder", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncLogSinkDropsWhenFullUnitTest, "Pubnub.aUnit.Logging.AsyncLogSinkDropsWhenFull", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAsyncLogSinkBoundedBackpressureUnitTest, "Pubnub.aUnit.Logging.AsyncLogSinkBoundedBackpressure", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCryptorCipherKeyChangeUnitTest, "Pubnub.aUnit.Crypto.CryptorCipherKeyChange", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCryptoModuleBytesApiUnitTest, "Pubnub.aUnit.Crypto.CryptoModuleBytesApi", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAppContextSinglePassReaderUnitTest, "Pubnub.aUnit.JsonUtilities.AppContextSinglePassReader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFetchHistoryUtf8ReaderUnitTest, "Pubnub.aUnit.JsonUtilities.FetchHistoryUtf8Reader", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FChannelHandlerIndexUnitTest, "Pubnub.aUnit.Subscribe.ChannelHandlerIndex", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPresenceEventMessageUnitTest, "Pubnub.aUnit.Utilities.IsPresenceEventMessage", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNativeMessageUnitTest, "Pubnub.aUnit.Subscribe.NativeMessage", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPublishMethodForMessageSizeUnitTest, "Pubnub.aUnit.Utilities.PublishMethodForMessageSize", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRetryPolicyUnitTest, "Pubnub.aUnit.Utilities.RetryPolicy", EAutomationTestFlags::EditorContext | EAutomationTestFlags::SmokeFilter);
 
 
 
@@ -2969,4 +2997,669 @@ bool FGetMessageActionFromMessageDataUnitTest::RunTest(const FString& Parameters
 	return true;
 }
 
-#endif // WITH_DEV_AUTOMATION_TESTS
\ No newline at end of file
+bool FClassifyJsonPayloadUnitTest::RunTest(const FString& Parameters)
+{
+	auto Classify = [](const char* Payload)
+	{
+		return UPubnubJsonUtilities::ClassifyJsonPayload(Payload, FCStringAnsi::Strlen(Payload));
+	};
+
+	// Test with every root type
+	TestTrue("Object should be classified as Object", Classify("{\"name\":\"test\",\"value\":[1,2.5,-3e2,true,null]}") == EPubnubJsonPayloadType::Object);
+	TestTrue("Array should be classified as Array", Classify("[\"test\",42,{\"a\":{}}]") == EPubnubJsonPayloadType::Array);
+	TestTrue("String should be classified as String", Classify("\"hello \\\"world\\\" \\u00e9\"") == EPubnubJsonPayloadType::String);
+	TestTrue("Number should be classified as Number", Classify("-12.5e3") == EPubnubJsonPayloadType::Number);
+	TestTrue("True should be classified as Boolean", Classify("true") == EPubnubJsonPayloadType::Boolean);
+	TestTrue("False should be classified as Boolean", Classify("false") == EPubnubJsonPayloadType::Boolean);
+	TestTrue("Null should be classified as Null", Classify("null") == EPubnubJsonPayloadType::Null);
+
+	// Test with whitespace around the root value
+	TestTrue("Whitespace around object should be allowed", Classify(" \n{ \"a\" : 1 }\t") == EPubnubJsonPayloadType::Object);
+
+	// Test with invalid payloads
+	TestTrue("Plain text should be Invalid", Classify("this is not json") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Unterminated object should be Invalid", Classify("{\"a\":1") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Trailing comma should be Invalid", Classify("[1,2,]") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Unterminated string should be Invalid", Classify("\"hello") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Invalid escape should be Invalid", Classify("\"\\x\"") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Leading zero should be Invalid", Classify("012") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Content after root value should be Invalid", Classify("\"a\" \"b\"") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Empty payload should be Invalid", Classify("") == EPubnubJsonPayloadType::Invalid);
+	TestTrue("Null pointer should be Invalid", UPubnubJsonUtilities::ClassifyJsonPayload(nullptr, 10) == EPubnubJsonPayloadType::Invalid);
+
+	return true;
+}
+
+bool FJsonPayloadToMessageStringUnitTest::RunTest(const FString& Parameters)
+{
+	//Result has to be the same as with the Json DOM based path used before
+	auto LegacyConversion = [](const FString& Payload)
+	{
+		return UPubnubJsonUtilities::IsCorrectJsonString(Payload, false) ? Payload : UPubnubJsonUtilities::DeserializeString(Payload);
+	};
+
+	TArray<FString> Payloads = {
+		TEXT("{\"name\":\"test\",\"value\":42}"),
+		TEXT("[\"test\",42,true]"),
+		TEXT("\"hello world\""),
+		TEXT("\"hello \\\"world\\\"\""),
+		TEXT("\"line\\nbreak\\ttab\\\\backslash\\/slash\""),
+		TEXT("\"\\u0041\\u00e9\\u20ac\""),
+		TEXT("\"Zo\u00eb \u20ac\""),
+		TEXT("\"\""),
+		TEXT("42"),
+		TEXT("-12.5"),
+		TEXT("true"),
+		TEXT("false"),
+		TEXT("this is not json")
+	};
+
+	for(const FString& Payload : Payloads)
+	{
+		FTCHARToUTF8 Utf8Payload(*Payload);
+		FString Converted = UPubnubJsonUtilities::JsonPayloadToMessageString(Utf8Payload.Get(), Utf8Payload.Length());
+		TestEqual(FString::Printf(TEXT("Payload %s should be converted the same way as before"), *Payload), Converted, LegacyConversion(Payload));
+	}
+
+	// Test with escaped surrogate pair
+	const char* EmojiPayload = "\"\\ud83d\\ude00\"";
+	FString ConvertedEmoji = UPubnubJsonUtilities::JsonPayloadToMessageString(EmojiPayload, FCStringAnsi::Strlen(EmojiPayload));
+	FString ExpectedEmoji = FString(FUTF8ToTCHAR("\xF0\x9F\x98\x80").Get());
+	TestEqual("Escaped surrogate pair should become a single character", ConvertedEmoji, ExpectedEmoji);
+
+	// Test with empty payload
+	TestEqual("Empty payload should give empty string", UPubnubJsonUtilities::JsonPayloadToMessageString(nullptr, 0), "");
+
+	return true;
+}
+
+bool FLogManagerCachedLevelsUnitTest::RunTest(const FString& Parameters)
+{
+	UPubnubLogManager* LogManager = NewObject<UPubnubLogManager>();
+	TestFalse("Nothing should be enabled without loggers", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Error, EPubnubLogSource::PLS_UE));
+
+	UPubnubBaseLogger* WarningLogger = NewObject<UPubnubBaseLogger>();
+	IPubnubLoggerInterface::Execute_SetMinimumLogLevel(WarningLogger, EPubnubLogLevel::PLL_Warning);
+	IPubnubLoggerInterface::Execute_SetMinimumCCoreLogLevel(WarningLogger, EPubnubLogLevel::PLL_None);
+	TScriptInterface<IPubnubLoggerInterface> WarningInterface;
+	WarningInterface.SetObject(WarningLogger);
+	WarningInterface.SetInterface(Cast<IPubnubLoggerInterface>(WarningLogger));
+	LogManager->AddLogger(WarningInterface);
+
+	// Test aggregate level of a single logger
+	TestTrue("Error should be enabled with Warning logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Error, EPubnubLogSource::PLS_UE));
+	TestTrue("Warning should be enabled with Warning logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE));
+	TestFalse("Debug should be disabled with Warning logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE));
+	TestFalse("C-Core logs should be disabled with None level", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Error, EPubnubLogSource::PLS_CCore));
+	TestFalse("None level messages should never be enabled", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_None, EPubnubLogSource::PLS_UE));
+	TestEqual("Most verbose UE level should be Warning", LogManager->GetMostVerboseEnabledLevel(EPubnubLogSource::PLS_UE), EPubnubLogLevel::PLL_Warning);
+	TestEqual("Most verbose C-Core level should be None", LogManager->GetMostVerboseEnabledLevel(EPubnubLogSource::PLS_CCore), EPubnubLogLevel::PLL_None);
+
+	// Test that the most verbose logger wins
+	UPubnubBaseLogger* TraceLogger = NewObject<UPubnubBaseLogger>();
+	TScriptInterface<IPubnubLoggerInterface> TraceInterface;
+	TraceInterface.SetObject(TraceLogger);
+	TraceInterface.SetInterface(Cast<IPubnubLoggerInterface>(TraceLogger));
+	LogManager->AddLogger(TraceInterface);
+	TestTrue("Trace should be enabled after adding Trace logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_UE));
+	TestTrue("C-Core Trace should be enabled after adding Trace logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_CCore));
+	TestEqual("Most verbose C-Core level should follow the Trace logger", LogManager->GetMostVerboseEnabledLevel(EPubnubLogSource::PLS_CCore), EPubnubLogLevel::PLL_Trace);
+
+	// Test that changing level of a registered logger refreshes the cache
+	IPubnubLoggerInterface::Execute_SetMinimumLogLevel(TraceLogger, EPubnubLogLevel::PLL_Error);
+	TestFalse("Debug should be disabled after raising logger level", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Debug, EPubnubLogSource::PLS_UE));
+	TestTrue("Warning should still be enabled by the other logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE));
+
+	// Test removing loggers
+	LogManager->RemoveLogger(WarningInterface);
+	TestFalse("Warning should be disabled after removing Warning logger", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Warning, EPubnubLogSource::PLS_UE));
+	LogManager->ClearLoggers();
+	TestFalse("Nothing should be enabled after clearing loggers", LogManager->IsLogEnabled(EPubnubLogLevel::PLL_Error, EPubnubLogSource::PLS_UE));
+
+	return true;
+}
+
+bool FLogManagerRemoveLoggerDuringDispatchUnitTest::RunTest(const FString& Parameters)
+{
+	UPubnubLogManager* LogManager = NewObject<UPubnubLogManager>();
+	//Loggers are kept alive only by the manager, so the manager itself has to survive GC
+	LogManager->AddToRoot();
+
+	std::atomic<bool> StopLogging{false};
+	std::atomic<int32> LoggedCount{0};
+	TFuture<void> LoggingThread = Async(EAsyncExecution::Thread, [&]()
+	{
+		while (!StopLogging.load())
+		{
+			LogManager->Log(EPubnubLogLevel::PLL_Trace, EPubnubLogSource::PLS_UE, TEXT("Message"));
+			LoggedCount++;
+		}
+	});
+
+	TArray<TWeakObjectPtr<UPubnubBaseLogger>> RemovedLoggers;
+	for (int32 i = 0; i < 20; i++)
+	{
+		UPubnubBaseLogger* Logger = NewObject<UPubnubBaseLogger>();
+		TScriptInterface<IPubnubLoggerInterface> LoggerInterface;
+		LoggerInterface.SetObject(Logger);
+		LoggerInterface.SetInterface(Cast<IPubnubLoggerInterface>(Logger));
+		LogManager->AddLogger(LoggerInterface);
+
+		//Give the logging thread time to take a dispatch table with this logger, then drop the only reference and collect it
+		FPlatformProcess::Sleep(0.005f);
+		LogManager->RemoveLogger(LoggerInterface);
+		RemovedLoggers.Add(Logger);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	}
+
+	StopLogging.store(true);
+	LoggingThread.Wait();
+	LogManager->RemoveFromRoot();
+
+	TestTrue("Logging thread should keep logging while loggers are collected", LoggedCount.load() > 0);
+	bool AllCollected = true;
+	for (const TWeakObjectPtr<UPubnubBaseLogger>& RemovedLogger : RemovedLoggers)
+	{
+		AllCollected &= !RemovedLogger.IsValid();
+	}
+	TestTrue("Removed loggers should be collected", AllCollected);
+
+	return true;
+}
+
+bool FAsyncLogSinkDeliversInOrderUnitTest::RunTest(const FString& Parameters)
+{
+	const int32 MessagesCount = 1000;
+	TArray<FString> Received;
+	FPubnubAsyncLogSink Sink(128, [&Received](TArrayView<const FPubnubLogRecord> Records)
+	{
+		for (const FPubnubLogRecord& Record : Records)
+		{
+			Received.Add(Record.Message);
+		}
+	});
+
+	for (int32 i = 0; i < MessagesCount; i++)
+	{
+		FPubnubLogRecord Message;
+		//Error level waits for a free slot instead of being dropped
+		Message.LogLevel = EPubnubLogLevel::PLL_Error;
+		Message.Message = FString::FromInt(i);
+		TestTrue("Sink should accept messages before shutdown", Sink.Enqueue(MoveTemp(Message)));
+	}
+
+	//Shutdown dispatches everything that was queued
+	Sink.Shutdown();
+
+	TestEqual("All messages should be delivered", Received.Num(), MessagesCount);
+	bool InOrder = true;
+	for (int32 i = 0; i < Received.Num(); i++)
+	{
+		InOrder &= Received[i] == FString::FromInt(i);
+	}
+	TestTrue("Messages should be delivered in the order they were queued", InOrder);
+
+	const FPubnubAsyncLogStats Stats = Sink.GetStats();
+	TestEqual("Enqueued count should match", Stats.EnqueuedCount, static_cast<int64>(MessagesCount));
+	TestEqual("Dispatched count should match", Stats.DispatchedCount, static_cast<int64>(MessagesCount));
+	TestEqual("Nothing should be dropped", Stats.DroppedCount, static_cast<int64>(0));
+
+	FPubnubLogRecord LateMessage;
+	TestFalse("Sink should refuse messages after shutdown", Sink.Enqueue(MoveTemp(LateMessage)));
+
+	return true;
+}
+
+bool FAsyncLogSinkDropsWhenFullUnitTest::RunTest(const FString& Parameters)
+{
+	std::atomic<bool> HandlerEntered{false};
+	std::atomic<bool> ReleaseHandler{false};
+	FPubnubAsyncLogSink Sink(64, [&](TArrayView<const FPubnubLogRecord> Records)
+	{
+		HandlerEntered.store(true);
+		while (!ReleaseHandler.load())
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	});
+
+	auto EnqueueDebug = [&Sink]()
+	{
+		FPubnubLogRecord Message;
+		Message.LogLevel = EPubnubLogLevel::PLL_Debug;
+		Sink.Enqueue(MoveTemp(Message));
+	};
+
+	//Block the sink thread inside the handler, so the queue can fill up
+	EnqueueDebug();
+	const double EndTime = FPlatformTime::Seconds() + 5.0;
+	while (!HandlerEntered.load() && FPlatformTime::Seconds() < EndTime)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	TestTrue("Sink thread should start dispatching", HandlerEntered.load());
+
+	for (int32 i = 0; i < 64 + 10; i++)
+	{
+		EnqueueDebug();
+	}
+
+	ReleaseHandler.store(true);
+	Sink.Shutdown();
+
+	const FPubnubAsyncLogStats Stats = Sink.GetStats();
+	TestEqual("Messages over capacity should be dropped", Stats.DroppedCount, static_cast<int64>(10));
+	TestEqual("All accepted messages should be dispatched", Stats.DispatchedCount, static_cast<int64>(65));
+	TestEqual("No message should wait for a free slot", Stats.BackpressureCount, static_cast<int64>(0));
+
+	return true;
+}
+
+bool FAsyncLogSinkBoundedBackpressureUnitTest::RunTest(const FString& Parameters)
+{
+	std::atomic<bool> HandlerEntered{false};
+	std::atomic<bool> ReleaseHandler{false};
+	FPubnubAsyncLogSink Sink(64, [&](TArrayView<const FPubnubLogRecord> Records)
+	{
+		HandlerEntered.store(true);
+		while (!ReleaseHandler.load())
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	});
+
+	auto EnqueueError = [&Sink]()
+	{
+		FPubnubLogRecord Record;
+		Record.LogLevel = EPubnubLogLevel::PLL_Error;
+		Sink.Enqueue(MoveTemp(Record));
+	};
+
+	//Block the sink thread inside the handler, so the queue can fill up
+	EnqueueError();
+	const double EndTime = FPlatformTime::Seconds() + 5.0;
+	while (!HandlerEntered.load() && FPlatformTime::Seconds() < EndTime)
+	{
+		FPlatformProcess::Sleep(0.001f);
+	}
+	TestTrue("Sink thread should start dispatching", HandlerEntered.load());
+
+	for (int32 i = 0; i < 64; i++)
+	{
+		EnqueueError();
+	}
+
+	//Stuck logger must not block the thread that logs for longer than the backpressure limit
+	const double StartTime = FPlatformTime::Seconds();
+	EnqueueError();
+	const double WaitedSeconds = FPlatformTime::Seconds() - StartTime;
+	TestTrue("Error should wait at least a moment for a free slot", WaitedSeconds >= FPubnubAsyncLogSink::MaxBackpressureWaitSeconds * 0.5);
+	TestTrue("Error should stop waiting after the backpressure limit", WaitedSeconds < FPubnubAsyncLogSink::MaxBackpressureWaitSeconds + 2.0);
+
+	ReleaseHandler.store(true);
+	Sink.Shutdown();
+
+	const FPubnubAsyncLogStats Stats = Sink.GetStats();
+	TestEqual("Error that waited too long should be dropped", Stats.DroppedCount, static_cast<int64>(1));
+	TestEqual("Error should be counted as backpressure", Stats.BackpressureCount, static_cast<int64>(1));
+	TestEqual("All accepted errors should be dispatched", Stats.DispatchedCount, static_cast<int64>(65));
+
+	return true;
+}
+
+bool FCryptorCipherKeyChangeUnitTest::RunTest(const FString& Parameters)
+{
+	const FString Message = TEXT("{\"text\":\"key change test\"}");
+
+	UPubnubAesCryptor* AesCryptor = NewObject<UPubnubAesCryptor>();
+	UPubnubLegacyCryptor* LegacyCryptor = NewObject<UPubnubLegacyCryptor>();
+
+	for(UObject* Cryptor : TArray<UObject*>{AesCryptor, LegacyCryptor})
+	{
+		auto SetKey = [&](const FString& Key)
+		{
+			if(UPubnubAesCryptor* Aes = Cast<UPubnubAesCryptor>(Cryptor)) { Aes->SetCipherKey(Key); }
+			else { Cast<UPubnubLegacyCryptor>(Cryptor)->SetCipherKey(Key); }
+		};
+
+		SetKey(TEXT("first-key"));
+		const FPubnubEncryptedData EncryptedWithFirstKey = IPubnubCryptorInterface::Execute_Encrypt(Cryptor, Message);
+		TestEqual("Message should be decrypted with the same key", IPubnubCryptorInterface::Execute_Decrypt(Cryptor, EncryptedWithFirstKey), Message);
+
+		//Cached key and the thread's cipher context have to follow the new key
+		SetKey(TEXT("second-key"));
+		const FPubnubEncryptedData EncryptedWithSecondKey = IPubnubCryptorInterface::Execute_Encrypt(Cryptor, Message);
+		TestEqual("Message should be decrypted with the new key", IPubnubCryptorInterface::Execute_Decrypt(Cryptor, EncryptedWithSecondKey), Message);
+		TestNotEqual("Ciphertext should differ between keys", EncryptedWithSecondKey.EncryptedData, EncryptedWithFirstKey.EncryptedData);
+
+		SetKey(TEXT("first-key"));
+		TestEqual("Message should be decrypted after switching back to the first key", IPubnubCryptorInterface::Execute_Decrypt(Cryptor, EncryptedWithFirstKey), Message);
+	}
+
+	return true;
+}
+
+bool FCryptoModuleBytesApiUnitTest::RunTest(const FString& Parameters)
+{
+	const FString Message = TEXT("{\"text\":\"caf\u00E9 \u263A\"}");
+	FTCHARToUTF8 Utf8Message(*Message);
+	const TConstArrayView<uint8> MessageBytes(reinterpret_cast<const uint8*>(Utf8Message.Get()), Utf8Message.Length());
+
+	UPubnubAesCryptor* AesCryptor = NewObject<UPubnubAesCryptor>();
+	AesCryptor->SetCipherKey(TEXT("bytes-api-key"));
+	UPubnubLegacyCryptor* LegacyCryptor = NewObject<UPubnubLegacyCryptor>();
+	LegacyCryptor->SetCipherKey(TEXT("bytes-api-key"));
+
+	for(UObject* DefaultCryptor : TArray<UObject*>{AesCryptor, LegacyCryptor})
+	{
+		UObject* OtherCryptor = DefaultCryptor == AesCryptor ? static_cast<UObject*>(LegacyCryptor) : static_cast<UObject*>(AesCryptor);
+		TScriptInterface<IPubnubCryptorInterface> DefaultInterface; DefaultInterface.SetObject(DefaultCryptor); DefaultInterface.SetInterface(Cast<IPubnubCryptorInterface>(DefaultCryptor));
+		TScriptInterface<IPubnubCryptorInterface> OtherInterface; OtherInterface.SetObject(OtherCryptor); OtherInterface.SetInterface(Cast<IPubnubCryptorInterface>(OtherCryptor));
+		UPubnubCryptoModule* Module = NewObject<UPubnubCryptoModule>();
+		Module->InitCryptoModule(DefaultInterface, {OtherInterface});
+
+		//Bytes encrypted by the native API have to be readable by the Blueprint API and the other way around
+		TArray<uint8> EncryptedBytes;
+		TestTrue("ProviderEncryptBytes should succeed", IPubnubCryptoProviderInterface::ProviderEncryptBytes(Module, MessageBytes, EncryptedBytes));
+		const FString EncryptedBase64 = UPubnubCryptoUtilities::Base64Encode(EncryptedBytes);
+		TestEqual("ProviderDecrypt should read ProviderEncryptBytes output", IPubnubCryptoProviderInterface::Execute_ProviderDecrypt(Module, EncryptedBase64), Message);
+
+		TArray<uint8> EncryptedFromString;
+		UPubnubCryptoUtilities::Base64Decode(IPubnubCryptoProviderInterface::Execute_ProviderEncrypt(Module, Message), EncryptedFromString);
+		TArray<uint8> DecryptedBytes;
+		TestTrue("ProviderDecryptBytes should succeed", IPubnubCryptoProviderInterface::ProviderDecryptBytes(Module, EncryptedFromString, DecryptedBytes));
+		TestTrue("ProviderDecryptBytes should give the original UTF-8 bytes",
+			DecryptedBytes.Num() == MessageBytes.Num() && FMemory::Memcmp(DecryptedBytes.GetData(), MessageBytes.GetData(), MessageBytes.Num()) == 0);
+	}
+
+	return true;
+}
+
+bool FAppContextSinglePassReaderUnitTest::RunTest(const FString& Parameters)
+{
+	//Whitespace, escapes, non-ASCII text, unknown nested fields and values of unexpected types
+	const FString MembersJson = TEXT("{ \"status\" : 200, \"extra\": {\"data\": [1, {\"id\": \"x\"}]},\n")
+		TEXT("  \"data\": [ {\"uuid\": {\"id\": \"user\\u0031\", \"name\": \"Zo\u00EB \\\"Z\\\" \\ud83d\\ude00\", \"custom\": { \"level\" : 7 }, \"email\": null},")
+		TEXT(" \"custom\": null, \"status\": 5, \"type\": true, \"eTag\": [\"a\"]},")
+		TEXT(" \"not an object\" ],\n  \"next\": \"Mg\", \"totalCount\": 12 }");
+	FPubnubOperationResult Result;
+	TArray<FPubnubChannelMemberData> MembersData;
+	FPubnubPage Page;
+	int TotalCount = 0;
+	UPubnubJsonUtilities::GetChannelMembersJsonToData(MembersJson, Result, MembersData, Page, TotalCount);
+
+	TestFalse("Response should not be an error", Result.Error);
+	TestEqual("Status should be read", Result.Status, 200);
+	TestEqual("Next page should be read", Page.Next, TEXT("Mg"));
+	TestEqual("Total count should be read", TotalCount, 12);
+	if(TestEqual("Every element of data should give a member", MembersData.Num(), 2))
+	{
+		TestEqual("Escaped characters in user ID should be decoded", MembersData[0].User.UserID, TEXT("user1"));
+		TestEqual("Escapes, UTF-8 and surrogate pairs should be decoded", MembersData[0].User.UserName, TEXT("Zo\u00EB \"Z\" \U0001F600"));
+		TestEqual("Custom should be kept as raw JSON", MembersData[0].User.Custom, TEXT("{ \"level\" : 7 }"));
+		TestEqual("Null string should leave the field empty", MembersData[0].User.Email, TEXT(""));
+		TestEqual("Null custom should leave the field empty", MembersData[0].Custom, TEXT(""));
+		TestEqual("Number should be read as a string", MembersData[0].Status, TEXT("5"));
+		TestEqual("Boolean should be read as a string", MembersData[0].Type, TEXT("true"));
+		TestEqual("Array should not be read as a string", MembersData[0].ETag, TEXT(""));
+		TestEqual("Element that is not an object should give empty member", MembersData[1].User.UserID, TEXT(""));
+	}
+
+	//App Context returns error details as an object
+	const FString ErrorJson = TEXT("{\"status\":404,\"error\":{\"message\":\"Requested object was not found.\",\"source\":\"objects\"}}");
+	TArray<FPubnubUserData> UsersData;
+	UPubnubJsonUtilities::GetAllUserMetadataJsonToData(ErrorJson, Result, UsersData, Page, TotalCount);
+	TestTrue("Non 200 status should be an error", Result.Error);
+	TestEqual("Error object should be the error message", Result.ErrorMessage, TEXT("{\"message\":\"Requested object was not found.\",\"source\":\"objects\"}"));
+
+	//Broken response must not leave partially read elements behind
+	UsersData.Reset();
+	Result = FPubnubOperationResult();
+	UPubnubJsonUtilities::GetAllUserMetadataJsonToData(TEXT("{\"status\":200,\"data\":[{\"id\":\"user\"},{\"id\":"), Result, UsersData, Page, TotalCount);
+	TestTrue("Truncated response should be an error", Result.Error);
+	TestEqual("Truncated response should not give any users", UsersData.Num(), 0);
+
+	Result = FPubnubOperationResult();
+	UPubnubJsonUtilities::GetAllUserMetadataJsonToData(TEXT("{\"status\":200,\"data\":[]} trailing"), Result, UsersData, Page, TotalCount);
+	TestTrue("Data after the root object should be an error", Result.Error);
+
+	return true;
+}
+
+bool FFetchHistoryUtf8ReaderUnitTest::RunTest(const FString& Parameters)
+{
+	//Object and array payloads are condensed, whitespace inside of strings is kept
+	const ANSICHAR* HistoryJson = "{\"status\": 200, \"error\": false, \"error_message\": \"\", \"channels\": {\"ch\\u0031\": [\n"
+		"  {\"message\": { \"text\" : \"a b\", \"list\": [ 1, 2 ] }, \"timetoken\": \"1\", \"uuid\": \"u\\\"1\", \"meta\": [ \"x\" , {\"y\": null} ]},\n"
+		"  {\"message\": 42, \"timetoken\": 17302160534651740, \"message_type\": 4, \"actions\": {\"reaction\": {\"\\u2764\": [{\"uuid\": \"u2\", \"actionTimetoken\": \"3\"}]}}},\n"
+		"  {\"message\": [ \"first\", \"second\" ], \"timetoken\": \"2\"}\n"
+		"]}}";
+	FPubnubOperationResult Result;
+	TArray<FPubnubHistoryMessageData> Messages;
+	UPubnubJsonUtilities::FetchHistoryJsonToData(HistoryJson, FCStringAnsi::Strlen(HistoryJson), Result, Messages);
+
+	TestFalse("Response should not be an error", Result.Error);
+	TestEqual("Status should be read", Result.Status, 200);
+	if(TestEqual("Every message should be read", Messages.Num(), 3))
+	{
+		TestEqual("Escaped channel name should be decoded", Messages[0].Channel, TEXT("ch1"));
+		TestEqual("Object message should be condensed", Messages[0].Message, TEXT("{\"text\":\"a b\",\"list\":[1,2]}"));
+		TestEqual("Escaped user ID should be decoded", Messages[0].UserID, TEXT("u\"1"));
+		TestEqual("Array meta should be condensed", Messages[0].Meta, TEXT("[\"x\",{\"y\":null}]"));
+		TestEqual("Number message should be kept", Messages[1].Message, TEXT("42"));
+		TestEqual("Number timetoken should be read as a string", Messages[1].Timetoken, TEXT("17302160534651740"));
+		TestEqual("Number message type should be read as a string", Messages[1].MessageType, TEXT("4"));
+		if(TestEqual("Message action should be read", Messages[1].MessageActions.Num(), 1))
+		{
+			TestEqual("Escaped action value should be decoded", Messages[1].MessageActions[0].Value, TEXT("\u2764"));
+			TestEqual("Action should get the message timetoken", Messages[1].MessageActions[0].MessageTimetoken, TEXT("17302160534651740"));
+		}
+		TestEqual("Array message should be condensed", Messages[2].Message, TEXT("[\"first\",\"second\"]"));
+	}
+
+	//Messages read before the response turned out to be broken are dropped
+	Messages.Reset();
+	const ANSICHAR* TruncatedJson = "{\"status\": 200, \"channels\": {\"ch\": [{\"message\": \"m\", \"timetoken\": \"1\"}, {\"message\": ";
+	UPubnubJsonUtilities::FetchHistoryJsonToData(TruncatedJson, FCStringAnsi::Strlen(TruncatedJson), Result, Messages);
+	TestTrue("Truncated response should be an error", Result.Error);
+	TestEqual("Truncated response should not give any messages", Messages.Num(), 0);
+
+	return true;
+}
+
+bool FChannelHandlerIndexUnitTest::RunTest(const FString& Parameters)
+{
+	FPubnubChannelHandlerIndex Index;
+	TestTrue("Exact channel handler added", Index.Add(1, TEXT("lobby")));
+	TestTrue("Second handler of the same channel added", Index.Add(2, TEXT("lobby")));
+	TestTrue("Wildcard handler added", Index.Add(3, TEXT("game.*")));
+	TestTrue("Longer wildcard handler added", Index.Add(4, TEXT("game.room.*")));
+	TestTrue("Catch-all wildcard handler added", Index.Add(5, TEXT("*")));
+	TestFalse("Empty channel can't be added", Index.Add(6, TEXT("")));
+	TestFalse("Handler ID can't be added twice", Index.Add(1, TEXT("other")));
+	TestEqual("Number of handlers", Index.Num(), 5);
+
+	FPubnubChannelHandlerIndex::FHandlerIDArray HandlerIDs;
+	Index.FindHandlers(TEXT("lobby"), HandlerIDs);
+	TestTrue("Exact handlers first, in bind order, then catch-all", HandlerIDs == FPubnubChannelHandlerIndex::FHandlerIDArray({1, 2, 5}));
+
+	HandlerIDs.Reset();
+	Index.FindHandlers(TEXT("game.room.12"), HandlerIDs);
+	TestTrue("Wildcards from the longest prefix", HandlerIDs == FPubnubChannelHandlerIndex::FHandlerIDArray({4, 3, 5}));
+
+	HandlerIDs.Reset();
+	Index.FindHandlers(TEXT("Lobby"), HandlerIDs);
+	TestTrue("Channel names are case-sensitive", HandlerIDs == FPubnubChannelHandlerIndex::FHandlerIDArray({5}));
+
+	TestTrue("Handler removed", Index.Remove(4));
+	TestFalse("Handler can't be removed twice", Index.Remove(4));
+	TestTrue("Catch-all handler removed", Index.Remove(5));
+	HandlerIDs.Reset();
+	Index.FindHandlers(TEXT("game.room.12"), HandlerIDs);
+	TestTrue("Only remaining wildcard matches", HandlerIDs == FPubnubChannelHandlerIndex::FHandlerIDArray({3}));
+
+	HandlerIDs.Reset();
+	Index.FindHandlers(TEXT("chat"), HandlerIDs);
+	TestEqual("Unknown channel has no handlers", HandlerIDs.Num(), 0);
+
+	Index.Empty();
+	HandlerIDs.Reset();
+	Index.FindHandlers(TEXT("lobby"), HandlerIDs);
+	TestEqual("No handlers after Empty", HandlerIDs.Num(), 0);
+	TestEqual("Index is empty", Index.Num(), 0);
+
+	return true;
+}
+
+bool FPresenceEventMessageUnitTest::RunTest(const FString& Parameters)
+{
+	auto MakeMessage = [](const char* Channel, pubnub_message_type MessageType)
+	{
+		pubnub_v2_message Message = {};
+		Message.channel.ptr = Channel;
+		Message.channel.size = FCStringAnsi::Strlen(Channel);
+		Message.message_type = MessageType;
+		return Message;
+	};
+
+	TestTrue("Published message on presence channel", UPubnubUtilities::IsPresenceEventMessage(MakeMessage("lobby-pnpres", pbsbPublished)));
+	TestFalse("Regular channel", UPubnubUtilities::IsPresenceEventMessage(MakeMessage("lobby", pbsbPublished)));
+	TestFalse("Presence suffix only in the middle", UPubnubUtilities::IsPresenceEventMessage(MakeMessage("lobby-pnpres-chat", pbsbPublished)));
+	TestFalse("Signal on presence channel", UPubnubUtilities::IsPresenceEventMessage(MakeMessage("lobby-pnpres", pbsbSignal)));
+	TestFalse("Channel shorter than suffix", UPubnubUtilities::IsPresenceEventMessage(MakeMessage("pres", pbsbPublished)));
+
+	return true;
+}
+
+bool FNativeMessageUnitTest::RunTest(const FString& Parameters)
+{
+	auto ToMemBlock = [](const char* Text)
+	{
+		pubnub_char_mem_block MemBlock;
+		MemBlock.ptr = Text;
+		MemBlock.size = FCStringAnsi::Strlen(Text);
+		return MemBlock;
+	};
+
+	pubnub_v2_message Message = {};
+	Message.payload = ToMemBlock("\"Player \\\"Zoe\\\" joined\"");
+	Message.metadata = ToMemBlock("{\"region\":\"eu\"}");
+	Message.channel = ToMemBlock("lobby-pnpres");
+	Message.publisher = ToMemBlock("user_\xC5\xBC");
+	Message.tt = ToMemBlock("17301234567890123");
+	Message.custom_message_type = ToMemBlock("chat-type");
+	Message.match_or_group = ToMemBlock("lobby_group");
+	Message.message_type = pbsbPublished;
+
+	TSharedRef<FPubnubMessageArena, ESPMode::ThreadSafe> Arena = MakeShared<FPubnubMessageArena, ESPMode::ThreadSafe>(4);
+	{
+		const FPubnubNativeMessage NativeMessage = UPubnubUtilities::NativeMessageFromPubnubMessage(Message, *Arena);
+		TestEqual("Timetoken is a number", NativeMessage.Timetoken, static_cast<int64>(17301234567890123));
+		TestTrue("Payload is a raw view", NativeMessage.Payload.Equals(FAnsiStringView("\"Player \\\"Zoe\\\" joined\"")));
+		TestTrue("Metadata is a raw view", NativeMessage.Metadata.Equals(FAnsiStringView("{\"region\":\"eu\"}")));
+		TestTrue("Payload and metadata share one block", NativeMessage.Block.IsValid() && NativeMessage.Metadata.GetData() == NativeMessage.Payload.GetData() + NativeMessage.Payload.Len());
+		TestTrue("Presence event is classified", NativeMessage.bIsPresenceEvent);
+
+		//Lazily built struct has to be the same as the one built straight from C-Core memory
+		const FPubnubMessageData Expected = UPubnubUtilities::UEMessageFromPubnubMessage(Message);
+		const FPubnubMessageData Built = NativeMessage.ToMessageData();
+		TestEqual("Message", Built.Message, Expected.Message);
+		TestEqual("Channel", Built.Channel, Expected.Channel);
+		TestEqual("UserID", Built.UserID, Expected.UserID);
+		TestEqual("Timetoken", Built.Timetoken, Expected.Timetoken);
+		TestEqual("Metadata", Built.Metadata, Expected.Metadata);
+		TestEqual("MessageType", Built.MessageType, Expected.MessageType);
+		TestEqual("CustomMessageType", Built.CustomMessageType, Expected.CustomMessageType);
+		TestEqual("MatchOrGroup", Built.MatchOrGroup, Expected.MatchOrGroup);
+
+		const FPubnubNativeMessage SecondMessage = UPubnubUtilities::NativeMessageFromPubnubMessage(Message, *Arena);
+		TestTrue("Same channel is interned once", SecondMessage.Channel == NativeMessage.Channel);
+		TestTrue("Every message has its own block", SecondMessage.Block.GetReference() != NativeMessage.Block.GetReference());
+		TestEqual("Blocks in use are not free", Arena->NumFreeBlocks(), 0);
+	}
+	TestEqual("Blocks go back to the arena with their messages", Arena->NumFreeBlocks(), 2);
+
+	FPubnubNameTable NameTable;
+	const FPubnubInternedName Lobby = NameTable.Intern(TEXT("Lobby"));
+	TestTrue("Interning from UTF-8 and FString gives the same name", NameTable.Intern(FAnsiStringView("Lobby")) == Lobby);
+	TestTrue("Names are case-sensitive", NameTable.Intern(TEXT("lobby")) != Lobby);
+	TestEqual("Interned string", Lobby.ToString(), FString(TEXT("Lobby")));
+	TestTrue("Empty string gives empty name", NameTable.Intern(FString()).IsEmpty());
+	TestEqual("Table holds each name once", NameTable.Num(), 2);
+
+	TestEqual("Empty timetoken", FPubnubNativeMessage::ParseTimetoken(FAnsiStringView()), static_cast<int64>(0));
+	TestEqual("Timetoken with letters", FPubnubNativeMessage::ParseTimetoken(FAnsiStringView("1730abc")), static_cast<int64>(0));
+	TestEqual("Timetoken out of range", FPubnubNativeMessage::ParseTimetoken(FAnsiStringView("99999999999999999999")), static_cast<int64>(0));
+
+	return true;
+}
+
+bool FPublishMethodForMessageSizeUnitTest::RunTest(const FString& Parameters)
+{
+	using EMethod = EPubnubPublishMethod;
+
+	TestEqual("Small message keeps GET", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaGET, 100, 2048), EMethod::PPM_SendViaGET);
+	TestEqual("Message at threshold is compressed", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaGET, 2048, 2048), EMethod::PPM_SendViaPOSTwithGZIP);
+	TestEqual("Large message is compressed", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaGET, 30000, 2048), EMethod::PPM_SendViaPOSTwithGZIP);
+	TestEqual("Zero threshold compresses everything", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaGET, 1, 0), EMethod::PPM_SendViaPOSTwithGZIP);
+	TestEqual("Negative threshold disables compression", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaGET, 30000, -1), EMethod::PPM_SendViaGET);
+	TestEqual("Explicit POST is kept", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_SendViaPOST, 30000, 2048), EMethod::PPM_SendViaPOST);
+	TestEqual("Explicit PATCH is kept", UPubnubInternalUtilities::GetPublishMethodForMessageSize(EMethod::PPM_UsePATCH, 30000, 2048), EMethod::PPM_UsePATCH);
+
+	return true;
+}
+
+bool FRetryPolicyUnitTest::RunTest(const FString& Parameters)
+{
+	// Retryable results
+	const EPubnubRetryEndpoint Storage = EPubnubRetryEndpoint::PRE_MessageStorage;
+	TestTrue("Timeout is retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_TIMEOUT, 0));
+	TestTrue("Failed connection is retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_CONNECT_FAILED, 0));
+	TestTrue("HTTP 503 is retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_HTTP_ERROR, 503));
+	TestTrue("HTTP 429 is retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_PUBLISH_FAILED, 429));
+	TestFalse("HTTP 403 is not retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_ACCESS_DENIED, 403));
+	TestFalse("HTTP 400 is not retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_PUBLISH_FAILED, 400));
+	TestFalse("Success is not retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_OK, 200));
+	TestFalse("Cancelled request is not retried", UPubnubInternalUtilities::IsRetryableResult(Storage, PNR_CANCELLED, 0));
+
+	// Publish and signal are retried only if the request wasn't sent or was rate limited
+	const EPubnubRetryEndpoint MessageSend = EPubnubRetryEndpoint::PRE_MessageSend;
+	TestTrue("Publish after failed DNS lookup is retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_ADDR_RESOLUTION_FAILED, 0));
+	TestTrue("Publish after failed connection is retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_CONNECT_FAILED, 0));
+	TestTrue("Publish after connect timeout is retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_WAIT_CONNECT_TIMEOUT, 0));
+	TestTrue("Rate limited publish is retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_PUBLISH_FAILED, 429));
+	TestFalse("Publish timeout is not retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_TIMEOUT, 0));
+	TestFalse("Publish connection timeout is not retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_CONNECTION_TIMEOUT, 0));
+	TestFalse("Publish IO error is not retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_IO_ERROR, 0));
+	TestFalse("Publish HTTP 503 is not retried", UPubnubInternalUtilities::IsRetryableResult(MessageSend, PNR_HTTP_ERROR, 503));
+
+	// Retry limits and excluded endpoints
+	FPubnubRetryConfig RetryConfig;
+	TestFalse("Default policy doesn't retry", UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_MessageSend, 0));
+	RetryConfig.Policy = EPubnubRetryPolicy::PRP_Exponential;
+	RetryConfig.MaxRetries = 3;
+	RetryConfig.ExcludedEndpoints.Add(EPubnubRetryEndpoint::PRE_MessageStorage);
+	TestTrue("First retry is allowed", UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_MessageSend, 0));
+	TestTrue("Last retry is allowed", UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_MessageSend, 2));
+	TestFalse("No retry after MaxRetries", UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_MessageSend, 3));
+	TestFalse("Excluded endpoint is not retried", UPubnubInternalUtilities::CanRetry(RetryConfig, EPubnubRetryEndpoint::PRE_MessageStorage, 0));
+
+	// Exponential delays grow up to the maximum, jitter is added on top
+	RetryConfig.DelaySeconds = 2.0f;
+	RetryConfig.MaximumDelaySeconds = 10.0f;
+	RetryConfig.JitterSeconds = 1.0f;
+	TestEqual("First exponential delay", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 0, 0.0f), 2.0f);
+	TestEqual("Second exponential delay", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 1, 0.0f), 4.0f);
+	TestEqual("Exponential delay is capped", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 5, 0.0f), 10.0f);
+	TestEqual("Large retry index doesn't overflow", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 1000, 0.0f), 10.0f);
+	TestEqual("Full jitter is added", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 0, 1.0f), 3.0f);
+
+	// Linear delay stays the same
+	RetryConfig.Policy = EPubnubRetryPolicy::PRP_Linear;
+	TestEqual("Linear delay of first retry", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 0, 0.5f), 2.5f);
+	TestEqual("Linear delay of later retry", UPubnubInternalUtilities::GetRetryDelaySeconds(RetryConfig, 4, 0.5f), 2.5f);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -23,6 +23,9 @@ extern "C" {
 #include "core/pubnub_blocking_io.h"
 #include "core/pubnub_ssl.h"
 #include "core/pubnub_timers.h"
+#if PUBNUB_SET_DNS_SERVERS
+#include "core/pubnub_dns_servers.h"
+#endif
 #include "core/pubnub_helper.h"
 #include "core/pubnub_free_with_timeout.h"
 #include "core/pubnub_ntf_sync.h"